@@ -1,11 +1,780 @@
 #include <pico.h>
 #include <stdbool.h>
 #include <assert.h>
+#include <stdio.h>
+
+#include <app/history.h>
+#include <app/plot.h>
+#include <hal/keypad.h>
+#include <hal/power.h>
+#include <hal/store.h>
+#include <math/benchmark.h>
+#include <math/bignum.h>
+#include <math/expr.h>
+#include <math/matrix.h>
+#include <math/memo.h>
+#include <math/parser.h>
+#include <math/solve.h>
+#include <math/vm.h>
+#include <pico/stdio.h>
+#include <pico/time.h>
+#include <string.h>
+#include <util/arena.h>
+#include <util/log.h>
+#include <util/trace.h>
+
+#ifndef APP_LOG_LEVEL
+#   define APP_LOG_LEVEL LOG_LEVEL
+#endif
+
+#define APP_LOG(...) LOG_AT(APP_LOG_LEVEL, LOG_LEVEL_INFO, "app", __VA_ARGS__)
+
+#define APP_MAX_LINE 128
+
+/**
+ * The longest core 0 sleeps between two checks for a key (the USB interrupts wake it up
+ * sooner), the logs are printed at each check
+ */
+#define APP_IDLE_POLL_US 10000
+
+/**
+ * How often the result of a solve is printed while core 1 refines it
+ */
+#define APP_SOLVE_REPORT_US (250 * 1000)
+
+/**
+ * The keys of the keypad that edit the line, the others type their text (below), shift and
+ * enter dumps the trace tables, and shift and delete clears the line
+ */
+#define APP_KEY_SHIFT   KEYPAD_KEY(0, 0)
+#define APP_KEY_DELETE  KEYPAD_KEY(0, 5)
+#define APP_KEY_ENTER   KEYPAD_KEY(5, 5)
+
+internal const char *const app_keys[KEYPAD_KEYS] = {
+    [KEYPAD_KEY(0, 1)] = "sin(",    [KEYPAD_KEY(0, 2)] = "cos(",    [KEYPAD_KEY(0, 3)] = "tan(",
+    [KEYPAD_KEY(0, 4)] = "sqrt(",
+
+    [KEYPAD_KEY(1, 0)] = "ln(",     [KEYPAD_KEY(1, 1)] = "exp(",    [KEYPAD_KEY(1, 2)] = "log(",
+    [KEYPAD_KEY(1, 3)] = "abs(",    [KEYPAD_KEY(1, 4)] = "pi",      [KEYPAD_KEY(1, 5)] = "^",
+
+    [KEYPAD_KEY(2, 0)] = "7",       [KEYPAD_KEY(2, 1)] = "8",       [KEYPAD_KEY(2, 2)] = "9",
+    [KEYPAD_KEY(2, 3)] = "/",       [KEYPAD_KEY(2, 4)] = "x",       [KEYPAD_KEY(2, 5)] = "floor(",
+
+    [KEYPAD_KEY(3, 0)] = "4",       [KEYPAD_KEY(3, 1)] = "5",       [KEYPAD_KEY(3, 2)] = "6",
+    [KEYPAD_KEY(3, 3)] = "*",       [KEYPAD_KEY(3, 4)] = "e",       [KEYPAD_KEY(3, 5)] = "round(",
+
+    [KEYPAD_KEY(4, 0)] = "1",       [KEYPAD_KEY(4, 1)] = "2",       [KEYPAD_KEY(4, 2)] = "3",
+    [KEYPAD_KEY(4, 3)] = "-",       [KEYPAD_KEY(4, 4)] = "cbrt(",   [KEYPAD_KEY(4, 5)] = "atan(",
+
+    [KEYPAD_KEY(5, 0)] = "0",       [KEYPAD_KEY(5, 1)] = ".",       [KEYPAD_KEY(5, 2)] = "(",
+    [KEYPAD_KEY(5, 3)] = ")",       [KEYPAD_KEY(5, 4)] = "+"
+};
+
+/**
+ * The scratch memory of an evaluation, it's reset after each one
+ */
+#define APP_ARENA_SIZE (4 * 1024)
+
+internal byte __attribute__((aligned(ARENA_ALIGNMENT))) app_arena_buffer[APP_ARENA_SIZE];
+
+internal arena_t app_arena;
+internal history_t app_history;
+
+/**
+ * The results of the subexpressions of the last lines, so editing the end of a line doesn't
+ * compute its start again
+ */
+internal memo_t app_memo;
+
+/**
+ * The values of the variables, they can't be assigned yet so they stay zero
+ */
+internal double app_variables[EXPR_VARIABLE_COUNT];
+internal rational_t app_exact_variables[EXPR_VARIABLE_COUNT];
+
+/**
+ * The graph, and the expression it shows (it outlives the evaluation arena)
+ */
+internal plot_t app_plot;
+internal expr_t app_plot_expr;
+internal uint32_t app_plot_id = 0;
+
+/**
+ * The integral or root being refined, its intervals are too big for the stack
+ */
+internal solve_t app_solve_state;
+
+/**
+ * Log the memory use when it reaches a new high, so the sizes above can be tuned
+ */
+internal void app_report_memory(void) {
+    static size_t arena_high_water = 0;
+    static uint16_t history_high_water = 0;
+
+    if (app_arena.high_water > arena_high_water) {
+        arena_high_water = app_arena.high_water;
+        arena_report(&app_arena);
+    }
+
+    if (app_history.entries.high_water > history_high_water) {
+        history_high_water = app_history.entries.high_water;
+        pool_report(&app_history.entries);
+    }
+}
+
+internal const char *app_error_name(error_t error) {
+    switch (-error) {
+    case ESYNTAX:         return "syntax error";
+    case ETOOCOMPLEX:     return "expression too complex";
+    case EUNKNOWNNAME:    return "unknown name";
+    case EDOMAIN:         return "not a number";
+    case ENUMBERRANGE:    return "number too large";
+    case EOUTOFMEMORY:    return "out of memory";
+    case ESOLVEBRACKET:   return "no sign change in the interval";
+    case EMATRIXSHAPE:    return "the sizes don't match";
+    case EMATRIXSINGULAR: return "the matrix has no inverse";
+    default:              return "error";
+    }
+}
+
+/**
+ * Parse a decimal integer, with an optional sign
+ */
+internal bool app_parse_integer(const char *text, size_t length, int32_t *value) {
+    bool negative = length > 0 && text[0] == '-';
+    int32_t result = 0;
+
+    if (length == (size_t) negative) {
+        return false;
+    }
+
+    for (size_t index = negative; index < length; index++) {
+        if (text[index] < '0' || text[index] > '9' || result > 100000) {
+            return false;
+        }
+
+        result = result * 10 + (text[index] - '0');
+    }
+
+    *value = negative ? -result : result;
+
+    return true;
+}
+
+/**
+ * Print n! exactly, it's computed in the evaluation arena
+ */
+internal void app_factorial(const char *text, size_t length) {
+    int32_t n;
+
+    if (!app_parse_integer(text, length, &n) || n < 0) {
+        APP_LOG("%s", app_error_name(-ESYNTAX));
+
+        return;
+    }
+
+    arena_reset(&app_arena);
+
+    bignum_t value;
+    bignum_digits_t digits;
+    error_t error = bignum_factorial(&app_arena, n, &value);
+
+    if (error == 0x00) {
+        error = bignum_digits_init(&app_arena, &value, &digits);
+    }
+
+    char *result = NULL;
+    size_t start = 0;
+
+    if (error == 0x00) {
+        // A limb is less than 10 decimal digits, and the chunks come least significant first:
+        // they're placed right to left, from the end of the text. The terminal prints left to
+        // right, so nothing can be shown before the last chunk (the most significant) is made
+        size_t size = (size_t) value.length * 10 + 2;
+
+        result = arena_new(&app_arena, char, size);
+        start = size - 1;
+
+        if (result == NULL) {
+            error = -EOUTOFMEMORY;
+        }
+    }
+
+    if (error == 0x00) {
+        char chunk[BIGNUM_DIGITS_CHUNK];
+        size_t count;
+
+        result[start] = '\0';
+
+        while ((count = bignum_digits_next(&digits, chunk)) != 0) {
+            start -= count;
+            memcpy(&result[start], chunk, count);
+        }
+    }
+
+    if (error != 0x00) {
+        APP_LOG("%s", app_error_name(error));
+    } else {
+        printf("= %s\n", &result[start]);
+    }
+
+    app_report_memory();
+}
+
+/**
+ * Graph an expression of `x` on the display, the first graph is centered on the origin and
+ * the next ones keep the view
+ */
+internal void app_plot_show(const char *text, size_t length) {
+    arena_reset(&app_arena);
+
+    // Compiled aside: a failed compile leaves a partial program, and the plot keeps drawing
+    // the one it has
+    expr_t *expr = arena_new(&app_arena, expr_t, 1);
+    size_t position = 0;
+    error_t error = expr == NULL ? -EOUTOFMEMORY : expr_compile(text, length, expr, &position);
+
+    if (error != 0x00) {
+        APP_LOG("%s at column %u", app_error_name(error), (unsigned) position + 1);
+
+        return;
+    }
+
+    app_plot_expr = *expr;
+
+    bool first = app_plot_id == 0;
+
+    if (first) {
+        error = plot_init(&app_plot, PLOT_LANDSCAPE, COLOR_BLACK, COLOR_RGB(0x60, 0x60, 0x60), COLOR_GREEN);
+    }
+
+    // Every compiled expression gets its own id, so the cache never mixes two of them. The
+    // first one has no view yet, so it's only drawn by `plot_set_view`
+    if (error == 0x00) {
+        error = plot_set_expression(&app_plot, &app_plot_expr, ++app_plot_id);
+    }
+
+    if (error == 0x00 && first) {
+        error = plot_set_view(
+            /*     plot: */ &app_plot,
+            /*    first: */ -app_plot.width / 2,
+            /*  x_scale: */ FIXED_ONE / 32,
+            /* y_center: */ 0,
+            /*  y_scale: */ FIXED_ONE / 32
+        );
+    }
+
+    if (error != 0x00) {
+        APP_LOG("can't plot: error %d", error);
+    }
+}
+
+/**
+ * Evaluate a part of a command, the ends of the interval of a solve and the elements of a
+ * matrix are expressions too (e.g. `pi/2`)
+ */
+internal error_t app_evaluate(const char *text, size_t length, double *value) {
+    expr_t *expr = arena_new(&app_arena, expr_t, 1);
+    size_t position = 0;
+
+    if (expr == NULL) {
+        return -EOUTOFMEMORY;
+    }
+
+    error_t error = expr_compile(text, length, expr, &position);
+
+    return error != 0x00 ? error : expr_evaluate(expr, app_variables, value);
+}
+
+/**
+ * Wait for the step that core 1 is running, a key or a character cancels the solve
+ */
+internal void app_solve_wait(solve_t *solve) {
+    while (!sem_acquire_timeout_us(&solve->stepped, APP_IDLE_POLL_US)) {
+        keypad_event_t event;
+        bool pressed = false;
+
+        while (keypad_pop(&event)) {
+            pressed |= event.pressed;
+        }
+
+        if (pressed || getchar_timeout_us(0) != PICO_ERROR_TIMEOUT) {
+            power_activity();
+            solve_cancel(solve);
+        }
+
+        log_drain(LOG_QUEUE_SIZE);
+    }
+}
+
+/**
+ * Integrate an expression of `x`, or find one of its roots, over the interval of a
+ * `f(x), from, to` line (from `start`, after the command): the coarse result is printed at
+ * once, and core 1 refines it
+ */
+internal void app_solve(solve_kind_t kind, const char *line, size_t length, size_t start) {
+    const char *text = line + start;
+
+    length -= start;
+
+    // The expressions have no commas, the last two split the ends off
+    size_t commas[2];
+    int found = 0;
+
+    for (size_t index = length; index > 0 && found < 2; index--) {
+        if (text[index - 1] == ',') {
+            commas[found++] = index - 1;
+        }
+    }
+
+    if (found < 2) {
+        APP_LOG("%s", app_error_name(-ESYNTAX));
+
+        return;
+    }
+
+    arena_reset(&app_arena);
+
+    expr_t *expr = arena_new(&app_arena, expr_t, 1);
+    solve_t *solve = &app_solve_state;
+    size_t position = 0;
+    double from, to;
+    error_t error = expr == NULL ? -EOUTOFMEMORY : expr_compile(text, commas[1], expr, &position);
+
+    if (error != 0x00) {
+        APP_LOG("%s at column %u", app_error_name(error), (unsigned) position + 1);
+
+        return;
+    }
+
+    if (
+        (error = app_evaluate(text + commas[1] + 1, commas[0] - commas[1] - 1, &from)) != 0x00 ||
+        (error = app_evaluate(text + commas[0] + 1, length - commas[0] - 1, &to)) != 0x00
+    ) {
+        APP_LOG("interval: %s", app_error_name(error));
+
+        return;
+    }
+
+    if (kind == SOLVE_INTEGRATE) {
+        error = solve_integrate(solve, expr, app_variables, EXPR_VARIABLE('x'), from, to);
+    } else {
+        error = solve_root(solve, expr, app_variables, EXPR_VARIABLE('x'), from, to);
+    }
+
+    if (error != 0x00) {
+        APP_LOG("%s", app_error_name(error));
+
+        return;
+    }
+
+    printf("~ %.12g\n", solve->result);
+    fflush(stdout);
+
+    uint64_t reported = time_us_64();
+
+    while (!solve->done) {
+        solve_step_async(solve);
+        app_solve_wait(solve);
+
+        if (!solve->done && time_us_64() - reported >= APP_SOLVE_REPORT_US) {
+            printf("~ %.12g\n", solve->result);
+            fflush(stdout);
+
+            reported = time_us_64();
+        }
+    }
+
+    if (solve->status == -ESOLVECANCELLED) {
+        printf("~ %.12g\n", solve->result);
+        APP_LOG("cancelled");
+    } else if (solve->status != 0x00) {
+        APP_LOG("%s", app_error_name(solve->status));
+    } else {
+        history_save(history_push(&app_history, line, start + length, solve->result));
+
+        printf("= %.12g\n", solve->result);
+    }
+
+    APP_LOG(
+        "error %.2g after %lu evaluations and %u iterations%s",
+        solve->error,
+        (unsigned long) solve->evaluations,
+        (unsigned) solve->iterations,
+        solve->converged ? "" : ", not converged"
+    );
+}
+
+/**
+ * Evaluate a `a, b; c, d` matrix of doubles into the arena, the rows are split by the
+ * semicolons and their elements by the commas
+ */
+internal error_t app_matrix_parse(const char *text, size_t length, matrix_t *matrix) {
+    size_t rows = 1, columns = 0, column = 1;
+
+    for (size_t index = 0; index <= length; index++) {
+        if (index < length && text[index] == ',') {
+            column++;
+        } else if (index == length || text[index] == ';') {
+            if (columns != 0 && column != columns) {
+                return -EMATRIXSHAPE;
+            }
+
+            columns = column;
+            column = 1;
+            rows += index < length;
+        }
+    }
+
+    if (rows > MATRIX_MAX_SIZE || columns > MATRIX_MAX_SIZE) {
+        return -ETOOCOMPLEX;
+    }
+
+    error_t error = matrix_new(&app_arena, MATRIX_ELEMENT_DOUBLE, rows, columns, matrix);
+    size_t start = 0;
+    uint8_t row = 0;
+
+    column = 0;
+
+    for (size_t index = 0; index <= length && error == 0x00; index++) {
+        if (index < length && text[index] != ',' && text[index] != ';') {
+            continue;
+        }
+
+        // The expressions of the elements are only needed until they're evaluated
+        arena_mark_t mark = arena_mark(&app_arena);
+
+        error = app_evaluate(text + start, index - start, &MATRIX_AT(matrix, values, row, column));
+        arena_rewind(&app_arena, mark);
+
+        if (index < length && text[index] == ';') {
+            row++;
+            column = 0;
+        } else {
+            column++;
+        }
+
+        start = index + 1;
+    }
+
+    return error;
+}
+
+/**
+ * The determinant or the inverse of the matrix of a line (from `start`, after the command),
+ * the inverse is printed in the syntax of the matrices
+ */
+internal void app_matrix(const char *line, size_t length, size_t start, bool inverse) {
+    matrix_t matrix;
+
+    arena_reset(&app_arena);
+
+    error_t error = app_matrix_parse(line + start, length - start, &matrix);
+
+    if (error == 0x00 && !inverse) {
+        double determinant;
+
+        if ((error = matrix_determinant(&app_arena, &matrix, &determinant)) == 0x00) {
+            history_save(history_push(&app_history, line, length, determinant));
+
+            printf("= %.12g\n", determinant);
+        }
+    } else if (error == 0x00) {
+        if ((error = matrix_inverse(&app_arena, &matrix, &matrix)) == 0x00) {
+            printf("=");
+
+            for (uint8_t row = 0; row < matrix.rows; row++) {
+                for (uint8_t column = 0; column < matrix.columns; column++) {
+                    printf("%s %.12g", row > 0 && column == 0 ? ";" : column > 0 ? "," : "", MATRIX_AT(&matrix, values, row, column));
+                }
+            }
+
+            printf("\n");
+        }
+    }
+
+    if (error != 0x00) {
+        APP_LOG("%s", app_error_name(error));
+    }
+
+    app_report_memory();
+}
+
+/**
+ * Run a `:command` line
+ */
+internal void app_command(const char *line, size_t length) {
+    static const char *const precisions[KERNEL_PRECISION_COUNT] = {
+        [KERNEL_PRECISION_LOW]      = ":precision low",
+        [KERNEL_PRECISION_MEDIUM]   = ":precision medium",
+        [KERNEL_PRECISION_HIGH]     = ":precision high",
+        [KERNEL_PRECISION_EXACT]    = ":precision exact"
+    };
+
+    if (length == strlen(":bench") && memcmp(line, ":bench", length) == 0) {
+        kernel_benchmark();
+
+        return;
+    }
+
+    // Shift and enter on the keypad dumps them too
+    if (length == strlen(":trace") && memcmp(line, ":trace", length) == 0) {
+        trace_dump();
+
+        return;
+    }
+
+    if (length == strlen(":trace reset") && memcmp(line, ":trace reset", length) == 0) {
+        trace_reset();
+        APP_LOG("trace counters and spans reset");
+
+        return;
+    }
+
+    if (length == strlen(":memo") && memcmp(line, ":memo", length) == 0) {
+        memo_report(&app_memo);
+
+        return;
+    }
+
+    if (length > strlen(":plot ") && memcmp(line, ":plot ", strlen(":plot ")) == 0) {
+        app_plot_show(line + strlen(":plot "), length - strlen(":plot "));
+
+        return;
+    }
+
+    int32_t columns;
+
+    if (length > strlen(":pan ") && memcmp(line, ":pan ", strlen(":pan ")) == 0 && app_parse_integer(line + strlen(":pan "), length - strlen(":pan "), &columns)) {
+        if (app_plot_id == 0) {
+            APP_LOG("nothing is plotted");
+        } else if (plot_pan(&app_plot, columns) != 0x00) {
+            APP_LOG("can't pan the plot");
+        }
+
+        return;
+    }
+
+    if (length > strlen(":factorial ") && memcmp(line, ":factorial ", strlen(":factorial ")) == 0) {
+        app_factorial(line + strlen(":factorial "), length - strlen(":factorial "));
+
+        return;
+    }
+
+    if (length > strlen(":integrate ") && memcmp(line, ":integrate ", strlen(":integrate ")) == 0) {
+        app_solve(SOLVE_INTEGRATE, line, length, strlen(":integrate "));
+
+        return;
+    }
+
+    if (length > strlen(":solve ") && memcmp(line, ":solve ", strlen(":solve ")) == 0) {
+        app_solve(SOLVE_ROOT, line, length, strlen(":solve "));
+
+        return;
+    }
+
+    if (length > strlen(":det ") && memcmp(line, ":det ", strlen(":det ")) == 0) {
+        app_matrix(line, length, strlen(":det "), false);
+
+        return;
+    }
+
+    if (length > strlen(":inverse ") && memcmp(line, ":inverse ", strlen(":inverse ")) == 0) {
+        app_matrix(line, length, strlen(":inverse "), true);
+
+        return;
+    }
+
+    for (int precision = 0; precision < KERNEL_PRECISION_COUNT; precision++) {
+        if (length == strlen(precisions[precision]) && memcmp(line, precisions[precision], length) == 0) {
+            expr_set_precision(precision);
+            memo_clear(&app_memo);
+            APP_LOG("functions are now computed with %s", precisions[precision] + strlen(":precision "));
+
+            return;
+        }
+    }
+
+    APP_LOG("commands: :bench, :det <a, b; c, d>, :factorial <n>, :integrate <f(x)>, <from>, <to>, :inverse <a, b; c, d>, :memo, :plot <f(x)>, :pan <columns>, :precision low|medium|high|exact, :solve <f(x)>, <from>, <to>, :trace [reset]");
+}
+
+internal void app_line_insert(char *line, size_t size, size_t *length, char c) {
+    if (c >= ' ' && c <= '~' && *length < size) {
+        line[(*length)++] = c;
+        putchar(c);
+    }
+}
+
+internal void app_line_erase(size_t *length) {
+    if (*length > 0) {
+        (*length)--;
+        printf("\b \b");
+    }
+}
+
+/**
+ * Apply a key of the keypad to the line
+ *
+ * RETURN VALUE
+ * - true if the line was entered
+ */
+internal bool app_line_key(char *line, size_t size, size_t *length, const keypad_event_t *event) {
+    if (!event->pressed || event->key == APP_KEY_SHIFT) {
+        return false;
+    }
+
+    bool shift = keypad_is_pressed(APP_KEY_SHIFT);
+
+    if (event->key == APP_KEY_ENTER && shift) {
+        printf("\n");
+        trace_dump();
+
+        // The line is still being typed
+        printf("> %.*s", (int) *length, line);
+
+        return false;
+    }
+
+    if (event->key == APP_KEY_ENTER) {
+        return true;
+    }
+
+    if (event->key == APP_KEY_DELETE) {
+        do {
+            app_line_erase(length);
+        } while (shift && *length > 0);
+
+        return false;
+    }
+
+    for (const char *text = app_keys[event->key]; text != NULL && *text != '\0'; text++) {
+        app_line_insert(line, size, length, *text);
+    }
+
+    return false;
+}
+
+/**
+ * Read a line from the keypad or the USB serial, echoing it back
+ */
+internal size_t app_read_line(char *line, size_t size) {
+    size_t length = 0;
+
+    for (;;) {
+        keypad_event_t event;
+        bool entered = false;
+        int c = PICO_ERROR_TIMEOUT;
+
+        if (keypad_pop(&event)) {
+            power_activity();
+
+            entered = app_line_key(line, size, &length, &event);
+        } else if ((c = getchar_timeout_us(0)) != PICO_ERROR_TIMEOUT) {
+            power_activity();
+
+            if (c == '\r' || c == '\n') {
+                entered = true;
+            } else if (c == '\b' || c == 0x7F) {
+                app_line_erase(&length);
+            } else {
+                app_line_insert(line, size, &length, c);
+            }
+        } else {
+            // Waiting for a key is when the logs of both cores are printed
+            log_drain(LOG_QUEUE_SIZE);
+
+            // The results of the last lines are written to the flash once typing stops
+            store_poll();
+
+            // The keypad's interrupts wake the core up too
+            power_wait(APP_IDLE_POLL_US);
+
+            continue;
+        }
+
+        if (entered) {
+            printf("\n");
+
+            return length;
+        }
+
+        fflush(stdout);
+    }
+}
+
+void app_init()
+{
+    for (int index = 0; index < EXPR_VARIABLE_COUNT; index++) {
+        app_variables[index] = 0.0;
+        app_exact_variables[index] = rational_from_integer(0);
+    }
+
+    arena_init(&app_arena, app_arena_buffer, sizeof(app_arena_buffer), "evaluation");
+    history_init(&app_history);
+    history_restore(&app_history);
+    memo_init(&app_memo);
+}
 
 bool app_main()
 {
-    // TODO: do something
+    // Expressions are typed on the keypad, or in the serial terminal
+    static char line[APP_MAX_LINE];
+
+    APP_LOG("type an expression to evaluate it");
+
+    for (;;) {
+        // Everything logged by the last line shows up before the next prompt
+        log_flush();
+
+        printf("> ");
+        fflush(stdout);
+
+        size_t length = app_read_line(line, sizeof(line));
+
+        if (length == 0) {
+            continue;
+        }
+
+        if (line[0] == ':') {
+            app_command(line, length);
+
+            continue;
+        }
+
+        // Everything the evaluation needs comes from the arena, and is freed at once here
+        arena_reset(&app_arena);
+
+        expr_t *expr = arena_new(&app_arena, expr_t, 1);
+        size_t position = 0;
+        double result;
+        rational_t exact;
+
+        TRACE_BEGIN(TRACE_SPAN_EVALUATE);
+
+        // The variables can't be assigned yet, so they need no versions for the memo
+        error_t error = expr == NULL ? -EOUTOFMEMORY : expr_compile(line, length, expr, &position);
+
+        if (error != 0x00) {
+            APP_LOG("%s at column %u", app_error_name(error), (unsigned) position + 1);
+        } else if (expr->tier == EXPR_TIER_RATIONAL && expr_evaluate_rational(expr, app_exact_variables, &exact) == 0x00) {
+            // Exact results are shown as fractions, and need no soft-float at all
+            history_save(history_push(&app_history, line, length, rational_to_double(exact)));
+
+            if (rational_is_integer(exact)) {
+                printf("= %lld\n", (long long) exact.numerator);
+            } else {
+                printf("= %lld/%lld\n", (long long) exact.numerator, (long long) exact.denominator);
+            }
+        } else if ((error = expr_evaluate_memo(expr, app_variables, NULL, &app_memo, &result)) != 0x00) {
+            APP_LOG("%s", app_error_name(error));
+        } else {
+            history_save(history_push(&app_history, line, length, result));
+
+            printf("= %.12g\n", result);
+        }
+
+        TRACE_END(TRACE_SPAN_EVALUATE);
 
-    for (;;)
-        tight_loop_contents();
+        app_report_memory();
+    }
 }
@@ -4,6 +4,18 @@
 #include <util/util.h>
 #include <stdbool.h>
 
+/**
+ * Set up the state of the application, it doesn't need the display: it runs while the
+ * display is still starting
+ */
+external void app_init(void);
+
+/**
+ * Run the application, after `app_init`
+ *
+ * RETURN VALUE
+ * - true if the application asked to restart (`app_init` is called again before it)
+ */
 external bool app_main(void);
 
 #endif /** APP_ENTRY_H */
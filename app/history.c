@@ -0,0 +1,101 @@
+#include "history.h"
+#include <hal/store.h>
+#include <pico.h>
+#include <string.h>
+
+/**
+ * An entry in the store, the text only takes its length
+ */
+typedef struct history_record_t
+{
+    uint32_t    serial;
+    double      result;
+    char        text[HISTORY_MAX_TEXT];
+} history_record_t;
+
+#define HISTORY_RECORD_HEADER (offsetof(history_record_t, text))
+
+void history_init(history_t *history) {
+    pool_init(&history->entries, history->storage, sizeof(history_entry_t), HISTORY_SIZE, "history");
+
+    history->oldest = NULL;
+    history->newest = NULL;
+    history->pushed = 0;
+}
+
+history_entry_t *history_push(history_t *history, const char *text, size_t length, double result) {
+    history_entry_t *entry = pool_alloc(&history->entries);
+
+    if (entry == NULL) {
+        // Full, reuse the oldest entry
+        entry = history->oldest;
+        history->oldest = entry->next;
+    }
+
+    entry->next = NULL;
+    entry->result = result;
+    entry->serial = history->pushed++;
+    entry->length = MIN(length, HISTORY_MAX_TEXT);
+
+    memcpy(entry->text, text, entry->length);
+
+    if (history->newest != NULL && history->newest != entry) {
+        history->newest->next = entry;
+    }
+
+    history->newest = entry;
+
+    if (history->oldest == NULL) {
+        history->oldest = entry;
+    }
+
+    return entry;
+}
+
+void history_save(const history_entry_t *entry) {
+    history_record_t record;
+
+    record.serial = entry->serial;
+    record.result = entry->result;
+
+    memcpy(record.text, entry->text, entry->length);
+
+    store_put(HISTORY_STORE_KEY + entry->serial % HISTORY_SIZE, &record, HISTORY_RECORD_HEADER + entry->length);
+}
+
+void history_restore(history_t *history) {
+    // The records read straight from the flash, in the order of their serials
+    const history_record_t *records[HISTORY_SIZE];
+    uint8_t sizes[HISTORY_SIZE];
+    size_t count = 0;
+
+    for (uint16_t slot = 0; slot < HISTORY_SIZE; slot++) {
+        uint8_t size;
+        const history_record_t *record = store_get(HISTORY_STORE_KEY + slot, &size);
+
+        if (record == NULL || size < HISTORY_RECORD_HEADER) {
+            continue;
+        }
+
+        size_t position = count++;
+
+        while (position > 0 && records[position - 1]->serial > record->serial) {
+            records[position] = records[position - 1];
+            sizes[position] = sizes[position - 1];
+            position--;
+        }
+
+        records[position] = record;
+        sizes[position] = size;
+    }
+
+    for (size_t index = 0; index < count; index++) {
+        double result;
+
+        // The records are only aligned to 4 bytes
+        memcpy(&result, &records[index]->result, sizeof(result));
+
+        history->pushed = records[index]->serial;
+        history_push(history, records[index]->text, sizes[index] - HISTORY_RECORD_HEADER, result);
+    }
+}
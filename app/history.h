@@ -0,0 +1,82 @@
+#ifndef APP_HISTORY_H
+#define APP_HISTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <util/pool.h>
+#include <util/util.h>
+
+/**
+ * How many results are remembered, when it's full the oldest one is forgotten
+ */
+#define HISTORY_SIZE        32
+
+/**
+ * The longest expression kept in an entry, longer ones are cut
+ */
+#define HISTORY_MAX_TEXT    64
+
+/**
+ * The keys of the entries in the store (see hal/store.h), one for each slot of the history:
+ * the entry with the serial `n` is saved in `HISTORY_STORE_KEY + n % HISTORY_SIZE`
+ */
+#define HISTORY_STORE_KEY   0x0100
+
+/**
+ * A result of the calculator
+ */
+typedef struct history_entry_t
+{
+    /** The next (newer) entry */
+    struct history_entry_t  *next;
+
+    double                  result;
+
+    /** How many results were pushed before this one */
+    uint32_t                serial;
+
+    uint8_t                 length;
+    char                    text[HISTORY_MAX_TEXT];
+} history_entry_t;
+
+/**
+ * The results, oldest first, the entries come from a pool so nothing is allocated
+ */
+typedef struct history_t
+{
+    pool_t                  entries;
+
+    history_entry_t         *oldest;
+    history_entry_t         *newest;
+
+    /** The serial of the next entry */
+    uint32_t                pushed;
+
+    history_entry_t         storage[HISTORY_SIZE];
+} history_t;
+
+/**
+ * Initialize an empty history
+ */
+external void history_init(history_t *history);
+
+/**
+ * Add a result to the history, forgetting the oldest one if it's full
+ *
+ * RETURN VALUE
+ * - the new entry
+ */
+external history_entry_t *history_push(history_t *history, const char *text, size_t length, double result);
+
+/**
+ * Write an entry to the store, replacing the entry of the same slot (the one that was
+ * forgotten for it)
+ */
+external void history_save(const history_entry_t *entry);
+
+/**
+ * Push the entries of the store to an empty history, oldest first
+ */
+external void history_restore(history_t *history);
+
+#endif /** APP_HISTORY_H */
@@ -0,0 +1,390 @@
+#include "plot.h"
+#include <hal/display.h>
+#include <math/vm.h>
+#include <pico.h>
+#include <string.h>
+#include <util/log.h>
+#include <util/trace.h>
+
+#ifndef PLOT_LOG_LEVEL
+#   define PLOT_LOG_LEVEL LOG_LEVEL
+#endif
+
+#define PLOT_DEBUG(...) LOG_AT(PLOT_LOG_LEVEL, LOG_LEVEL_DEBUG, "plot", __VA_ARGS__)
+
+/**
+ * Landscape is the panel turned by 270 degrees: rows and columns are exchanged so the
+ * columns of the graph go up the gate lines (which is what the vertical scroll moves), and
+ * the rows are mirrored so it's a rotation and not a transpose
+ */
+internal const st7789v_memory_access_control_t plot_landscape = {
+    .row_column_exchange    = true,
+    .row_address_decrement  = true
+};
+
+internal const st7789v_memory_access_control_t plot_portrait = { .raw_value = 0x00 };
+
+internal force_inline uint16_t plot_slot(int32_t column, uint16_t size) {
+    int32_t slot = column % size;
+
+    return slot < 0 ? slot + size : slot;
+}
+
+internal force_inline fixed_t plot_sample(const plot_t *plot, int32_t column) {
+    return plot->cache.samples[plot_slot(column, PLOT_CACHE_SIZE)];
+}
+
+/**
+ * The row of a sample, it can be outside of the graph
+ */
+internal int32_t plot_row(const plot_t *plot, fixed_t sample) {
+    // Anything further than a graph away is drawn at the same place, and can't overflow
+    int64_t limit = (int64_t) plot->height * plot->y_scale;
+    int64_t distance = MAX(MIN((int64_t) sample - plot->y_center, limit), -limit);
+    int64_t offset = (distance * plot->rows_per_unit) >> (2 * FIXED_FRACTION_BITS);
+
+    return plot->height / 2 - (int32_t) offset;
+}
+
+/******************** EVALUATION *************************/
+
+internal fixed_t plot_evaluate(plot_t *plot, int32_t column) {
+    int64_t x = (int64_t) column * plot->x_scale;
+
+    if (x > FIXED_MAX || x < FIXED_MIN) {
+        return PLOT_UNDEFINED;
+    }
+
+    if (plot->fixed) {
+        fixed_t result;
+
+        plot->fixed_variables[EXPR_VARIABLE('x')] = (fixed_t) x;
+
+        // Only falls back to `double` when a sample overflows, which is off the graph anyway
+        if (expr_evaluate_fixed(plot->expr, plot->fixed_variables, &result) == 0x00) {
+            return result == PLOT_UNDEFINED ? result + 1 : result;
+        }
+    }
+
+    double result;
+
+    plot->variables[EXPR_VARIABLE('x')] = fixed_to_double((fixed_t) x);
+
+    if (expr_evaluate(plot->expr, plot->variables, &result) != 0x00) {
+        return PLOT_UNDEFINED;
+    }
+
+    // Clamped samples are drawn off the graph, like they should
+    if (result >= (double) FIXED_MAX / FIXED_ONE) return FIXED_MAX;
+    if (result <= (double) (FIXED_MIN + 1) / FIXED_ONE) return FIXED_MIN + 1;
+
+    return fixed_from_double(result);
+}
+
+/**
+ * Make the cache cover the viewport and its two neighbour columns, only the columns that
+ * aren't cached yet are evaluated
+ */
+internal void plot_fill_cache(plot_t *plot) {
+    plot_cache_t *cache = &plot->cache;
+
+    if (cache->expression_id != plot->expression_id || cache->x_scale != plot->x_scale) {
+        cache->expression_id = plot->expression_id;
+        cache->x_scale = plot->x_scale;
+        cache->count = 0;
+    }
+
+    int32_t from = plot->first - 1;
+    uint16_t count = plot->width + 2;
+    uint16_t evaluated = 0;
+
+    for (int32_t column = from; column < from + count; column++) {
+        if (column >= cache->from && column < cache->from + cache->count) {
+            continue;
+        }
+
+        cache->samples[plot_slot(column, PLOT_CACHE_SIZE)] = plot_evaluate(plot, column);
+        evaluated++;
+    }
+
+    cache->from = from;
+    cache->count = count;
+
+    PLOT_DEBUG("evaluated %u columns", (unsigned) evaluated);
+}
+
+/******************** DISPLAY CORE *************************/
+
+/**
+ * Draw world column `column` into a column buffer, top to bottom
+ */
+internal void plot_draw_column(const plot_t *plot, int32_t column, color_t *pixels) {
+    color_t fill = column == 0 ? plot->axis : plot->background;
+
+    for (uint16_t row = 0; row < plot->height; row++) {
+        pixels[row] = fill;
+    }
+
+    int32_t axis = plot_row(plot, 0);
+
+    if (axis >= 0 && axis < plot->height) {
+        pixels[axis] = plot->axis;
+    }
+
+    fixed_t sample = plot_sample(plot, column);
+
+    if (sample == PLOT_UNDEFINED) {
+        return;
+    }
+
+    // Join the sample halfway to each of its neighbours, so the curve has no gaps
+    int32_t row = plot_row(plot, sample);
+    int32_t top = row;
+    int32_t bottom = row;
+
+    for (int32_t neighbour = column - 1; neighbour <= column + 1; neighbour += 2) {
+        fixed_t other = plot_sample(plot, neighbour);
+
+        if (other != PLOT_UNDEFINED) {
+            int32_t middle = (row + plot_row(plot, other)) / 2;
+
+            top = MIN(top, middle);
+            bottom = MAX(bottom, middle);
+        }
+    }
+
+    top = MAX(top, 0);
+    bottom = MIN(bottom, plot->height - 1);
+
+    for (int32_t y = top; y <= bottom; y++) {
+        pixels[y] = plot->curve;
+    }
+}
+
+internal error_t plot_send_setup(const plot_t *plot) {
+    // The scrolling area can only be set with rows and columns not exchanged
+    error_t error = st7789v_display_set_memory_access_control(plot_portrait);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    error = st7789v_display_set_vertical_scrolling_parameters(
+        /*          top_fixed_area: */ 0,
+        /* vertical_scrolling_area: */ ST7789V_DISPLAY_HEIGHT,
+        /*       bottom_fixed_area: */ 0
+    );
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    if (plot->orientation == PLOT_LANDSCAPE) {
+        error = st7789v_display_set_memory_access_control(plot_landscape);
+    }
+
+    return error;
+}
+
+internal error_t plot_send_columns(plot_t *plot) {
+    for (uint16_t index = 0; index < plot->send_count; index++) {
+        int32_t column = plot->send_from + index;
+
+        // In landscape the display memory is a ring of columns, that the scroll start rotates
+        uint16_t address = plot->orientation == PLOT_LANDSCAPE
+            ? plot_slot(column, plot->width)
+            : column - plot->first;
+
+        color_t *pixels = plot->columns[index % 2];
+
+        sem_acquire_blocking(&plot->column_free[index % 2]);
+
+        plot_draw_column(plot, column, pixels);
+
+        error_t error = st7789v_display_set_column_address_window(address, address);
+
+        if (error == 0x00) {
+            error = st7789v_display_set_row_address_window(0, plot->height - 1);
+        }
+
+        if (error == 0x00) {
+            error = st7789v_display_memory_write_pixels_async(
+                /*            pixels: */ pixels,
+                /*             count: */ plot->height,
+                /* completion_signal: */ &plot->column_free[index % 2],
+                /*  continue_writing: */ false
+            );
+        }
+
+        if (error != 0x00) {
+            // Nothing will release it if the column wasn't queued
+            sem_release(&plot->column_free[index % 2]);
+
+            return error;
+        }
+    }
+
+    if (plot->orientation == PLOT_LANDSCAPE) {
+        return st7789v_display_set_vertical_scrolling_start_address(plot_slot(plot->first, plot->width));
+    }
+
+    return 0x00;
+}
+
+/**
+ * Runs on the display core: send what the plot asked for, and wait it to be on the display
+ */
+internal void plot_send(void *data) {
+    plot_t *plot = data;
+
+    TRACE_BEGIN(TRACE_SPAN_PLOT_SEND);
+
+    plot->send_error = 0x00;
+
+    if (plot->send_setup) {
+        plot->send_error = plot_send_setup(plot);
+        plot->send_setup = false;
+    }
+
+    if (plot->send_error == 0x00) {
+        plot->send_error = plot_send_columns(plot);
+    }
+
+    for (int index = 0; index < 2; index++) {
+        sem_acquire_blocking(&plot->column_free[index]);
+        sem_release(&plot->column_free[index]);
+    }
+
+    TRACE_END(TRACE_SPAN_PLOT_SEND);
+}
+
+internal void plot_restore(void *data) {
+    plot_t *plot = data;
+
+    plot->send_error = st7789v_display_set_vertical_scrolling_start_address(0);
+
+    if (plot->send_error == 0x00) {
+        plot->send_error = st7789v_display_set_memory_access_control(plot_portrait);
+    }
+}
+
+internal error_t plot_submit(plot_t *plot, void (*function)(void *data)) {
+    display_submit(&(display_job_t) {
+        .type               = DISPLAY_JOB_CALL,
+        .call               = { function, plot },
+        .completion_signal  = &plot->sent
+    });
+
+    sem_acquire_blocking(&plot->sent);
+
+    return plot->send_error;
+}
+
+/******************** PLOT *************************/
+
+/**
+ * Evaluate what's missing and send the columns that changed on the display
+ *
+ * PARAMETERS
+ * - previous: the world column that was at the left of the graph
+ * - redraw: if every column needs to be sent (the rows of the samples changed)
+ */
+internal error_t plot_update(plot_t *plot, int32_t previous, bool redraw) {
+    if (plot->expr == NULL || plot->x_scale <= 0) {
+        return 0x00;
+    }
+
+    TRACE_BEGIN(TRACE_SPAN_PLOT_EVALUATE);
+    plot_fill_cache(plot);
+    TRACE_END(TRACE_SPAN_PLOT_EVALUATE);
+
+    int32_t delta = plot->first - previous;
+
+    plot->send_from = plot->first;
+    plot->send_count = plot->width;
+
+    // The columns still on screen were scrolled with the display memory, only send the others
+    if (!redraw && plot->orientation == PLOT_LANDSCAPE && delta > -plot->width && delta < plot->width) {
+        plot->send_from = delta > 0 ? previous + plot->width : plot->first;
+        plot->send_count = delta > 0 ? delta : -delta;
+    }
+
+    return plot_submit(plot, plot_send);
+}
+
+error_t plot_init(
+    plot_t *plot,
+    plot_orientation_t orientation,
+    color_t background,
+    color_t axis,
+    color_t curve
+) {
+    memset(plot->variables, 0, sizeof(plot->variables));
+    memset(plot->fixed_variables, 0, sizeof(plot->fixed_variables));
+
+    plot->orientation = orientation;
+    plot->width = orientation == PLOT_LANDSCAPE ? ST7789V_DISPLAY_HEIGHT : ST7789V_DISPLAY_WIDTH;
+    plot->height = orientation == PLOT_LANDSCAPE ? ST7789V_DISPLAY_WIDTH : ST7789V_DISPLAY_HEIGHT;
+
+    plot->background = background;
+    plot->axis = axis;
+    plot->curve = curve;
+
+    plot->expr = NULL;
+    plot->first = 0;
+    plot->x_scale = 0;
+    plot->y_center = 0;
+    plot->y_scale = FIXED_ONE;
+    plot->rows_per_unit = FIXED_ONE;
+    plot->cache.count = 0;
+
+    plot->send_setup = true;
+    plot->send_count = 0;
+
+    sem_init(&plot->sent, 0, 1);
+
+    for (int index = 0; index < 2; index++) {
+        sem_init(&plot->column_free[index], 1, 1);
+    }
+
+    return plot_submit(plot, plot_send);
+}
+
+error_t plot_set_expression(plot_t *plot, const expr_t *expr, uint32_t expression_id) {
+    plot->expr = expr;
+    plot->expression_id = expression_id;
+    plot->fixed = expr->tier <= EXPR_TIER_FIXED && expr->fixed_constants_fit;
+
+    return plot_update(plot, plot->first, true);
+}
+
+error_t plot_set_view(plot_t *plot, int32_t first, fixed_t x_scale, fixed_t y_center, fixed_t y_scale) {
+    if (x_scale <= 0 || y_scale <= 0) {
+        return -ENOTINRANGE;
+    }
+
+    int32_t previous = plot->first;
+    bool redraw = x_scale != plot->x_scale || y_center != plot->y_center || y_scale != plot->y_scale;
+
+    plot->first = first;
+    plot->x_scale = x_scale;
+    plot->y_center = y_center;
+    plot->y_scale = y_scale;
+
+    // Rows per unit in Q16.16, so a row is a multiplication and not a division
+    plot->rows_per_unit = ((int64_t) FIXED_ONE << FIXED_FRACTION_BITS) / y_scale;
+
+    return plot_update(plot, previous, redraw);
+}
+
+error_t plot_pan(plot_t *plot, int32_t columns) {
+    int32_t previous = plot->first;
+
+    plot->first += columns;
+
+    return plot_update(plot, previous, false);
+}
+
+error_t plot_deinit(plot_t *plot) {
+    return plot_submit(plot, plot_restore);
+}
@@ -0,0 +1,193 @@
+#ifndef APP_PLOT_H
+#define APP_PLOT_H
+
+#include <drivers/st7789v.h>
+#include <hal/color.h>
+#include <math/expr.h>
+#include <math/number.h>
+#include <pico/sem.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+#include <errno.h>
+
+/**
+ * A graph of `y = f(x)` over the whole display, that pans without evaluating the whole
+ * viewport again.
+ *
+ * The samples are cached by world column (`x = column * x_scale`), for one expression and
+ * one x scale, so a pan only evaluates the columns it exposes. In landscape, the columns of
+ * the graph are the panel's gate lines (the memory access control exchanges rows and
+ * columns), so the display's vertical scroll moves the graph sideways: a pan sends the
+ * exposed columns and a new scroll start, nothing else. In portrait, the scroll can't move
+ * columns, so a pan still evaluates only the exposed columns, but sends all of them.
+ *
+ * The plot uses the display's scrolling area, so it can't be used at the same time as a
+ * console. Only use it from core 0, the columns are sent by the display core.
+ */
+
+/**
+ * The most columns a plot can have, the length of the display
+ */
+#define PLOT_MAX_COLUMNS    ST7789V_DISPLAY_HEIGHT
+
+/**
+ * The samples cached, one more column on each side of the viewport: the pixels of a column
+ * depend on its neighbours, so columns kept on screen never have to be sent again
+ */
+#define PLOT_CACHE_SIZE     (PLOT_MAX_COLUMNS + 2)
+
+/**
+ * A sample where the expression isn't defined, or doesn't fit in a `fixed_t`
+ */
+#define PLOT_UNDEFINED      FIXED_MIN
+
+/**
+ * How the graph is laid out on the display
+ */
+typedef enum plot_orientation_t: byte
+{
+    /** `ST7789V_DISPLAY_WIDTH` columns, every pan sends the whole graph */
+    PLOT_PORTRAIT   = 0x00,
+
+    /** `ST7789V_DISPLAY_HEIGHT` columns, pans are scrolled by the display */
+    PLOT_LANDSCAPE  = 0x01
+} plot_orientation_t;
+
+/**
+ * The samples of an expression, for the world columns `[from, from + count)`
+ */
+typedef struct plot_cache_t
+{
+    /** What the samples are for, nothing is reused if any of these change */
+    uint32_t    expression_id;
+    fixed_t     x_scale;
+
+    int32_t     from;
+    uint16_t    count;
+
+    /** The sample of world column `w` is at `w` modulo `PLOT_CACHE_SIZE` */
+    fixed_t     samples[PLOT_CACHE_SIZE];
+} plot_cache_t;
+
+typedef struct plot_t
+{
+    plot_orientation_t  orientation;
+
+    /** The size of the graph, in columns and rows */
+    uint16_t            width;
+    uint16_t            height;
+
+    color_t             background;
+    color_t             axis;
+    color_t             curve;
+
+    const expr_t        *expr;
+    uint32_t            expression_id;
+
+    /** If the expression is evaluated in fixed point, or in `double` */
+    bool                fixed;
+
+    /** The values of the variables, `x` is set for each sample */
+    double              variables[EXPR_VARIABLE_COUNT];
+    fixed_t             fixed_variables[EXPR_VARIABLE_COUNT];
+
+    /** The world column at the left of the graph, and the x units per column */
+    int32_t             first;
+    fixed_t             x_scale;
+
+    /** The y at the middle of the graph, and the y units per row (and its inverse) */
+    fixed_t             y_center;
+    fixed_t             y_scale;
+    int64_t             rows_per_unit;
+
+    plot_cache_t        cache;
+
+    /** What the display core sends next: the setup, then these world columns */
+    bool                send_setup;
+    int32_t             send_from;
+    uint16_t            send_count;
+    error_t             send_error;
+
+    /** Released by the display core when everything was sent */
+    semaphore_t         sent;
+
+    /** The ping-pong column buffers, one is sent while the other is drawn */
+    color_t             columns[2][PLOT_MAX_COLUMNS];
+    semaphore_t         column_free[2];
+} plot_t;
+
+/**
+ * Initialize a plot, and set up the display for it
+ *
+ * PARAMETERS
+ * - plot: the plot to initialize
+ * - orientation: how the graph is laid out
+ * - background, axis, curve: the colors of the graph
+ *
+ * NOTES
+ * - Nothing is drawn yet, set an expression and a view first.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ */
+external error_t plot_init(
+    plot_t *plot,
+    plot_orientation_t orientation,
+    color_t background,
+    color_t axis,
+    color_t curve
+);
+
+/**
+ * Change the expression that is graphed, and draw it if there's a view
+ *
+ * PARAMETERS
+ * - plot: the plot
+ * - expr: the expression, of the variable `x`, needs to be kept alive while it's graphed
+ * - expression_id: identifies the expression in the cache, give a new one every time the
+ *   expression changes (even at the same address)
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ */
+external error_t plot_set_expression(plot_t *plot, const expr_t *expr, uint32_t expression_id);
+
+/**
+ * Move and scale the graph, and draw it
+ *
+ * PARAMETERS
+ * - plot: the plot
+ * - first: the world column at the left of the graph
+ * - x_scale: the x units per column, the cache is kept only if this doesn't change
+ * - y_center: the y at the middle of the graph
+ * - y_scale: the y units per row
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ * - ENOTINRANGE: if a scale isn't positive
+ */
+external error_t plot_set_view(plot_t *plot, int32_t first, fixed_t x_scale, fixed_t y_center, fixed_t y_scale);
+
+/**
+ * Pan the graph sideways, only the exposed columns are evaluated
+ *
+ * PARAMETERS
+ * - plot: the plot
+ * - columns: how many columns to move, positive is to the right (towards bigger x)
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ */
+external error_t plot_pan(plot_t *plot, int32_t columns);
+
+/**
+ * Give the display back: no more scrolling and the default memory access control
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ */
+external error_t plot_deinit(plot_t *plot);
+
+#endif /** APP_PLOT_H */
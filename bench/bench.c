@@ -0,0 +1,429 @@
+#include "bench.h"
+#include <drivers/st7789v.h>
+#include <hal/display.h>
+#include <hal/font.h>
+#include <hal/text.h>
+#include <math/benchmark.h>
+#include <math/matrix.h>
+#include <math/parser.h>
+#include <math/vm.h>
+#include <pico.h>
+#include <pico/sem.h>
+#include <pico/time.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#if !PICO_ON_DEVICE
+#   include <drivers/st7789v_sim.h>
+#endif
+
+/**
+ * How many rows of pixels are sent by each memory write of a full frame
+ */
+#define BENCH_STRIP_ROWS    16
+
+#define BENCH_FRAMES        30
+#define BENCH_SMALL_WRITE   16
+#define BENCH_SMALL_WRITES  2000
+#define BENCH_FILLS         30
+#define BENCH_TEXT_SCREENS  10
+#define BENCH_EVALUATIONS   2000
+#define BENCH_MATRIX_SIZE   10
+#define BENCH_MATRIX_SOLVES 50
+#define BENCH_MATRIX_ARENA  (16 * 1024)
+
+/**
+ * One measurement: `count` of `unit` in `elapsed` microseconds
+ */
+typedef struct bench_result_t
+{
+    const char  *name;
+    const char  *unit;
+
+    uint32_t    count;
+    uint64_t    elapsed;
+
+#if !PICO_ON_DEVICE
+    /** What the simulated display received, and how long its bus would take for it */
+    uint64_t    bus_bytes;
+    uint64_t    bus_us;
+#endif
+} bench_result_t;
+
+typedef enum bench_display_result_t: byte {
+    BENCH_FRAME_ASYNC       = 0,
+    BENCH_FRAME_ASYNC_BYTES,
+    BENCH_SMALL_SYNC,
+    BENCH_SMALL_ASYNC,
+    BENCH_FILL,
+    BENCH_GLYPHS,
+    BENCH_GLYPHS_AA,
+
+    BENCH_DISPLAY_RESULT_COUNT
+} bench_display_result_t;
+
+typedef struct bench_display_t
+{
+    bench_result_t  results[BENCH_DISPLAY_RESULT_COUNT];
+    error_t         error;
+} bench_display_t;
+
+internal byte __attribute__((aligned(4))) bench_strip[ST7789V_DISPLAY_WIDTH * BENCH_STRIP_ROWS * sizeof(uint16_t)];
+
+/**
+ * Start a measurement, the host builds also start counting what the simulated display gets
+ */
+internal uint64_t bench_start(void) {
+#if !PICO_ON_DEVICE
+    st7789v_sim_reset_stats();
+#endif
+
+    return time_us_64();
+}
+
+internal bench_result_t bench_end(const char *name, const char *unit, uint32_t count, uint64_t start) {
+    bench_result_t result = {
+        .name       = name,
+        .unit       = unit,
+        .count      = count,
+        .elapsed    = time_us_64() - start
+    };
+
+#if !PICO_ON_DEVICE
+    st7789v_sim_stats_t stats;
+
+    st7789v_sim_get_stats(&stats);
+
+    result.bus_bytes = stats.bits / 8;
+    result.bus_us = stats.bus_us;
+#endif
+
+    return result;
+}
+
+internal void bench_print(const bench_result_t *result) {
+    // The rate is the only division, after the timing
+    uint64_t per_second = result->elapsed > 0 ? (uint64_t) result->count * 1000000 / result->elapsed : 0;
+
+    printf(
+        "bench %s count=%lu unit=%s us=%llu per_second=%llu",
+        result->name,
+        (unsigned long) result->count,
+        result->unit,
+        (unsigned long long) result->elapsed,
+        (unsigned long long) per_second
+    );
+
+#if !PICO_ON_DEVICE
+    printf(" bus_bytes=%llu bus_us=%llu", (unsigned long long) result->bus_bytes, (unsigned long long) result->bus_us);
+#endif
+
+    printf("\n");
+}
+
+/******************** DISPLAY CORE *************************/
+
+internal error_t bench_full_window(void) {
+    error_t error = st7789v_display_set_column_address_window(0, ST7789V_DISPLAY_WIDTH - 1);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    return st7789v_display_set_row_address_window(0, ST7789V_DISPLAY_HEIGHT - 1);
+}
+
+/**
+ * Full frames, each one a window and a memory write continued strip by strip
+ */
+internal error_t bench_frames(bench_display_t *bench) {
+    semaphore_t sent;
+
+    sem_init(&sent, 0, 1);
+
+    error_t error = bench_full_window();
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    uint64_t start = bench_start();
+
+    for (uint32_t frame = 0; frame < BENCH_FRAMES; frame++) {
+        for (uint16_t row = 0; row < ST7789V_DISPLAY_HEIGHT; row += BENCH_STRIP_ROWS) {
+            bool last = row + BENCH_STRIP_ROWS >= ST7789V_DISPLAY_HEIGHT;
+
+            st7789v_display_memory_write_async(
+                /*            buffer: */ bench_strip,
+                /*              size: */ sizeof(bench_strip),
+                /* completion_signal: */ last ? &sent : NULL,
+                /*  continue_writing: */ row > 0
+            );
+        }
+
+        sem_acquire_blocking(&sent);
+    }
+
+    bench_result_t *frames = &bench->results[BENCH_FRAME_ASYNC];
+    bench_result_t *bytes = &bench->results[BENCH_FRAME_ASYNC_BYTES];
+
+    *frames = bench_end("frame_async", "frames", BENCH_FRAMES, start);
+
+    // The same measurement, in bytes
+    *bytes = *frames;
+    bytes->name = "frame_async_bytes";
+    bytes->unit = "bytes";
+    bytes->count = BENCH_FRAMES * (ST7789V_DISPLAY_HEIGHT / BENCH_STRIP_ROWS) * sizeof(bench_strip);
+
+    return 0x00;
+}
+
+/**
+ * Small memory writes, waiting each one to be sent, then queued back to back
+ */
+internal error_t bench_small_writes(bench_display_t *bench) {
+    semaphore_t sent;
+
+    sem_init(&sent, 0, 1);
+
+    error_t error = bench_full_window();
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    uint64_t start = bench_start();
+
+    for (uint32_t index = 0; index < BENCH_SMALL_WRITES; index++) {
+        st7789v_display_memory_write_sync(bench_strip, BENCH_SMALL_WRITE, index > 0);
+    }
+
+    bench->results[BENCH_SMALL_SYNC] = bench_end("small_write_sync", "writes", BENCH_SMALL_WRITES, start);
+
+    start = bench_start();
+
+    for (uint32_t index = 0; index < BENCH_SMALL_WRITES; index++) {
+        bool last = index + 1 == BENCH_SMALL_WRITES;
+
+        st7789v_display_memory_write_async(bench_strip, BENCH_SMALL_WRITE, last ? &sent : NULL, index > 0);
+    }
+
+    sem_acquire_blocking(&sent);
+
+    bench->results[BENCH_SMALL_ASYNC] = bench_end("small_write_async", "writes", BENCH_SMALL_WRITES, start);
+
+    return 0x00;
+}
+
+internal error_t bench_fill(bench_display_t *bench) {
+    uint64_t start = bench_start();
+
+    for (uint32_t index = 0; index < BENCH_FILLS; index++) {
+        error_t error = st7789v_display_fill_rect(0, 0, ST7789V_DISPLAY_WIDTH, ST7789V_DISPLAY_HEIGHT, index);
+
+        if (error != 0x00) {
+            return error;
+        }
+    }
+
+    st7789v_sync_dma_operation();
+
+    bench->results[BENCH_FILL] = bench_end(
+        /*  name: */ "fill_rect",
+        /*  unit: */ "pixels",
+        /* count: */ BENCH_FILLS * ST7789V_DISPLAY_WIDTH * ST7789V_DISPLAY_HEIGHT,
+        /* start: */ start
+    );
+
+    return 0x00;
+}
+
+/**
+ * Screens full of text, a run per line
+ */
+internal error_t bench_glyphs(bench_display_t *bench, bool anti_aliased) {
+    static char line[TEXT_MAX_RUN];
+    text_palette_t palette;
+
+    for (size_t index = 0; index < TEXT_MAX_RUN; index++) {
+        line[index] = FONT_FIRST_CHAR + index % FONT_GLYPH_COUNT;
+    }
+
+    text_palette_init(&palette, 0xFFFF, 0x0000);
+
+    uint16_t lines = ST7789V_DISPLAY_HEIGHT / FONT_HEIGHT;
+    uint64_t start = bench_start();
+
+    for (uint32_t screen = 0; screen < BENCH_TEXT_SCREENS; screen++) {
+        for (uint16_t row = 0; row < lines; row++) {
+            error_t error = anti_aliased
+                ? text_draw_aa(&font_regular, &palette, 0, row * FONT_HEIGHT, line, TEXT_MAX_RUN)
+                : text_draw(0, row * FONT_HEIGHT, line, TEXT_MAX_RUN);
+
+            if (error != 0x00) {
+                return error;
+            }
+        }
+    }
+
+    text_wait();
+
+    bench->results[anti_aliased ? BENCH_GLYPHS_AA : BENCH_GLYPHS] = bench_end(
+        /*  name: */ anti_aliased ? "glyph_aa" : "glyph",
+        /*  unit: */ "glyphs",
+        /* count: */ BENCH_TEXT_SCREENS * lines * TEXT_MAX_RUN,
+        /* start: */ start
+    );
+
+    return 0x00;
+}
+
+/**
+ * Runs on the display core, the driver can only be used from there
+ */
+internal void bench_display(void *data) {
+    bench_display_t *bench = data;
+
+    memset(bench_strip, 0x5A, sizeof(bench_strip));
+
+    bench->error = bench_frames(bench);
+
+    if (bench->error == 0x00) bench->error = bench_small_writes(bench);
+    if (bench->error == 0x00) bench->error = bench_fill(bench);
+    if (bench->error == 0x00) bench->error = bench_glyphs(bench, /* anti_aliased: */ false);
+    if (bench->error == 0x00) bench->error = bench_glyphs(bench, /* anti_aliased: */ true);
+}
+
+/******************** MATH *************************/
+
+internal void bench_evaluator(void) {
+    static const char source[] = "sin(x)*cos(x)+x^2/3-ln(x+2)";
+    static double variables[EXPR_VARIABLE_COUNT];
+    static expr_t expr;
+    size_t position;
+
+    if (expr_compile(source, strlen(source), &expr, &position) != 0x00) {
+        printf("bench evaluate failed to compile\n");
+
+        return;
+    }
+
+    double sum = 0;
+    uint64_t start = bench_start();
+
+    for (uint32_t index = 0; index < BENCH_EVALUATIONS; index++) {
+        double result;
+
+        variables[EXPR_VARIABLE('x')] = index * 0.001;
+
+        if (expr_evaluate(&expr, variables, &result) == 0x00) {
+            sum += result;
+        }
+    }
+
+    bench_result_t result = bench_end("evaluate", "evaluations", BENCH_EVALUATIONS, start);
+
+    // Printed, so the evaluations can't be thrown away
+    printf("bench evaluate checksum=%.6g\n", sum);
+
+    bench_print(&result);
+}
+
+internal void bench_matrix(void) {
+    static byte __attribute__((aligned(ARENA_ALIGNMENT))) buffer[BENCH_MATRIX_ARENA];
+    arena_t arena;
+    matrix_t matrix, b, x, product;
+
+    arena_init(&arena, buffer, sizeof(buffer), "bench matrix");
+
+    if (
+        matrix_new(&arena, MATRIX_ELEMENT_DOUBLE, BENCH_MATRIX_SIZE, BENCH_MATRIX_SIZE, &matrix) != 0x00 ||
+        matrix_new(&arena, MATRIX_ELEMENT_DOUBLE, BENCH_MATRIX_SIZE, 1, &b) != 0x00 ||
+        matrix_new(&arena, MATRIX_ELEMENT_DOUBLE, BENCH_MATRIX_SIZE, 1, &x) != 0x00 ||
+        matrix_new(&arena, MATRIX_ELEMENT_DOUBLE, BENCH_MATRIX_SIZE, BENCH_MATRIX_SIZE, &product) != 0x00
+    ) {
+        printf("bench matrix failed to allocate\n");
+
+        return;
+    }
+
+    // Diagonally dominant, so it's well conditioned
+    for (uint row = 0; row < BENCH_MATRIX_SIZE; row++) {
+        for (uint column = 0; column < BENCH_MATRIX_SIZE; column++) {
+            MATRIX_AT(&matrix, values, row, column) = row == column ? BENCH_MATRIX_SIZE : 1.0 / (row + column + 1);
+        }
+
+        MATRIX_AT(&b, values, row, 0) = row + 1;
+    }
+
+    double sum = 0;
+    uint64_t start = bench_start();
+
+    for (uint32_t index = 0; index < BENCH_MATRIX_SOLVES; index++) {
+        if (matrix_solve(&arena, &matrix, &b, &x) == 0x00) {
+            sum += MATRIX_AT(&x, values, index % BENCH_MATRIX_SIZE, 0);
+        }
+    }
+
+    bench_result_t solve = bench_end("matrix_solve_10x10", "solves", BENCH_MATRIX_SOLVES, start);
+
+    start = bench_start();
+
+    for (uint32_t index = 0; index < BENCH_MATRIX_SOLVES; index++) {
+        if (matrix_multiply(&matrix, &matrix, &product) == 0x00) {
+            sum += MATRIX_AT(&product, values, index % BENCH_MATRIX_SIZE, 0);
+        }
+    }
+
+    bench_result_t multiply = bench_end("matrix_multiply_10x10", "products", BENCH_MATRIX_SOLVES, start);
+
+    // Printed, so the results can't be thrown away
+    printf("bench matrix checksum=%.6g\n", sum);
+
+    bench_print(&solve);
+    bench_print(&multiply);
+}
+
+void bench_main(bool has_display) {
+    if (has_display) {
+        static bench_display_t bench;
+        semaphore_t done;
+
+        sem_init(&done, 0, 1);
+
+        display_submit(&(display_job_t) {
+            .type               = DISPLAY_JOB_CALL,
+            .call               = { bench_display, &bench },
+            .completion_signal  = &done
+        });
+
+        sem_acquire_blocking(&done);
+
+        if (bench.error != 0x00) {
+            printf("bench display failed error=%d\n", bench.error);
+        } else {
+            for (int index = 0; index < BENCH_DISPLAY_RESULT_COUNT; index++) {
+                bench_print(&bench.results[index]);
+            }
+        }
+    } else {
+        printf("bench display skipped\n");
+    }
+
+#if !PICO_ON_DEVICE
+    // What the renderers left on the simulated display, to look at
+    if (has_display && st7789v_sim_write_ppm("descartex_bench.ppm") != 0x00) {
+        printf("bench can't write descartex_bench.ppm\n");
+    }
+#endif
+
+    bench_evaluator();
+    bench_matrix();
+
+    // The kernels print their own lines, in cycles per call and worst errors
+    kernel_benchmark();
+
+    printf("bench done\n");
+    fflush(stdout);
+}
@@ -0,0 +1,22 @@
+#ifndef BENCH_BENCH_H
+#define BENCH_BENCH_H
+
+#include <stdbool.h>
+#include <util/util.h>
+
+/**
+ * The entry of the `descartex_bench` firmware, instead of `app_main`: measures the display
+ * pipeline and the math, and prints one line per measurement to stdio, to compare builds:
+ *
+ *     bench <name> count=<n> unit=<unit> us=<elapsed> per_second=<n / elapsed>
+ *
+ * PARAMETERS
+ * - has_display: if `display_wait_started` succeeded, the display measurements are skipped if not
+ *
+ * NOTES
+ * - The display is measured from core 1, where its driver lives, and the lines are printed
+ *   from core 0 once it's done. The last line is `bench done`.
+ */
+external void bench_main(bool has_display);
+
+#endif /** BENCH_BENCH_H */
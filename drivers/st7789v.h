@@ -1,8 +1,7 @@
 #ifndef DRIVERS_ST7789V_H
 #define DRIVERS_ST7789V_H
 
-#include <hardware/spi.h>
-#include <hardware/dma.h>
+#include <pico.h>
 #include <pico/sem.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -11,6 +10,21 @@
 #include <util/types.h>
 #include <errno.h>
 
+#if PICO_ON_DEVICE
+#   include <hardware/spi.h>
+#   include <hardware/dma.h>
+#else
+/**
+ * The host builds have no DMA (see st7789v_sim.c), the queue entries keep the same sizes
+ */
+enum dma_channel_transfer_size
+{
+    DMA_SIZE_8  = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2
+};
+#endif
+
 /******************** CONNECTION SETTINGS *************************/
 
 // Work-around for:
@@ -30,6 +44,23 @@
 #define ST7789V_PIN_MOSI        19
 #define ST7789V_PIN_DC          20
 
+/** The panel's tearing effect output, only needed for `st7789v_display_set_vsync_enabled` */
+#define ST7789V_PIN_TE          21
+
+/********************** QUEUE SETTINGS ****************************/
+
+/** How many operations can be waiting in the submission queue */
+#define ST7789V_QUEUE_SIZE          32
+
+/** Parameter blocks up to this size are copied into the queue entry */
+#define ST7789V_QUEUE_INLINE_SIZE   8
+
+/**
+ * How long an entry waits for the TE line before it's sent anyway (a bit more than two
+ * frames), so the queue doesn't get stuck if the TE pin is not connected
+ */
+#define ST7789V_VSYNC_TIMEOUT_US    40000
+
 /********************* DISPLAY CONSTANTS **************************/
 #define ST7789V_DISPLAY_ID      0x858552
 #define ST7789V_DISPLAY_WIDTH   240
@@ -613,24 +644,155 @@ typedef union st7789v_adaptive_brightness_color_enhancement_t {
     } __attribute__((packed));
 } st7789v_adaptive_brightness_color_enhancement_t;
 
+/**
+ * An operation in the display submission queue.
+ *
+ * Each entry is one DMA transfer with a fixed DC level: a command byte, a block of
+ * parameters or a block of pixels. A command with its parameters is a sequence of entries,
+ * where the first one has `begin_comm` and the last one has `end_comm` set, so CS is kept
+ * low between them.
+ *
+ * Submit entries with `st7789v_queue_submit`. Consecutive entries are sent as a single run
+ * sequenced by the DMA hardware (including the DC and CS changes), the CPU is only involved
+ * at the end of a run, which is after an entry bigger than the SPI FIFO (like pixels), or
+ * after an entry with a `completion_signal`. So a window set and memory write is only one
+ * interrupt, and the caller can queue a full frame and go back to work.
+ *
+ * The queue has a single producer: only submit from the core that called `st7789v_init`
+ * (core 1, the display core), the DMA IRQ is also serviced there.
+ */
+typedef struct st7789v_queue_entry_t
+{
+    /**
+     * The buffer to send, if this is `NULL`, the entry's `inline_data` is sent instead.
+     *
+     * This buffer needs to be kept alive until the entry is sent, use `completion_signal`
+     * or `st7789v_sync_dma_operation` to know when it's safe to reuse it.
+     */
+    const byte                      *buffer;
+
+    /**
+     * How many values of `data_size` are sent from the buffer, needs to be at least one
+     */
+    size_t                          size;
+
+    /**
+     * The semaphore to be released when this entry finishes, can be `NULL`
+     */
+    semaphore_t                     *completion_signal;
+
+    /**
+     * The size of each value sent, use DMA_SIZE_8 for bytes
+     */
+    enum dma_channel_transfer_size  data_size;
+
+    /**
+     * How many bits of each value are shifted out (the SPI frame size), `0` is the same as 8.
+     *
+     * With `DMA_SIZE_16`, use 16 to send native `uint16_t` RGB565 pixels (the SPI sends the
+     * MSB first, so there's no byte swap), or 12 to send the low 12 bits of each value as an
+     * RGB444 pixel.
+     */
+    uint8_t                         frame_bits;
+
+    /**
+     * If the read address wraps around every `1 << read_ring_bits` bytes, to repeat a short
+     * pattern `size` values long (the buffer needs to be aligned to the ring size). `0` if
+     * the read address doesn't wrap.
+     */
+    uint8_t                         read_ring_bits;
+
+    /**
+     * If this entry is a command byte (DC is low while it's sent)
+     */
+    bool                            command     : 1;
+
+    /**
+     * If CS should be set to LOW before this entry is sent
+     */
+    bool                            begin_comm  : 1;
+
+    /**
+     * If CS should be set to HIGH after this entry is sent
+     */
+    bool                            end_comm    : 1;
+
+    /**
+     * If this entry should only be sent after the TE line rises, set by `st7789v_queue_vsync`
+     * for the entry submitted after it. Ignored if vsync is not enabled.
+     */
+    bool                            wait_vsync  : 1;
+
+    /**
+     * If the first value of the buffer is sent `size` times, instead of going through the
+     * buffer (for solid fills)
+     */
+    bool                            repeat      : 1;
+
+    /**
+     * Storage for small payloads (the command byte and small parameter blocks), so the
+     * caller doesn't need to keep them alive
+     */
+    byte                            inline_data[ST7789V_QUEUE_INLINE_SIZE] __attribute__((aligned(4)));
+} st7789v_queue_entry_t;
+
 /**
  * Initialize the display on the pins defined above, using pico's Serial interface and
  * DMA hardware to get the best performance possible.
  *
+ * NOTES
+ * - This only waits for the 5ms of the software reset (to read the id), the display is
+ *   still asleep when it returns: call `st7789v_init_poll` until it's awake. Anything can be
+ *   queued meanwhile, the display takes its memory writes while it's asleep.
+ *
  * RETURN VALUE
  * - ENODMAAVAILABLE: if there's not an DMA channel available
  * - ENODISPLAYCONNECTED: if the display doesn't match the specified id
  */
 external error_t st7789v_init(void);
 
+/**
+ * Finish the bring-up started by `st7789v_init`, without blocking: the display can only
+ * leave the sleep mode 120ms after its reset, then this sends the sleep out and queues the
+ * display on (sent by the queue after the 5ms of the sleep out).
+ *
+ * NOTES
+ * - Call it from the display core's loop between its jobs, it's only a check when the
+ *   display isn't ready for the next step.
+ *
+ * RETURN VALUE
+ * - true once the display was woken up, false while it's waiting (or not plugged)
+ */
+external bool st7789v_init_poll(void);
+
 /**
  * Begin a communication with the display (set CS to LOW)
+ *
+ * NOTES
+ * - This waits for everything in the submission queue to be sent, and for the display to
+ *   finish resetting or switching sleep states, so the synchronous operations (like all the
+ *   `st7789v_display_read_*` functions) can use the bus.
  * 
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
  */
 external error_t st7789v_begin_comm(void);
 
+/**
+ * Begin a communication with the display that reads something back, everything in it is
+ * clocked at `ST7789V_READING_BAUDRATE` (including the command bytes), so the clock is set
+ * once for the whole communication instead of on every byte read.
+ *
+ * NOTES
+ * - The clock is only changed when the last communication was not a read, so a sequence of
+ *   reads (like the diagnostics) only switches it once.
+ * - Same as `st7789v_begin_comm` for the rest.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ */
+external error_t st7789v_begin_read_comm(void);
+
 /**
  * End a communication with the display (set CS to HIGH)
  * 
@@ -666,7 +828,6 @@ external void st7789v_end_command(void);
  * 
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_write_sync(byte *buffer, size_t size);
 
@@ -681,39 +842,80 @@ external error_t st7789v_write_sync(byte *buffer, size_t size);
  * 
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 error_t st7789v_read_sync(byte *buffer, size_t size);
 
 /**
- * This function tries to write asynchronously into the display, this is useful to large buffers,
- * like pixels, etc.
+ * Put an operation in the display submission queue, the operation is sent by the DMA as soon
+ * everything queued before it is sent.
  *
  * PARAMETERS
- * - buffer: the buffer to write
- * - size: the size of the buffer to write
- * - data_size: the size of the buffer data, use DMA_SIZE_8 for bytes
- * - completion_signal: the semaphore to be released when the transaction finishes
- * - close_comm_when_finish: if the dma irq handler should call `st7789v_end_comm(void)` when finishes writing
+ * - entry: the operation to queue, it's copied into the queue
  *
  * NOTES
- * - the `data_size` and `size` parameters are related, if you put DMA_SIZE_16, you'll need to provide
- *   the size of the buffer (`size`) into 16-bit values, and not the byte size of the buffer.
- * 
+ * - If the queue is full, this waits for the DMA IRQ handler to free a slot.
+ * - While the display is resetting or switching sleep states, the queued operations are held
+ *   and sent as soon the display can receive commands again.
+ * - The queue has a single producer, don't submit from both cores at the same time.
+ *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
-external error_t st7789v_dma_write(
-    byte *buffer,
-    size_t size,
-    enum dma_channel_transfer_size data_size,
-    semaphore_t *completion_signal,
-    bool close_comm_when_finish
+external error_t st7789v_queue_submit(const st7789v_queue_entry_t *entry);
+
+/**
+ * Same as `st7789v_queue_submit`, but don't wait if the queue is full.
+ *
+ * PARAMETERS
+ * - entry: the operation to queue, it's copied into the queue
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ * - EDISPLAYBUSY: if the submission queue is full
+ */
+external error_t st7789v_queue_try_submit(const st7789v_queue_entry_t *entry);
+
+/**
+ * Queue an command to the display, with its parameters, in its own transaction
+ *
+ * PARAMETERS
+ * - command: the command to send
+ * - parameters: the parameters this command receive
+ * - parameter_count: how many parameters has in the `paramaters` pointer
+ *
+ * NOTES
+ * - parameters up to `ST7789V_QUEUE_INLINE_SIZE` bytes are copied into the queue, bigger ones
+ *   are sent from the `parameters` buffer, which must be kept alive until they're sent.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ */
+external error_t st7789v_queue_command(
+    enum st7789v_command_t command,
+    const byte *parameters,
+    size_t parameter_count
 );
 
 /**
- * Waits for an DMA operation to finish on this display
+ * Queue a vsync point: the entries submitted after this are only sent when the panel's scan
+ * reaches `scanline`, so a region that starts at that line is written right behind the
+ * scan and never tears (the SPI is slower than the scan, so it never catches up with it).
+ *
+ * PARAMETERS
+ * - scanline: the line of the panel the next write starts at
+ *
+ * NOTES
+ * - This is done by the TE pin interrupt, there's no polling: the queue just doesn't start
+ *   the next entry until the TE line rises for `scanline`.
+ * - Does nothing if vsync is not enabled with `st7789v_display_set_vsync_enabled`.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ */
+external error_t st7789v_queue_vsync(uint16_t scanline);
+
+/**
+ * Waits for all the queued operations to be sent to this display
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
@@ -730,7 +932,6 @@ external error_t st7789v_sync_dma_operation(void);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_send_command_sync(
     enum st7789v_command_t command,
@@ -743,7 +944,6 @@ external error_t st7789v_send_command_sync(
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_no_operation(void);
 
@@ -755,7 +955,6 @@ external error_t st7789v_display_no_operation(void);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_software_reset(bool sync_delay);
 
@@ -764,7 +963,6 @@ external error_t st7789v_display_software_reset(bool sync_delay);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The display id
  */
 external uint32_t st7789v_display_read_id(void);
@@ -778,7 +976,6 @@ external uint32_t st7789v_display_read_id(void);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The raw display status
  */
 external int32_t st7789v_display_read_status(st7789v_display_status_t *status);
@@ -792,7 +989,6 @@ external int32_t st7789v_display_read_status(st7789v_display_status_t *status);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The raw display power status value
  */
 external byte st7789v_display_read_power_mode(st7789v_power_mode_t *pwrmode);
@@ -806,7 +1002,6 @@ external byte st7789v_display_read_power_mode(st7789v_power_mode_t *pwrmode);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The raw display memory access control value
  */
 external byte st7789v_display_read_memory_access_control(st7789v_memory_access_control_t *madctl);
@@ -820,7 +1015,6 @@ external byte st7789v_display_read_memory_access_control(st7789v_memory_access_c
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The raw display pixel format value
  */
 external byte st7789v_display_read_pixel_format(st7789v_interface_pixel_format_t *pixfmt);
@@ -834,7 +1028,6 @@ external byte st7789v_display_read_pixel_format(st7789v_interface_pixel_format_t
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The raw display image mode value
  */
 external byte st7789v_display_read_image_mode(st7789v_image_mode_t *img_mode);
@@ -848,7 +1041,6 @@ external byte st7789v_display_read_image_mode(st7789v_image_mode_t *img_mode);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The raw display signal mode value
  */
 external byte st7789v_display_read_signal_mode(st7789v_signal_mode_t *signal_mode);
@@ -862,7 +1054,6 @@ external byte st7789v_display_read_signal_mode(st7789v_signal_mode_t *signal_mod
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The raw display self diagnostic value
  */
 external byte st7789v_display_read_self_diagnostic(st7789v_self_diagnostic_t *diag);
@@ -884,7 +1075,6 @@ external byte st7789v_display_read_self_diagnostic(st7789v_self_diagnostic_t *di
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_sleep_in(bool sync_delay);
 
@@ -905,7 +1095,6 @@ external error_t st7789v_display_sleep_in(bool sync_delay);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_sleep_out(bool sync_delay);
 
@@ -918,7 +1107,6 @@ external error_t st7789v_display_sleep_out(bool sync_delay);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_set_normal_mode_state(bool enable);
 
@@ -930,7 +1118,6 @@ external error_t st7789v_display_set_normal_mode_state(bool enable);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_enable_inversion(bool enable);
 
@@ -942,7 +1129,6 @@ external error_t st7789v_display_enable_inversion(bool enable);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_set_gamma_correction_curve(st7789v_gamma_curve_t gamma_curve);
 
@@ -951,7 +1137,6 @@ external error_t st7789v_display_set_gamma_correction_curve(st7789v_gamma_curve_
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_turn_on(void);
 
@@ -960,7 +1145,6 @@ external error_t st7789v_display_turn_on(void);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_turn_off(void);
 
@@ -978,7 +1162,6 @@ external error_t st7789v_display_turn_off(void);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - ENOTINRANGE: if the values doesn't match the allowed ranges for addresses
  */
 external error_t st7789v_display_set_column_address_window(uint16_t start, uint16_t end);
@@ -997,7 +1180,6 @@ external error_t st7789v_display_set_column_address_window(uint16_t start, uint1
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - ENOTINRANGE: if the values doesn't match the allowed ranges for addresses
  */
 external error_t st7789v_display_set_row_address_window(uint16_t start, uint16_t end);
@@ -1012,7 +1194,6 @@ external error_t st7789v_display_set_row_address_window(uint16_t start, uint16_t
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_memory_write_sync(byte *buffer, size_t size, bool continue_writing);
 
@@ -1026,12 +1207,11 @@ external error_t st7789v_display_memory_write_sync(byte *buffer, size_t size, bo
  * - continue_writing: if you want to continue an old write operation (using COMMAND_MEMORY_WRITE_CONTINUE)
  *
  * NOTES
- * - the DMA operation is called with `close_comm_when_finish` as true, so the communication will
- *   end as soon the operation finishes. DO NOT TRY SENDING COMMANDS WHILE THIS OPERATION IS ONGOING.
+ * - the write is queued, other commands can be queued right after it, and are sent after the
+ *   memory write finishes. The buffer must be kept alive until `completion_signal` is released.
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_memory_write_async(
     byte *buffer,
@@ -1040,6 +1220,90 @@ external error_t st7789v_display_memory_write_async(
     bool continue_writing
 );
 
+/**
+ * Write native-endian pixels into the display memory asynchronously, without any conversion
+ *
+ * PARAMETERS
+ * - pixels: the pixels to write, in the CPU's byte order
+ * - count: how many pixels to write
+ * - completion_signal: the semaphore to release when the memory finishes writing
+ * - continue_writing: if you want to continue an old write operation (using COMMAND_MEMORY_WRITE_CONTINUE)
+ *
+ * NOTES
+ * - The pixels are sent with 16-bit DMA transfers and SPI frames the size of a pixel, so
+ *   they can be streamed straight from where they were drawn.
+ * - In the 16 bits per pixel format, each pixel is RGB565. In the 12 bits
+ *   per pixel format (see `st7789v_display_set_pixel_format`), only the low 12 bits of each
+ *   pixel are sent (0x0RGB), that's 25% less to send, for fast animations.
+ * - The pixels must be kept alive until `completion_signal` is released.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ * - EINVALIDSTATE: if the display is using a pixel format that doesn't fit in 16 bits
+ */
+external error_t st7789v_display_memory_write_pixels_async(
+    const uint16_t *pixels,
+    size_t count,
+    semaphore_t *completion_signal,
+    bool continue_writing
+);
+
+/**
+ * Fill a rectangle of the display memory with a color, without any pixel buffer
+ *
+ * PARAMETERS
+ * - x, y, width, height: the rectangle to fill
+ * - color: the color to fill, native-endian, in the current pixel format (like the pixels
+ *          of `st7789v_display_memory_write_pixels_async`)
+ *
+ * NOTES
+ * - The DMA sends the same color over and over (its read address doesn't increment), so a
+ *   full screen clear takes no memory and no CPU time. The color is copied into the queue.
+ * - This changes the column and row address windows.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ * - ENOTINRANGE: if the rectangle is empty or doesn't fit in the display
+ * - EINVALIDSTATE: if the display is using a pixel format that doesn't fit in 16 bits
+ */
+external error_t st7789v_display_fill_rect(
+    uint16_t x,
+    uint16_t y,
+    uint16_t width,
+    uint16_t height,
+    uint16_t color
+);
+
+/**
+ * Fill a rectangle of the display memory by repeating a short pattern of pixels
+ *
+ * PARAMETERS
+ * - x, y, width, height: the rectangle to fill
+ * - pattern: the pixels to repeat, in the same format as `st7789v_display_fill_rect`, it needs
+ *            to be aligned to its size in bytes
+ * - pattern_length_bits: the pattern is `1 << pattern_length_bits` pixels long, from 1 to 7
+ *
+ * NOTES
+ * - The pattern is repeated along the rows (the DMA read address wraps around it), so if
+ *   `width` is a multiple of its length, every row is the same, if not, it's shifted on each
+ *   row (for diagonal patterns).
+ * - The pattern must be kept alive until it's sent, use `st7789v_sync_dma_operation`.
+ * - This changes the column and row address windows.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ * - ENOTINRANGE: if the rectangle is empty or doesn't fit in the display, or the pattern length is invalid
+ * - EINVALIDSTATE: if the display is using a pixel format that doesn't fit in 16 bits
+ */
+external error_t st7789v_display_fill_pattern(
+    uint16_t x,
+    uint16_t y,
+    uint16_t width,
+    uint16_t height,
+    const uint16_t *pattern,
+    uint8_t pattern_length_bits
+);
+
 /**
  * Read from the display memory synchronously
  *
@@ -1050,7 +1314,6 @@ external error_t st7789v_display_memory_write_async(
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_memory_read_sync(byte *buffer, size_t size, bool continue_reading);
 
@@ -1063,7 +1326,6 @@ external error_t st7789v_display_memory_read_sync(byte *buffer, size_t size, boo
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_set_partial_area(uint16_t start, uint16_t end);
 
@@ -1076,7 +1338,6 @@ external error_t st7789v_display_set_partial_area(uint16_t start, uint16_t end);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - ENOTINRANGE: if the sum of all parameters is not 320
  * - EUNAVAILABLE: if this function is not available because of the configuration of the display
  */
@@ -1094,10 +1355,24 @@ external error_t st7789v_display_set_vertical_scrolling_parameters(
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_set_tearing_line_effect_enabled(bool enable);
 
+/**
+ * Enable or disable pacing the queue by the panel's tearing effect line
+ *
+ * PARAMETERS
+ * - enable: if the TE line should be turned on (in V-blank mode) and used by `st7789v_queue_vsync`
+ *
+ * NOTES
+ * - Needs the TE output of the panel connected to `ST7789V_PIN_TE`, if it's not, every
+ *   vsync point waits `ST7789V_VSYNC_TIMEOUT_US`.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ */
+external error_t st7789v_display_set_vsync_enabled(bool enable);
+
 /**
  * Configure display's memory access control
  *
@@ -1106,7 +1381,6 @@ external error_t st7789v_display_set_tearing_line_effect_enabled(bool enable);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_set_memory_access_control(st7789v_memory_access_control_t madctl);
 
@@ -1118,7 +1392,6 @@ external error_t st7789v_display_set_memory_access_control(st7789v_memory_access
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_set_vertical_scrolling_start_address(uint16_t address);
 
@@ -1130,7 +1403,6 @@ external error_t st7789v_display_set_vertical_scrolling_start_address(uint16_t a
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_set_idle(bool enable);
 
@@ -1142,10 +1414,25 @@ external error_t st7789v_display_set_idle(bool enable);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_set_pixel_format(st7789v_interface_pixel_format_t colmod);
 
+/**
+ * Same as `st7789v_display_set_pixel_format`, with the RGB interface format left at 65K colors
+ *
+ * PARAMETERS
+ * - format: the pixel format for the pixels sent over SPI
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ */
+static force_inline error_t st7789v_display_set_pixel_depth(st7789v_pixel_format_t format) {
+    return st7789v_display_set_pixel_format((st7789v_interface_pixel_format_t) {
+        .rgb_format     = RGB_INTERFACE_FORMAT_65K,
+        .pixel_format   = format
+    });
+}
+
 /**
  * Set display tearing scanline
  *
@@ -1154,7 +1441,6 @@ external error_t st7789v_display_set_pixel_format(st7789v_interface_pixel_format
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_set_tear_scanline(uint16_t scanline_number);
 
@@ -1163,7 +1449,6 @@ external error_t st7789v_display_set_tear_scanline(uint16_t scanline_number);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The current scanline number
  */
 external uint16_t st7789v_display_read_scanline(void);
@@ -1176,7 +1461,6 @@ external uint16_t st7789v_display_read_scanline(void);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_set_display_brightness(byte value);
 
@@ -1185,7 +1469,6 @@ external error_t st7789v_display_set_display_brightness(byte value);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The current scanline number
  */
 external byte st7789v_display_read_display_brightness(void);
@@ -1198,7 +1481,6 @@ external byte st7789v_display_read_display_brightness(void);
  *
  * RETURN VALUE:
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_set_ctrl_register(st7789v_display_ctrl_t ctrl);
 
@@ -1210,7 +1492,6 @@ external error_t st7789v_display_set_ctrl_register(st7789v_display_ctrl_t ctrl);
  *
  * RETURN VALUE:
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - the raw display control register value
  */
 external uint32_t st7789v_display_read_ctrl_register(st7789v_display_ctrl_t *ctrl);
@@ -1223,7 +1504,6 @@ external uint32_t st7789v_display_read_ctrl_register(st7789v_display_ctrl_t *ctr
  *
  * RETURN VALUE:
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_set_adaptive_brightness_color_enhancement(
     st7789v_adaptive_brightness_color_enhancement_t coca
@@ -1237,7 +1517,6 @@ external error_t st7789v_display_set_adaptive_brightness_color_enhancement(
  *
  * RETURN VALUE:
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - the raw content adaptive brightness and color enhancement value
  */
 external byte st7789v_display_read_content_adaptive_brightness(
@@ -1252,7 +1531,6 @@ external byte st7789v_display_read_content_adaptive_brightness(
  *
  * RETURN VALUE:
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external error_t st7789v_display_set_content_adaptive_minimum_brightness(byte value);
 
@@ -1264,7 +1542,6 @@ external error_t st7789v_display_set_content_adaptive_minimum_brightness(byte va
  *
  * RETURN VALUE:
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  */
 external byte st7789v_display_read_content_adaptive_minimum_brightness(void);
 
@@ -1277,7 +1554,6 @@ external byte st7789v_display_read_content_adaptive_minimum_brightness(void);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The raw display adaptive brightness self diagnostic value
  */
 external byte st7789v_display_read_adaptive_brightness_control_self_diagnostic(
@@ -1289,7 +1565,6 @@ external byte st7789v_display_read_adaptive_brightness_control_self_diagnostic(
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The display id 1
  */
 external byte st7789v_display_read_id_1(void);
@@ -1299,7 +1574,6 @@ external byte st7789v_display_read_id_1(void);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The display id 2
  */
 external byte st7789v_display_read_id_2(void);
@@ -1309,7 +1583,6 @@ external byte st7789v_display_read_id_2(void);
  *
  * RETURN VALUE
  * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
- * - EDISPLAYBUSY: if the display is busy with an DMA or reset operation
  * - The display id 3
  */
 external byte st7789v_display_read_id_3(void);
@@ -0,0 +1,64 @@
+#ifndef DRIVERS_ST7789V_BUS_H
+#define DRIVERS_ST7789V_BUS_H
+
+#include "st7789v.h"
+#include <stdbool.h>
+#include <util/util.h>
+#include <util/types.h>
+
+/**
+ * The backend of the driver: `st7789v.c` builds the commands of the display, and a backend
+ * sends them. `st7789v_rp2040.c` sends them over the SPI with the DMA sequencing the queue,
+ * `st7789v_sim.c` (for the host builds) interprets them into an in-memory copy of the
+ * display's memory.
+ *
+ * A backend implements the communication, synchronous write/read and queue functions of
+ * `st7789v.h` (`st7789v_init` to `st7789v_sync_dma_operation`, but `st7789v_queue_command`
+ * and `st7789v_send_command_sync`), and these.
+ */
+
+/**
+ * If the display answered `st7789v_init`, nothing is sent while this is false
+ */
+external bool st7789v_plugged;
+
+/**
+ * The delays the display needs after some commands before it can take new ones
+ */
+typedef enum st7789v_bus_wait_t: byte
+{
+    /** After a software reset: 5ms for new commands, 120ms for a sleep switch */
+    ST7789V_BUS_WAIT_RESET  = 0x00,
+
+    /** After a sleep in or out: 5ms for new commands, 120ms for the next switch */
+    ST7789V_BUS_WAIT_SLEEP  = 0x01
+} st7789v_bus_wait_t;
+
+/**
+ * Keep the bus from sending anything to the display until it's ready again
+ *
+ * NOTES
+ * - The communications started after this wait for the delay, and the queue is paused until
+ *   then, this doesn't wait itself.
+ */
+external void st7789v_bus_wait(st7789v_bus_wait_t wait);
+
+/**
+ * If the display can switch its sleep state: 120ms after the last software reset or sleep
+ * switch, doesn't block (for `st7789v_init_poll` and the sleep switches)
+ */
+external bool st7789v_bus_can_switch_sleep(void);
+
+/**
+ * Make the entries queued after `st7789v_queue_vsync` wait for the TE line or not, the
+ * entries already waiting are sent when it's disabled
+ */
+external void st7789v_bus_set_vsync(bool enable);
+
+/**
+ * Clock a single cycle without data, for the reads that need a dummy clock cycle before
+ * their first bit
+ */
+external void st7789v_dummy_cycle(void);
+
+#endif /** DRIVERS_ST7789V_BUS_H */
@@ -0,0 +1,1070 @@
+#include "st7789v.h"
+#include "st7789v_bus.h"
+#include <errno.h>
+#include <hardware/gpio.h>
+#include <hardware/irq.h>
+#include <hardware/spi.h>
+#include <hardware/structs/io_bank0.h>
+#include <hardware/structs/spi.h>
+#include <pico.h>
+#include <pico/critical_section.h>
+#include <pico/lock_core.h>
+#include <pico/mutex.h>
+#include <pico/platform/compiler.h>
+#include <pico/sem.h>
+#include <pico/sync.h>
+#include <pico/time.h>
+#include <stdbool.h>
+#include <string.h>
+#include <util/log.h>
+#include <util/trace.h>
+#include <util/types.h>
+#include <hardware/dma.h>
+
+#ifndef ST7789V_LOG_LEVEL
+#   define ST7789V_LOG_LEVEL LOG_LEVEL
+#endif
+
+#define DRV_LOG(...) LOG_AT(ST7789V_LOG_LEVEL, LOG_LEVEL_INFO, "st7789v", __VA_ARGS__)
+#define DRV_ERROR(...) LOG_AT(ST7789V_LOG_LEVEL, LOG_LEVEL_ERROR, "st7789v", __VA_ARGS__)
+#define DRV_WARNING(...) LOG_AT(ST7789V_LOG_LEVEL, LOG_LEVEL_WARNING, "st7789v", __VA_ARGS__)
+
+//////////////////////////////////////////////////////////////// Serial communication variables
+internal spi_inst_t *serial = ST7789V_SPI_PORT;
+
+/**
+ * The clock the SPI is set to, `spi_set_baudrate` searches the divisors and rewrites the
+ * SSP registers, so it's only called when switching between reading and writing.
+ */
+typedef enum st7789v_bus_mode_t: byte
+{
+    BUS_MODE_UNKNOWN    = 0x00,
+    BUS_MODE_WRITING    = 0x01,
+    BUS_MODE_READING    = 0x02
+} st7789v_bus_mode_t;
+
+internal st7789v_bus_mode_t bus_mode = BUS_MODE_UNKNOWN;
+
+/**
+ * If the current communication was started by `st7789v_begin_read_comm`, its writes are
+ * clocked at the reading rate too.
+ */
+internal bool comm_reading = false;
+
+//////////////////////////////////////////////////////////////// DMA hardware variables
+internal int dma_data_channel = -1;
+
+/**
+ * This channel loads the control blocks of a run into the data channel, each time the
+ * data channel finishes a block, it chains to this channel to load the next one.
+ */
+internal int dma_control_channel = -1;
+
+/**
+ * An set of values for the data channel registers (in the order of its alias 0 registers),
+ * written by the control channel to start each step of a run.
+ */
+typedef struct dma_control_block_t
+{
+    const volatile void *read_addr;
+    volatile void *write_addr;
+    uint32_t transfer_count;
+    uint32_t ctrl;
+} dma_control_block_t;
+
+/**
+ * The most entries sent by the hardware in a single run, each entry needs at most six
+ * control blocks (CS begin, frame size, DC, write, drain and CS end)
+ */
+#define ST7789V_QUEUE_RUN_SIZE      8
+#define ST7789V_RUN_MAX_BLOCKS      (ST7789V_QUEUE_RUN_SIZE * 6)
+
+/**
+ * How many values the SPI FIFOs hold, entries this size or smaller can be paced by
+ * draining the RX FIFO
+ */
+#define ST7789V_SPI_FIFO_DEPTH      8
+
+internal dma_control_block_t run_blocks[ST7789V_RUN_MAX_BLOCKS];
+
+/**
+ * How many queue entries are being sent by the current run
+ */
+internal uint32_t run_length = 0;
+
+/**
+ * The values written to IO_BANK0 to drive the DC and CS pins LOW and HIGH
+ */
+internal uint32_t pin_ctrl_low =
+    (GPIO_OVERRIDE_LOW << IO_BANK0_GPIO0_CTRL_OUTOVER_LSB) | (GPIO_FUNC_SIO << IO_BANK0_GPIO0_CTRL_FUNCSEL_LSB);
+
+internal uint32_t pin_ctrl_high =
+    (GPIO_OVERRIDE_HIGH << IO_BANK0_GPIO0_CTRL_OUTOVER_LSB) | (GPIO_FUNC_SIO << IO_BANK0_GPIO0_CTRL_FUNCSEL_LSB);
+
+/**
+ * Where the drain blocks put the values read from the SPI RX FIFO
+ */
+internal uint32_t run_drain_sink;
+
+/**
+ * The SPI CR0 values for 8, 12 and 16-bit frames, written by the frame size blocks. Built
+ * from the current CR0 when a run starts, as it also holds the clock divisor.
+ */
+internal uint32_t run_cr0[3];
+
+//////////////////////////////////////////////////////////////// Submission queue variables
+
+/**
+ * The ring buffer of queued operations, entries are written by `st7789v_queue_submit()` at
+ * `queue_head` and consumed by the DMA IRQ handler at `queue_tail`.
+ *
+ * Both indexes only grow, the slot of an index is `index % ST7789V_QUEUE_SIZE`.
+ */
+internal st7789v_queue_entry_t queue[ST7789V_QUEUE_SIZE];
+
+internal volatile uint32_t queue_head = 0;
+internal volatile uint32_t queue_tail = 0;
+
+/**
+ * If the DMA channel is working through the queue, only changed with `queue_lock` held.
+ */
+internal volatile bool queue_running = false;
+
+/**
+ * How many slots are free in the queue, acquired by the producer, and released by the
+ * DMA IRQ handler when an entry finishes.
+ */
+internal semaphore_t queue_free_slots;
+
+/**
+ * Protects `queue_running`, as the queue can be started by the producer, the DMA IRQ
+ * handler and the reset/sleep alarms.
+ */
+internal critical_section_t queue_lock;
+
+//////////////////////////////////////////////////////////////// Vsync variables
+
+/**
+ * If the entries with `wait_vsync` should wait for the TE line
+ */
+internal volatile bool vsync_enabled = false;
+
+/**
+ * If the queue is waiting for the TE line (its IRQ is enabled and the timeout is set), only
+ * changed with `queue_lock` held.
+ */
+internal volatile bool vsync_armed = false;
+
+/**
+ * If the TE line rose (or the wait timed out) since the queue started waiting, the entry at
+ * the tail can be sent. Only changed with `queue_lock` held.
+ */
+internal volatile bool vsync_ready = false;
+
+/**
+ * The alarm ending the wait, 0 if there's none (or it was only just added). Only changed
+ * with `queue_lock` held.
+ */
+internal alarm_id_t vsync_timeout_alarm = 0;
+
+/**
+ * The core that ran `st7789v_init`, its TE IRQ handler is the one that was added: the
+ * queue is also kicked from the alarms (on the core of the alarm pool), so the TE IRQ is
+ * always enabled for this core, not for the calling one
+ */
+internal uint te_irq_core = 0;
+
+/**
+ * Set by `st7789v_queue_vsync`, the next entry pushed into the queue will wait for the TE line
+ */
+internal bool vsync_next_entry = false;
+
+//////////////////////////////////////////////////////////////// Driver-specific variables
+bool st7789v_plugged = false;
+
+/**
+ * If there's an communication happening, this lock is triggered
+ * when `st7789v_begin_comm()` is called, and released when `st7789v_end_comm()` is called.
+ */
+internal mutex_t communication_lock;
+
+/**
+ * If the driver is busy writing or reading data with normal read/write operations.
+ */
+internal mutex_t busy_lock;
+
+/**
+ * If the display is switching sleep states, this lock is released when the 5ms
+ * delay of switching sleep states and be available to send new commands.
+ *
+ * This lock is locked by `st7789v_display_sleep_[in|out]()`
+ */
+internal mutex_t sleep_lock;
+
+/**
+ * If the display is switching sleep states, this lock is released when the 120ms
+ * delay of changing sleep states finishes.
+ *
+ * This lock is locked by `st7789v_display_software_reset()` and `st7789v_display_sleep_[in|out]()`
+ */
+internal mutex_t sleep_switch_state_lock;
+
+/**
+ * If the display is resetting by software, this lock is released when the 5ms of the
+ * reset has passed, after calling `st7789v_display_software_reset()`.
+ */
+internal mutex_t reset_lock;
+
+internal force_inline
+void st7789v_set_bus_mode(st7789v_bus_mode_t mode) {
+    if (bus_mode == mode) {
+        return;
+    }
+
+    spi_set_baudrate(serial, mode == BUS_MODE_READING ? ST7789V_READING_BAUDRATE : ST7789V_WRITING_BAUDRATE);
+
+    bus_mode = mode;
+}
+
+internal force_inline
+bool st7789v_is_dma_busy() {
+    return queue_running || dma_channel_is_busy(dma_data_channel) || dma_channel_is_busy(dma_control_channel);
+}
+
+internal force_inline
+bool st7789v_is_reset_busy() {
+    return reset_lock.owner != LOCK_INVALID_OWNER_ID;
+}
+
+internal force_inline
+bool st7789v_is_sleep_busy() {
+    return sleep_lock.owner != LOCK_INVALID_OWNER_ID;
+}
+
+internal force_inline
+bool st7789v_is_queue_empty() {
+    return queue_tail == queue_head;
+}
+
+/**
+ * Set a pin driven through the IO_BANK0 output override, the DC and CS lines are always
+ * driven this way, as the DMA can't access the SIO to change them with `gpio_put`.
+ */
+internal force_inline
+void st7789v_pin_put(uint pin, bool value) {
+    gpio_set_outover(pin, value ? GPIO_OVERRIDE_HIGH : GPIO_OVERRIDE_LOW);
+}
+
+/**
+ * Append a control block that sets `pin` to `value` through its IO_BANK0 control register
+ */
+internal void st7789v_run_add_pin_block(uint32_t *block_count, uint pin, bool value) {
+    dma_control_block_t *block = &run_blocks[(*block_count)++];
+
+    dma_channel_config config = dma_channel_get_default_config(dma_data_channel);
+
+    channel_config_set_read_increment(&config, false);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+    channel_config_set_dreq(&config, DREQ_FORCE);
+    channel_config_set_chain_to(&config, dma_control_channel);
+    channel_config_set_irq_quiet(&config, true);
+
+    block->read_addr = value ? &pin_ctrl_high : &pin_ctrl_low;
+    block->write_addr = &io_bank0_hw->io[pin].ctrl;
+    block->transfer_count = 1;
+    block->ctrl = channel_config_get_ctrl_value(&config);
+}
+
+/**
+ * Append a control block that sends `entry` to the SPI, if `last` is set, the data channel
+ * raises its IRQ once this block is finished instead of chaining to the next block.
+ */
+internal void st7789v_run_add_write_block(uint32_t *block_count, st7789v_queue_entry_t *entry, bool last) {
+    dma_control_block_t *block = &run_blocks[(*block_count)++];
+
+    dma_channel_config config = dma_channel_get_default_config(dma_data_channel);
+
+    channel_config_set_read_increment(&config, !entry->repeat);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_transfer_data_size(&config, entry->data_size);
+
+    if (entry->read_ring_bits != 0) {
+        channel_config_set_ring(&config, /* write: */ false, entry->read_ring_bits);
+    }
+
+    channel_config_set_dreq(&config, spi_get_dreq(serial, /* is_tx: */ true));
+    channel_config_set_chain_to(&config, last ? dma_data_channel : dma_control_channel);
+    channel_config_set_irq_quiet(&config, !last);
+
+    block->read_addr = entry->buffer != NULL ? entry->buffer : entry->inline_data;
+    block->write_addr = &spi_get_hw(serial)->dr;
+    block->transfer_count = entry->size;
+    block->ctrl = channel_config_get_ctrl_value(&config);
+
+    // Runs are built with the queue lock held, so the IRQ handler can't trace meanwhile
+    TRACE_COUNT(TRACE_COUNTER_DMA_BYTES, entry->size << entry->data_size);
+}
+
+internal force_inline
+uint8_t st7789v_entry_frame_bits(const st7789v_queue_entry_t *entry) {
+    return entry->frame_bits == 0 ? 8 : entry->frame_bits;
+}
+
+internal force_inline
+uint32_t *st7789v_run_cr0(uint8_t frame_bits) {
+    return &run_cr0[frame_bits == 8 ? 0 : frame_bits == 12 ? 1 : 2];
+}
+
+/**
+ * Set the SPI frame size, the SPI needs to be idle
+ */
+internal force_inline
+void st7789v_set_frame_bits(uint8_t frame_bits) {
+    hw_write_masked(&spi_get_hw(serial)->cr0, (frame_bits - 1) << SPI_SSPCR0_DSS_LSB, SPI_SSPCR0_DSS_BITS);
+}
+
+internal force_inline
+uint8_t st7789v_get_frame_bits(void) {
+    return ((spi_get_hw(serial)->cr0 & SPI_SSPCR0_DSS_BITS) >> SPI_SSPCR0_DSS_LSB) + 1;
+}
+
+/**
+ * Append a control block that changes the SPI frame size, only put it after a drain block,
+ * so the SPI is idle when it's changed
+ */
+internal void st7789v_run_add_frame_block(uint32_t *block_count, uint8_t frame_bits) {
+    dma_control_block_t *block = &run_blocks[(*block_count)++];
+
+    dma_channel_config config = dma_channel_get_default_config(dma_data_channel);
+
+    channel_config_set_read_increment(&config, false);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+    channel_config_set_dreq(&config, DREQ_FORCE);
+    channel_config_set_chain_to(&config, dma_control_channel);
+    channel_config_set_irq_quiet(&config, true);
+
+    block->read_addr = st7789v_run_cr0(frame_bits);
+    block->write_addr = &spi_get_hw(serial)->cr0;
+    block->transfer_count = 1;
+    block->ctrl = channel_config_get_ctrl_value(&config);
+}
+
+/**
+ * Append a control block that reads `count` values from the SPI RX FIFO. As each value
+ * shifted out shifts one in, this block only finishes after `count` values were sent, so
+ * we know it's safe to change DC or CS after it.
+ */
+internal void st7789v_run_add_drain_block(uint32_t *block_count, size_t count) {
+    dma_control_block_t *block = &run_blocks[(*block_count)++];
+
+    dma_channel_config config = dma_channel_get_default_config(dma_data_channel);
+
+    channel_config_set_read_increment(&config, false);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_8);
+    channel_config_set_dreq(&config, spi_get_dreq(serial, /* is_tx: */ false));
+    channel_config_set_chain_to(&config, dma_control_channel);
+    channel_config_set_irq_quiet(&config, true);
+
+    block->read_addr = &spi_get_hw(serial)->dr;
+    block->write_addr = &run_drain_sink;
+    block->transfer_count = count;
+    block->ctrl = channel_config_get_ctrl_value(&config);
+}
+
+/**
+ * Build the control blocks for the entries at the queue's tail, and start sending them.
+ *
+ * A run is sent by the hardware without any CPU involvement between its entries: the control
+ * channel loads each block into the data channel, which chains back to the control channel
+ * when it finishes. Only the last entry of a run can be bigger than the SPI FIFO, as the
+ * entries before it are paced by draining the RX FIFO, and only the last one can have a
+ * `completion_signal`, as the IRQ handler is only called at the end of the run.
+ *
+ * The SPI needs to be idle when this is called, and `queue_lock` needs to be held.
+ */
+internal void st7789v_queue_start_run(void) {
+    uint32_t block_count = 0;
+    uint32_t length = 0;
+
+    uint32_t cr0 = spi_get_hw(serial)->cr0 & ~SPI_SSPCR0_DSS_BITS;
+
+    run_cr0[0] = cr0 | ((8 - 1) << SPI_SSPCR0_DSS_LSB);
+    run_cr0[1] = cr0 | ((12 - 1) << SPI_SSPCR0_DSS_LSB);
+    run_cr0[2] = cr0 | ((16 - 1) << SPI_SSPCR0_DSS_LSB);
+
+    // The first entry's frame size is set now, the SPI is idle
+    uint8_t frame_bits = st7789v_entry_frame_bits(&queue[queue_tail % ST7789V_QUEUE_SIZE]);
+
+    st7789v_set_frame_bits(frame_bits);
+
+    for (uint32_t index = queue_tail; index != queue_head; index++) {
+        st7789v_queue_entry_t *entry = &queue[index % ST7789V_QUEUE_SIZE];
+
+        length++;
+
+        if (st7789v_entry_frame_bits(entry) != frame_bits) {
+            // The entry before this one was drained, so nothing is being shifted out
+            frame_bits = st7789v_entry_frame_bits(entry);
+
+            st7789v_run_add_frame_block(&block_count, frame_bits);
+        }
+
+        bool last = index + 1 == queue_head
+            || length == ST7789V_QUEUE_RUN_SIZE
+            || entry->completion_signal != NULL
+            || entry->size > ST7789V_SPI_FIFO_DEPTH
+            || queue[(index + 1) % ST7789V_QUEUE_SIZE].wait_vsync;
+
+        if (entry->begin_comm) {
+            st7789v_run_add_pin_block(&block_count, ST7789V_PIN_CS, 0);
+        }
+
+        st7789v_run_add_pin_block(&block_count, ST7789V_PIN_DC, !entry->command);
+        st7789v_run_add_write_block(&block_count, entry, last);
+
+        if (last) {
+            break;
+        }
+
+        st7789v_run_add_drain_block(&block_count, entry->size);
+
+        if (entry->end_comm) {
+            st7789v_run_add_pin_block(&block_count, ST7789V_PIN_CS, 1);
+        }
+    }
+
+    run_length = length;
+
+    // The next entry that waits for the TE line needs a new edge
+    vsync_ready = false;
+
+    // Anything left in the RX FIFO from the last run would make the drain blocks finish early
+    while (spi_is_readable(serial))
+        (void) spi_get_hw(serial)->dr;
+
+    spi_get_hw(serial)->icr = SPI_SSPICR_RORIC_BITS;
+
+    dma_channel_set_read_addr(dma_control_channel, run_blocks, /* trigger: */ true);
+}
+
+internal void st7789v_queue_kick(void);
+
+/**
+ * Enable or disable the TE IRQ of `te_irq_core`, whatever core calls this
+ */
+internal void st7789v_te_set_irq_enabled(bool enable) {
+    io_irq_ctrl_hw_t *irq_ctrl = te_irq_core == 0 ? &io_bank0_hw->proc0_irq_ctrl : &io_bank0_hw->proc1_irq_ctrl;
+    io_rw_32 *inte = &irq_ctrl->inte[ST7789V_PIN_TE / 8];
+    uint32_t mask = GPIO_IRQ_EDGE_RISE << (4 * (ST7789V_PIN_TE % 8));
+
+    if (enable) {
+        hw_set_bits(inte, mask);
+    } else {
+        hw_clear_bits(inte, mask);
+    }
+}
+
+/**
+ * Stop waiting for the TE line and let the queue send the entry at its tail, called by the
+ * TE IRQ and by the timeout alarm.
+ */
+internal void st7789v_vsync_release(void) {
+    critical_section_enter_blocking(&queue_lock);
+
+    if (vsync_armed) {
+        st7789v_te_set_irq_enabled(false);
+
+        // Does nothing if this was called by the timeout itself
+        if (vsync_timeout_alarm > 0) {
+            cancel_alarm(vsync_timeout_alarm);
+        }
+
+        vsync_timeout_alarm = 0;
+        vsync_armed = false;
+        vsync_ready = true;
+    }
+
+    critical_section_exit(&queue_lock);
+
+    st7789v_queue_kick();
+}
+
+internal void __isr st7789v_te_irq_handler(void) {
+    if (!(gpio_get_irq_event_mask(ST7789V_PIN_TE) & GPIO_IRQ_EDGE_RISE)) {
+        // The IO bank IRQ is shared, this was caused by another pin
+        return;
+    }
+
+    gpio_acknowledge_irq(ST7789V_PIN_TE, GPIO_IRQ_EDGE_RISE);
+
+    st7789v_vsync_release();
+}
+
+internal int64_t vsync_timeout_alarm_callback(alarm_id_t alarm_id, void *data) {
+    st7789v_vsync_release();
+
+    return 0x00;
+}
+
+/**
+ * If the entry at the queue's tail needs to wait for the TE line, starts waiting for it if
+ * we aren't already (its timeout is added by `st7789v_vsync_start_timeout`, once the lock
+ * is released). `queue_lock` needs to be held.
+ */
+internal bool st7789v_queue_is_waiting_vsync(void) {
+    if (!vsync_enabled || vsync_ready || !queue[queue_tail % ST7789V_QUEUE_SIZE].wait_vsync) {
+        return false;
+    }
+
+    if (!vsync_armed) {
+        vsync_armed = true;
+
+        // An edge from before the wait would start it too early
+        gpio_acknowledge_irq(ST7789V_PIN_TE, GPIO_IRQ_EDGE_RISE);
+        st7789v_te_set_irq_enabled(true);
+    }
+
+    return true;
+}
+
+/**
+ * Add the timeout of a wait for the TE line that has none yet, without `queue_lock` held: an
+ * alarm already in the past fires inside `add_alarm_in_us`, and its callback takes the lock
+ */
+internal void st7789v_vsync_start_timeout(void) {
+    critical_section_enter_blocking(&queue_lock);
+
+    bool needed = vsync_armed && vsync_timeout_alarm == 0;
+
+    critical_section_exit(&queue_lock);
+
+    if (!needed) {
+        return;
+    }
+
+    alarm_id_t alarm = add_alarm_in_us(ST7789V_VSYNC_TIMEOUT_US, vsync_timeout_alarm_callback, NULL, true);
+
+    critical_section_enter_blocking(&queue_lock);
+
+    // The wait can have ended meanwhile, or another caller added its timeout first
+    if (vsync_armed && vsync_timeout_alarm == 0) {
+        vsync_timeout_alarm = alarm;
+        alarm = 0;
+    }
+
+    critical_section_exit(&queue_lock);
+
+    if (alarm > 0) {
+        cancel_alarm(alarm);
+    }
+}
+
+/**
+ * If the entry at the queue's tail can be sent now. `queue_lock` needs to be held.
+ */
+internal force_inline
+bool st7789v_queue_can_start(void) {
+    return !st7789v_is_queue_empty()
+        && !st7789v_is_reset_busy()
+        && !st7789v_is_sleep_busy()
+        && !st7789v_queue_is_waiting_vsync();
+}
+
+/**
+ * Start the queue if it's stopped and there's something to send. The queue is held while
+ * the display can't receive commands (after a reset or sleep state change) or while waiting
+ * for the TE line, the alarms and the TE IRQ that end those waits call this to resume it.
+ */
+internal void st7789v_queue_kick(void) {
+    critical_section_enter_blocking(&queue_lock);
+
+    if (!queue_running && st7789v_queue_can_start()) {
+        queue_running = true;
+
+        // The last synchronous operation could be a read
+        st7789v_set_bus_mode(BUS_MODE_WRITING);
+
+        st7789v_queue_start_run();
+    }
+
+    critical_section_exit(&queue_lock);
+
+    st7789v_vsync_start_timeout();
+}
+
+internal void __isr st7789v_dma_irq_handler(void) {
+    if (!dma_channel_get_irq0_status(dma_data_channel)) {
+        // This IRQ was not caused by any of our channels
+        DRV_WARNING("irq0 received from unknown channel");
+
+        return;
+    }
+
+    dma_channel_acknowledge_irq0(dma_data_channel);
+
+    // The DMA finishes as soon the last byte is in the SPI FIFO, we need to wait it to be
+    // shifted out before changing DC or CS for the next run.
+    while (spi_is_busy(serial))
+        tight_loop_contents();
+
+    // FIXME: if i do not read this Data Register of the SPI after the DMA operation,
+    //        it's not going to write properly if the transaction is only one byte.
+    while (spi_is_readable(serial))
+        (void) spi_get_hw(serial)->dr;
+
+    // Only the last entry of the run can end the communication or have a completion signal,
+    // the ones before it were handled by the control blocks
+    st7789v_queue_entry_t *entry = &queue[(queue_tail + run_length - 1) % ST7789V_QUEUE_SIZE];
+    semaphore_t *completion_signal = entry->completion_signal;
+
+    if (entry->end_comm) {
+        // End the serial communication after the DMA transaction finishes
+        st7789v_pin_put(ST7789V_PIN_CS, 1);
+    }
+
+    uint32_t finished = run_length;
+
+    critical_section_enter_blocking(&queue_lock);
+
+    queue_tail += finished;
+
+    if (st7789v_queue_can_start()) {
+        st7789v_queue_start_run();
+    } else {
+        queue_running = false;
+    }
+
+    critical_section_exit(&queue_lock);
+
+    st7789v_vsync_start_timeout();
+
+    while (finished--)
+        sem_release(&queue_free_slots);
+
+    if (completion_signal != NULL) {
+        sem_release(completion_signal);
+    }
+}
+
+internal int64_t unlock_mutex_alarm_callback(alarm_id_t alarm_id, void *data) {
+    mutex_t *mtx = data;
+
+    mutex_exit(mtx);
+
+    // Anything queued while the display was unavailable can be sent now
+    st7789v_queue_kick();
+
+    return 0x00;
+}
+
+void st7789v_dummy_cycle(void) {
+    if (dma_channel_is_busy(dma_data_channel)) {
+        return;
+    }
+
+    while (spi_is_busy(serial))
+        tight_loop_contents();
+
+    gpio_set_function(ST7789V_PIN_SCK, GPIO_FUNC_SIO);
+
+    gpio_set_dir(ST7789V_PIN_SCK, GPIO_OUT);
+
+    // Do a cycle
+    gpio_put(ST7789V_PIN_SCK, 1);
+    gpio_put(ST7789V_PIN_SCK, 0);
+
+    gpio_set_function(ST7789V_PIN_SCK, GPIO_FUNC_SPI);
+}
+
+force_inline
+error_t st7789v_begin_comm() {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    mutex_enter_blocking(&communication_lock);
+
+    // The bus is owned by the queue until everything queued is sent, and the display
+    // can't receive anything while it's resetting or switching sleep states
+    while (st7789v_is_dma_busy() || !st7789v_is_queue_empty() || st7789v_is_reset_busy() || st7789v_is_sleep_busy())
+        tight_loop_contents();
+
+    // The last run could have left the SPI sending pixels
+    if (st7789v_get_frame_bits() != 8) {
+        st7789v_set_frame_bits(8);
+    }
+
+    st7789v_pin_put(ST7789V_PIN_CS, 0);
+
+    return 0x00;
+}
+
+error_t st7789v_begin_read_comm() {
+    error_t error = st7789v_begin_comm();
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    comm_reading = true;
+
+    st7789v_set_bus_mode(BUS_MODE_READING);
+
+    return 0x00;
+}
+
+force_inline
+error_t st7789v_end_comm() {
+    if (!st7789v_plugged) {
+        return false;
+    }
+
+    st7789v_pin_put(ST7789V_PIN_CS, 1);
+
+    comm_reading = false;
+
+    mutex_exit(&communication_lock);
+
+    return 0x00;
+}
+
+force_inline
+void st7789v_begin_command() {
+    st7789v_pin_put(ST7789V_PIN_DC, 0);
+}
+
+force_inline
+void st7789v_end_command() {
+    st7789v_pin_put(ST7789V_PIN_DC, 1);
+}
+
+error_t st7789v_write_sync(byte *buffer, size_t size) {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    TRACE_BEGIN(TRACE_COUNTER_BUSY_LOCK_WAIT);
+    mutex_enter_blocking(&busy_lock);
+    TRACE_COUNT_ELAPSED(TRACE_COUNTER_BUSY_LOCK_WAIT);
+
+    st7789v_set_bus_mode(comm_reading ? BUS_MODE_READING : BUS_MODE_WRITING);
+    spi_write_blocking(serial, buffer, size);
+
+    mutex_exit(&busy_lock);
+
+    return 0x00;
+}
+
+error_t st7789v_read_sync(byte *buffer, size_t size) {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    TRACE_BEGIN(TRACE_COUNTER_BUSY_LOCK_WAIT);
+    mutex_enter_blocking(&busy_lock);
+    TRACE_COUNT_ELAPSED(TRACE_COUNTER_BUSY_LOCK_WAIT);
+
+    st7789v_set_bus_mode(BUS_MODE_READING);
+    spi_read_blocking(serial, 0xFF, buffer, size);
+
+    mutex_exit(&busy_lock);
+
+    return 0x00;
+}
+
+/**
+ * Copy `entry` into the queue and start the queue if needed, the caller needs to
+ * have acquired a slot from `queue_free_slots` already.
+ */
+internal void st7789v_queue_push(const st7789v_queue_entry_t *entry) {
+    st7789v_queue_entry_t *slot = &queue[queue_head % ST7789V_QUEUE_SIZE];
+
+    *slot = *entry;
+
+    if (vsync_next_entry) {
+        slot->wait_vsync = true;
+        vsync_next_entry = false;
+    }
+
+    // The entry needs to be visible to the IRQ handler before it can see the new head
+    __compiler_memory_barrier();
+
+    queue_head++;
+
+    st7789v_queue_kick();
+}
+
+error_t st7789v_queue_submit(const st7789v_queue_entry_t *entry) {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    // Sleeps until the DMA IRQ handler frees a slot, if the queue is full
+    sem_acquire_blocking(&queue_free_slots);
+
+    st7789v_queue_push(entry);
+
+    return 0x00;
+}
+
+error_t st7789v_queue_try_submit(const st7789v_queue_entry_t *entry) {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    if (!sem_try_acquire(&queue_free_slots)) {
+        TRACE_COUNT(TRACE_COUNTER_DISPLAY_BUSY, 1);
+
+        return -EDISPLAYBUSY;
+    }
+
+    st7789v_queue_push(entry);
+
+    return 0x00;
+}
+
+error_t st7789v_queue_vsync(uint16_t scanline) {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    if (!vsync_enabled) {
+        return 0x00;
+    }
+
+    error_t error = st7789v_display_set_tear_scanline(scanline);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    vsync_next_entry = true;
+
+    return 0x00;
+}
+
+error_t st7789v_sync_dma_operation() {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    // Wait the IRQ handler to go through everything queued, so we are 100% sure it's sent
+    // and the IRQ handler executed and released the semaphores if provided.
+    while (st7789v_is_dma_busy() || !st7789v_is_queue_empty())
+        tight_loop_contents();
+
+    while (spi_is_busy(serial))
+        tight_loop_contents();
+
+    return 0x00;
+}
+
+error_t st7789v_init() {
+    // Find a free DMA channel, if it's not found, error out
+    dma_data_channel = dma_claim_unused_channel(false);
+
+    if (dma_data_channel == -1) {
+        DRV_ERROR("couldn't find an available DMA channel for transmitting data");
+
+        return -ENODMAAVAILABLE;
+    }
+
+    dma_control_channel = dma_claim_unused_channel(false);
+
+    if (dma_control_channel == -1) {
+        DRV_ERROR("couldn't find an available DMA channel for sequencing transfers");
+
+        dma_channel_unclaim(dma_data_channel);
+        dma_data_channel = -1;
+
+        return -ENODMAAVAILABLE;
+    }
+
+    DRV_LOG("using DMA channels: data=%d,control=%d", dma_data_channel, dma_control_channel);
+
+    // The control channel writes the four alias 0 registers of the data channel for each
+    // block, the last one (CTRL_TRIG) starts the data channel
+    dma_channel_config control_config = dma_channel_get_default_config(dma_control_channel);
+
+    channel_config_set_read_increment(&control_config, true);
+    channel_config_set_write_increment(&control_config, true);
+    channel_config_set_ring(&control_config, /* write: */ true, /* size_bits: */ 4);
+    channel_config_set_transfer_data_size(&control_config, DMA_SIZE_32);
+
+    dma_channel_configure(
+        dma_control_channel,
+        &control_config,
+        /* write_addr: */ &dma_hw->ch[dma_data_channel].read_addr,
+        /* read_addr: */ run_blocks,
+        /* transfer_count: */ sizeof(dma_control_block_t) / sizeof(uint32_t),
+        /* trigger: */ false
+    );
+
+    mutex_init(&busy_lock);
+    mutex_init(&communication_lock);
+
+    mutex_init(&sleep_switch_state_lock);
+    mutex_init(&sleep_lock);
+    mutex_init(&reset_lock);
+
+    sem_init(&queue_free_slots, ST7789V_QUEUE_SIZE, ST7789V_QUEUE_SIZE);
+    critical_section_init(&queue_lock);
+
+    queue_head = queue_tail = 0;
+    queue_running = false;
+
+    vsync_enabled = vsync_armed = vsync_ready = vsync_next_entry = false;
+    vsync_timeout_alarm = 0;
+
+    spi_init(serial, ST7789V_SPI_BAUDRATE);
+
+    // The rate set by `spi_init` is not necessarily one of the two we use
+    bus_mode = BUS_MODE_UNKNOWN;
+    comm_reading = false;
+
+    spi_set_format(serial, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+
+    gpio_set_function(ST7789V_PIN_MISO, GPIO_FUNC_SPI);
+    gpio_set_function(ST7789V_PIN_MOSI, GPIO_FUNC_SPI);
+    gpio_set_function(ST7789V_PIN_SCK,  GPIO_FUNC_SPI);
+
+    gpio_init(ST7789V_PIN_DC);
+    gpio_init(ST7789V_PIN_CS);
+
+    gpio_set_dir(ST7789V_PIN_DC, GPIO_OUT);
+    gpio_set_dir(ST7789V_PIN_CS, GPIO_OUT);
+
+    // Initialize this pin to be high
+    st7789v_pin_put(ST7789V_PIN_CS, 1);
+    st7789v_pin_put(ST7789V_PIN_DC, 1);
+
+    // The TE line is only listened to while the queue waits for it
+    gpio_init(ST7789V_PIN_TE);
+    gpio_set_dir(ST7789V_PIN_TE, GPIO_IN);
+
+    te_irq_core = get_core_num();
+    gpio_add_raw_irq_handler(ST7789V_PIN_TE, st7789v_te_irq_handler);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+
+    DRV_LOG("initialized SPI with frequency:");
+    DRV_LOG("  reading: %d baud rate", ST7789V_READING_BAUDRATE);
+    DRV_LOG("  writing: %d baud rate", ST7789V_WRITING_BAUDRATE);
+
+    // Enable DMA interrupts
+    dma_channel_set_irq0_enabled(dma_data_channel, true);
+
+    irq_set_exclusive_handler(DMA_IRQ_0, st7789v_dma_irq_handler);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    st7789v_plugged = true;
+
+    // Reading the id already waits the 5ms of the reset, the 120ms before the display can
+    // leave the sleep mode are left to `st7789v_init_poll`
+    st7789v_display_software_reset(false);
+
+    uint32_t display_id = st7789v_display_read_id();
+
+    st7789v_plugged = false;
+
+    if (display_id != ST7789V_DISPLAY_ID) {
+        DRV_ERROR("invalid display id received: %06x", display_id);
+
+        return -ENODISPLAYCONNECTED;
+    }
+
+    st7789v_plugged = true;
+
+    DRV_LOG("found Sitronix ST7789V display controller on serial:");
+
+    DRV_LOG(
+        "  pins: tx=%d,rx=%d,cs=%d,sck=%d,dc=%d",
+        ST7789V_PIN_MOSI,
+        ST7789V_PIN_MISO,
+        ST7789V_PIN_CS,
+        ST7789V_PIN_SCK,
+        ST7789V_PIN_DC
+    );
+
+    return 0x00;
+}
+
+error_t st7789v_deinit(void) {
+    // Don't cut anything that is still queued in half
+    st7789v_sync_dma_operation();
+
+    if (dma_data_channel >= 0) {
+        DRV_LOG("deinitializing DMA channel %d", dma_data_channel);
+
+        dma_channel_set_irq0_enabled(dma_data_channel, false);
+
+        irq_set_exclusive_handler(DMA_IRQ_0, NULL);
+        irq_set_enabled(DMA_IRQ_0, false);
+
+        dma_channel_cleanup(dma_data_channel);
+        dma_channel_unclaim(dma_data_channel);
+
+        dma_data_channel = -1;
+    }
+
+    if (dma_control_channel >= 0) {
+        dma_channel_cleanup(dma_control_channel);
+        dma_channel_unclaim(dma_control_channel);
+
+        dma_control_channel = -1;
+    }
+
+    st7789v_te_set_irq_enabled(false);
+    gpio_remove_raw_irq_handler(ST7789V_PIN_TE, st7789v_te_irq_handler);
+
+    if (vsync_armed && vsync_timeout_alarm > 0) {
+        cancel_alarm(vsync_timeout_alarm);
+    }
+
+    vsync_timeout_alarm = 0;
+    vsync_armed = false;
+
+    critical_section_deinit(&queue_lock);
+
+    DRV_LOG("deinitializing serial connection");
+    spi_deinit(serial);
+
+    DRV_LOG("deinitializing GPIO pins");
+    gpio_set_outover(ST7789V_PIN_CS, GPIO_OVERRIDE_NORMAL);
+    gpio_set_outover(ST7789V_PIN_DC, GPIO_OVERRIDE_NORMAL);
+
+    gpio_deinit(ST7789V_PIN_CS);
+    gpio_deinit(ST7789V_PIN_TE);
+
+    gpio_set_function(ST7789V_PIN_CS,   GPIO_FUNC_NULL);
+    gpio_set_function(ST7789V_PIN_MISO, GPIO_FUNC_NULL);
+    gpio_set_function(ST7789V_PIN_MOSI, GPIO_FUNC_NULL);
+    gpio_set_function(ST7789V_PIN_SCK,  GPIO_FUNC_NULL);
+
+    return 0x00;
+}
+
+void st7789v_bus_wait(st7789v_bus_wait_t wait) {
+    mutex_t *lock = wait == ST7789V_BUS_WAIT_RESET ? &reset_lock : &sleep_lock;
+
+    mutex_enter_blocking(lock);
+    mutex_enter_blocking(&sleep_switch_state_lock);
+
+    add_alarm_in_ms(/* time_ms: */   5, unlock_mutex_alarm_callback, lock, true);
+    add_alarm_in_ms(/* time_ms: */ 120, unlock_mutex_alarm_callback, &sleep_switch_state_lock, true);
+}
+
+bool st7789v_bus_can_switch_sleep(void) {
+    return sleep_switch_state_lock.owner == LOCK_INVALID_OWNER_ID;
+}
+
+void st7789v_bus_set_vsync(bool enable) {
+    vsync_enabled = enable;
+
+    if (!enable) {
+        // Nothing should stay waiting for a line that was turned off
+        st7789v_vsync_release();
+    }
+}
@@ -0,0 +1,611 @@
+#include "st7789v.h"
+#include "st7789v_bus.h"
+#include "st7789v_sim.h"
+#include <errno.h>
+#include <pico/sem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <util/log.h>
+#include <util/types.h>
+
+#ifndef ST7789V_LOG_LEVEL
+#   define ST7789V_LOG_LEVEL LOG_LEVEL
+#endif
+
+#define SIM_LOG(...) LOG_AT(ST7789V_LOG_LEVEL, LOG_LEVEL_INFO, "st7789v-sim", __VA_ARGS__)
+
+/**
+ * The bits of the memory access control, and of the interface format in the pixel format
+ */
+#define SIM_MADCTL_MY       0x80
+#define SIM_MADCTL_MX       0x40
+#define SIM_MADCTL_MV       0x20
+#define SIM_MADCTL_BGR      0x08
+#define SIM_COLMOD_FORMAT   0x07
+
+bool st7789v_plugged = false;
+
+//////////////////////////////////////////////////////////////// Panel state
+
+/**
+ * The display memory, RGB565 by gate line and source column (like the panel in portrait)
+ */
+internal uint16_t gram[ST7789V_DISPLAY_HEIGHT][ST7789V_DISPLAY_WIDTH];
+
+/**
+ * If DC is low, the bytes of `st7789v_write_sync` are commands
+ */
+internal bool dc_command = false;
+internal bool comm_reading = false;
+
+/**
+ * The last command, and the parameters received for it
+ */
+internal byte command = COMMAND_NO_OPERATION;
+internal byte parameters[ST7789V_QUEUE_INLINE_SIZE];
+internal uint8_t parameter_count = 0;
+
+/**
+ * The data bits received, waiting to make a parameter byte or a pixel
+ */
+internal uint64_t pending_bits = 0;
+internal uint8_t pending_count = 0;
+
+internal uint16_t column_start = 0, column_end = ST7789V_DISPLAY_WIDTH - 1;
+internal uint16_t row_start = 0,    row_end = ST7789V_DISPLAY_HEIGHT - 1;
+
+/**
+ * The address counter of the memory writes and reads
+ */
+internal uint16_t column = 0, row = 0;
+
+internal byte madctl = 0x00;
+
+/**
+ * The driver assumes 16 bits per pixel until `st7789v_display_set_pixel_format`, so the
+ * simulation starts there too
+ */
+internal byte colmod = 0x55;
+
+internal uint16_t top_fixed_area = 0;
+internal uint16_t scroll_area = ST7789V_DISPLAY_HEIGHT;
+internal uint16_t scroll_start = 0;
+
+internal bool inverted = false;
+internal bool vsync_enabled = false;
+
+/**
+ * The bytes the next reads get, then the pixels of a memory read
+ */
+internal byte response[4];
+internal uint8_t response_size = 0;
+internal uint8_t response_index = 0;
+internal uint8_t read_part = 0;
+internal uint16_t read_pixel = 0;
+
+//////////////////////////////////////////////////////////////// Statistics
+
+internal st7789v_sim_stats_t stats;
+
+/**
+ * The bits clocked at each rate, `stats.bus_us` is computed from them
+ */
+internal uint64_t writing_bits = 0;
+internal uint64_t reading_bits = 0;
+
+internal void sim_clock(uint32_t bits) {
+    stats.bits += bits;
+
+    if (comm_reading) {
+        reading_bits += bits;
+    } else {
+        writing_bits += bits;
+    }
+}
+
+/******************** PANEL *************************/
+
+internal force_inline bool sim_memory_writing(void) {
+    return command == COMMAND_MEMORY_WRITE || command == COMMAND_MEMORY_WRITE_CONTINUE;
+}
+
+internal force_inline bool sim_memory_reading(void) {
+    return command == COMMAND_MEMORY_READ || command == COMMAND_MEMORY_READ_CONTINUE;
+}
+
+/**
+ * The memory of the address counter: the addresses are mirrored by MX and MY in the
+ * ranges of the windows (exchanged by MV), then exchanged
+ */
+internal uint16_t *sim_address(void) {
+    bool exchanged = madctl & SIM_MADCTL_MV;
+    uint16_t columns = exchanged ? ST7789V_DISPLAY_HEIGHT : ST7789V_DISPLAY_WIDTH;
+    uint16_t rows = exchanged ? ST7789V_DISPLAY_WIDTH : ST7789V_DISPLAY_HEIGHT;
+
+    if (column >= columns || row >= rows) {
+        return NULL;
+    }
+
+    uint16_t x = madctl & SIM_MADCTL_MX ? columns - 1 - column : column;
+    uint16_t y = madctl & SIM_MADCTL_MY ? rows - 1 - row : row;
+
+    return exchanged ? &gram[x][y] : &gram[y][x];
+}
+
+internal void sim_advance(void) {
+    if (++column > column_end) {
+        column = column_start;
+
+        if (++row > row_end) {
+            row = row_start;
+        }
+    }
+}
+
+internal uint8_t sim_pixel_bits(void) {
+    switch (colmod & SIM_COLMOD_FORMAT) {
+    case COLOR_FORMAT_12BPP:
+        return 12;
+
+    case COLOR_FORMAT_16BPP:
+        return 16;
+
+    default:
+        // 18 bits per pixel are sent as three bytes
+        return 24;
+    }
+}
+
+internal void sim_write_pixel(uint32_t value) {
+    uint16_t color;
+
+    switch (sim_pixel_bits()) {
+    case 12: {
+        uint16_t red = (value >> 8) & 0xF, green = (value >> 4) & 0xF, blue = value & 0xF;
+
+        color = (red << 12 | (red >> 3) << 11) | (green << 7 | (green >> 2) << 5) | (blue << 1 | blue >> 3);
+        break;
+    }
+
+    case 16:
+        color = value;
+        break;
+
+    default:
+        color = ((value >> 19) & 0x1F) << 11 | ((value >> 10) & 0x3F) << 5 | ((value >> 3) & 0x1F);
+        break;
+    }
+
+    uint16_t *address = sim_address();
+
+    if (address != NULL) {
+        *address = color;
+    }
+
+    stats.pixels++;
+
+    sim_advance();
+}
+
+internal void sim_parameter(byte value) {
+    stats.parameter_bytes++;
+
+    if (parameter_count < sizeof(parameters)) {
+        parameters[parameter_count++] = value;
+    }
+
+    uint16_t first = parameters[0] << 8 | parameters[1];
+    uint16_t second = parameters[2] << 8 | parameters[3];
+
+    switch (command) {
+    case COMMAND_COLUMN_ADDRESS_SET:
+        if (parameter_count == 4) {
+            column_start = first;
+            column_end = second;
+        }
+        break;
+
+    case COMMAND_ROW_ADDRESS_SET:
+        if (parameter_count == 4) {
+            row_start = first;
+            row_end = second;
+        }
+        break;
+
+    case COMMAND_MEMORY_ACCESS_CONTROL:
+        madctl = value;
+        break;
+
+    case COMMAND_COLOR_PIXEL_FORMAT:
+        colmod = value;
+        break;
+
+    case COMMAND_VERTICAL_SCROLLING_DEFINITION:
+        if (parameter_count == 6) {
+            top_fixed_area = first;
+            scroll_area = second;
+        }
+        break;
+
+    case COMMAND_VERTICAL_SCROLL_START_ADDRESS:
+        if (parameter_count == 2) {
+            scroll_start = first;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+internal void sim_respond(const byte *bytes, uint8_t size) {
+    memcpy(response, bytes, size);
+
+    response_size = size;
+    response_index = 0;
+}
+
+internal void sim_reset(void) {
+    column_start = 0;
+    column_end = ST7789V_DISPLAY_WIDTH - 1;
+    row_start = 0;
+    row_end = ST7789V_DISPLAY_HEIGHT - 1;
+
+    madctl = 0x00;
+    top_fixed_area = 0;
+    scroll_area = ST7789V_DISPLAY_HEIGHT;
+    scroll_start = 0;
+
+    inverted = false;
+}
+
+internal void sim_command(byte value) {
+    command = value;
+    parameter_count = 0;
+    pending_count = 0;
+    response_size = 0;
+
+    stats.commands++;
+
+    switch (value) {
+    case COMMAND_SOFTWARE_RESET:
+        sim_reset();
+        break;
+
+    case COMMAND_READ_DISPLAY_ID:
+        sim_respond(
+            (const byte[]) { (ST7789V_DISPLAY_ID >> 16) & 0xFF, (ST7789V_DISPLAY_ID >> 8) & 0xFF, ST7789V_DISPLAY_ID & 0xFF },
+            3
+        );
+        break;
+
+    case COMMAND_READ_DISPLAY_MEMORY_ACCESS_CONTROL:
+        sim_respond(&madctl, 1);
+        break;
+
+    case COMMAND_READ_DISPLAY_COLOR_PIXEL_FORMAT:
+        sim_respond(&colmod, 1);
+        break;
+
+    case COMMAND_MEMORY_WRITE:
+        column = column_start;
+        row = row_start;
+        break;
+
+    case COMMAND_MEMORY_READ:
+    case COMMAND_MEMORY_READ_CONTINUE:
+        if (value == COMMAND_MEMORY_READ) {
+            column = column_start;
+            row = row_start;
+        }
+
+        // The pixels come after a dummy byte
+        sim_respond((const byte[]) { 0x00 }, 1);
+        read_part = 0;
+        break;
+
+    case COMMAND_DISPLAY_INVERSION_ON:
+    case COMMAND_DISPLAY_INVERSION_OFF:
+        inverted = value == COMMAND_DISPLAY_INVERSION_ON;
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * Receive a frame of the SPI, pixels can be split across frames (three 8-bit frames for
+ * two 12-bit pixels) so the data bits are regrouped
+ */
+internal void sim_receive(uint32_t value, uint8_t bits, bool is_command) {
+    sim_clock(bits);
+
+    if (is_command) {
+        sim_command(value & 0xFF);
+
+        return;
+    }
+
+    uint8_t unit = sim_memory_writing() ? sim_pixel_bits() : 8;
+
+    pending_bits = (pending_bits << bits) | (value & ((1u << bits) - 1));
+    pending_count += bits;
+
+    while (pending_count >= unit) {
+        pending_count -= unit;
+
+        uint32_t data = (pending_bits >> pending_count) & ((1u << unit) - 1);
+
+        if (sim_memory_writing()) {
+            sim_write_pixel(data);
+        } else {
+            sim_parameter(data);
+        }
+    }
+
+    pending_bits &= ((uint64_t) 1 << pending_count) - 1;
+}
+
+internal byte sim_read(void) {
+    sim_clock(8);
+
+    if (response_index < response_size) {
+        return response[response_index++];
+    }
+
+    if (!sim_memory_reading()) {
+        return 0x00;
+    }
+
+    // The memory is read back as RGB666, a byte per component in the high bits
+    if (read_part == 0) {
+        uint16_t *address = sim_address();
+
+        read_pixel = address != NULL ? *address : 0x0000;
+
+        sim_advance();
+    }
+
+    byte component;
+
+    switch (read_part) {
+    case 0:  component = (read_pixel >> 11) << 3; break;
+    case 1:  component = ((read_pixel >> 5) & 0x3F) << 2; break;
+    default: component = (read_pixel & 0x1F) << 3; break;
+    }
+
+    read_part = (read_part + 1) % 3;
+
+    return component;
+}
+
+/******************** BACKEND *************************/
+
+error_t st7789v_init(void) {
+    memset(&stats, 0, sizeof(stats));
+    writing_bits = reading_bits = 0;
+
+    sim_reset();
+
+    colmod = 0x55;
+    vsync_enabled = false;
+    st7789v_plugged = true;
+
+    SIM_LOG("simulating a %dx%d display in memory", ST7789V_DISPLAY_WIDTH, ST7789V_DISPLAY_HEIGHT);
+    SIM_LOG("  writing: %d baud rate", ST7789V_WRITING_BAUDRATE);
+
+    // The same as the hardware's initialization, so it's counted the same
+    st7789v_display_software_reset(false);
+
+    if (st7789v_display_read_id() != ST7789V_DISPLAY_ID) {
+        st7789v_plugged = false;
+
+        return -ENODISPLAYCONNECTED;
+    }
+
+    return 0x00;
+}
+
+error_t st7789v_deinit(void) {
+    st7789v_plugged = false;
+
+    return 0x00;
+}
+
+error_t st7789v_begin_comm(void) {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    return 0x00;
+}
+
+error_t st7789v_begin_read_comm(void) {
+    error_t error = st7789v_begin_comm();
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    comm_reading = true;
+
+    return 0x00;
+}
+
+error_t st7789v_end_comm(void) {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    comm_reading = false;
+
+    return 0x00;
+}
+
+void st7789v_begin_command(void) {
+    dc_command = true;
+}
+
+void st7789v_end_command(void) {
+    dc_command = false;
+}
+
+error_t st7789v_write_sync(byte *buffer, size_t size) {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    for (size_t index = 0; index < size; index++) {
+        sim_receive(buffer[index], 8, dc_command);
+    }
+
+    return 0x00;
+}
+
+error_t st7789v_read_sync(byte *buffer, size_t size) {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    for (size_t index = 0; index < size; index++) {
+        buffer[index] = sim_read();
+    }
+
+    return 0x00;
+}
+
+/**
+ * The entries are sent right away, so the queue is never busy and the completion signals
+ * are released before this returns
+ */
+error_t st7789v_queue_submit(const st7789v_queue_entry_t *entry) {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    const byte *data = entry->buffer != NULL ? entry->buffer : entry->inline_data;
+    size_t value_size = (size_t) 1 << entry->data_size;
+    size_t ring = entry->read_ring_bits != 0 ? ((size_t) 1 << entry->read_ring_bits) - 1 : SIZE_MAX;
+    uint8_t bits = entry->frame_bits != 0 ? entry->frame_bits : 8;
+
+    for (size_t index = 0; index < entry->size; index++) {
+        size_t offset = entry->repeat ? 0 : (index * value_size) & ring;
+        uint32_t value = 0;
+
+        // Values are read in the CPU's order, like the DMA does
+        memcpy(&value, &data[offset], value_size);
+
+        sim_receive(value, bits, entry->command);
+    }
+
+    if (entry->completion_signal != NULL) {
+        sem_release(entry->completion_signal);
+    }
+
+    return 0x00;
+}
+
+error_t st7789v_queue_try_submit(const st7789v_queue_entry_t *entry) {
+    return st7789v_queue_submit(entry);
+}
+
+error_t st7789v_queue_vsync(uint16_t scanline) {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    // There's no scan to wait for, but the scanline is sent like on the hardware
+    if (!vsync_enabled) {
+        return 0x00;
+    }
+
+    return st7789v_display_set_tear_scanline(scanline);
+}
+
+error_t st7789v_sync_dma_operation(void) {
+    if (!st7789v_plugged) {
+        return -ENODISPLAYCONNECTED;
+    }
+
+    return 0x00;
+}
+
+void st7789v_bus_wait(st7789v_bus_wait_t wait) {
+    // Nothing takes time in the simulation
+    (void) wait;
+}
+
+bool st7789v_bus_can_switch_sleep(void) {
+    return true;
+}
+
+void st7789v_bus_set_vsync(bool enable) {
+    vsync_enabled = enable;
+}
+
+void st7789v_dummy_cycle(void) {
+    sim_clock(1);
+}
+
+/******************** SIMULATION *************************/
+
+void st7789v_sim_get_stats(st7789v_sim_stats_t *result) {
+    *result = stats;
+
+    // The only divisions, so the counters stay exact
+    result->bus_us = writing_bits * 1000000 / ST7789V_WRITING_BAUDRATE + reading_bits * 1000000 / ST7789V_READING_BAUDRATE;
+}
+
+void st7789v_sim_reset_stats(void) {
+    memset(&stats, 0, sizeof(stats));
+
+    writing_bits = reading_bits = 0;
+}
+
+error_t st7789v_sim_write_ppm(const char *path) {
+    FILE *file = fopen(path, "wb");
+
+    if (file == NULL) {
+        return -EUNAVAILABLE;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", ST7789V_DISPLAY_WIDTH, ST7789V_DISPLAY_HEIGHT);
+
+    for (uint16_t line = 0; line < ST7789V_DISPLAY_HEIGHT; line++) {
+        uint16_t memory_line = line;
+
+        // The lines of the scrolling area are shown from the scroll start, wrapping around it
+        if (scroll_area > 0 && line >= top_fixed_area && line < top_fixed_area + scroll_area) {
+            int32_t offset = ((int32_t) line - top_fixed_area + scroll_start - top_fixed_area) % scroll_area;
+
+            memory_line = top_fixed_area + (offset < 0 ? offset + scroll_area : offset);
+        }
+
+        for (uint16_t source = 0; source < ST7789V_DISPLAY_WIDTH; source++) {
+            uint16_t color = gram[memory_line][source];
+
+            if (inverted) {
+                color = ~color;
+            }
+
+            byte red = ((color >> 11) & 0x1F) << 3;
+            byte green = ((color >> 5) & 0x3F) << 2;
+            byte blue = (color & 0x1F) << 3;
+
+            if (madctl & SIM_MADCTL_BGR) {
+                byte swap = red;
+
+                red = blue;
+                blue = swap;
+            }
+
+            fputc(red, file);
+            fputc(green, file);
+            fputc(blue, file);
+        }
+    }
+
+    return fclose(file) == 0 ? 0x00 : -EUNAVAILABLE;
+}
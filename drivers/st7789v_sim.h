@@ -0,0 +1,45 @@
+#ifndef DRIVERS_ST7789V_SIM_H
+#define DRIVERS_ST7789V_SIM_H
+
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+#include <errno.h>
+
+/**
+ * The simulated display of the host builds (see st7789v_bus.h): everything the driver sends
+ * is interpreted like the panel would, into an in-memory copy of its memory, and counted.
+ */
+
+/**
+ * What was sent to the simulated display since the last `st7789v_sim_reset_stats`
+ */
+typedef struct st7789v_sim_stats_t
+{
+    uint32_t    commands;
+    uint64_t    parameter_bytes;
+    uint64_t    pixels;
+
+    /** Every bit clocked on the bus, commands, parameters, pixels and reads */
+    uint64_t    bits;
+
+    /**
+     * How long the bus would take to clock them, in microseconds, at
+     * `ST7789V_WRITING_BAUDRATE` (and `ST7789V_READING_BAUDRATE` in the reading communications)
+     */
+    uint64_t    bus_us;
+} st7789v_sim_stats_t;
+
+external void st7789v_sim_get_stats(st7789v_sim_stats_t *stats);
+
+external void st7789v_sim_reset_stats(void);
+
+/**
+ * Save what the panel shows (the display memory seen through the scroll) as a binary PPM
+ *
+ * RETURN VALUE
+ * - EUNAVAILABLE: if the file can't be written
+ */
+external error_t st7789v_sim_write_ppm(const char *path);
+
+#endif /** DRIVERS_ST7789V_SIM_H */
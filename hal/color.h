@@ -0,0 +1,50 @@
+#ifndef HAL_COLOR_H
+#define HAL_COLOR_H
+
+#include <stdint.h>
+#include <util/util.h>
+
+/**
+ * An RGB565 color, in the CPU's byte order (R in the 5 most significant bits), this is what
+ * the framebuffers and the renderer send to the display as is.
+ *
+ * When the display is in the 12 bits per pixel format, use RGB444 colors (`COLOR_RGB444`)
+ * instead, only the low 12 bits of each color are sent.
+ */
+typedef uint16_t color_t;
+
+/**
+ * Build an RGB565 color from 8-bit channels
+ */
+#define COLOR_RGB(r, g, b) \
+    ((color_t) ((((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | (((b) & 0xF8) >> 3)))
+
+/**
+ * Build an RGB444 color (0x0RGB) from 8-bit channels
+ */
+#define COLOR_RGB444(r, g, b) \
+    ((color_t) ((((r) & 0xF0) << 4) | ((g) & 0xF0) | (((b) & 0xF0) >> 4)))
+
+#define COLOR_BLACK     COLOR_RGB(0x00, 0x00, 0x00)
+#define COLOR_WHITE     COLOR_RGB(0xFF, 0xFF, 0xFF)
+#define COLOR_RED       COLOR_RGB(0xFF, 0x00, 0x00)
+#define COLOR_GREEN     COLOR_RGB(0x00, 0xFF, 0x00)
+#define COLOR_BLUE      COLOR_RGB(0x00, 0x00, 0xFF)
+
+/**
+ * Convert an RGB565 color to RGB444
+ */
+static force_inline color_t color_to_rgb444(color_t color) {
+    return (color_t) (((color >> 4) & 0xF00) | ((color >> 3) & 0x0F0) | ((color >> 1) & 0x00F));
+}
+
+/**
+ * Convert a color to the display's byte order (MSB first), when stored in memory as an
+ * `uint16_t` the bytes are sent in the order the display expects. Only needed for buffers
+ * sent with the byte APIs, like `st7789v_display_memory_write_async`.
+ */
+static force_inline color_t color_to_panel(color_t color) {
+    return (color_t) ((color << 8) | (color >> 8));
+}
+
+#endif /** HAL_COLOR_H */
@@ -0,0 +1,123 @@
+#include "console.h"
+#include <drivers/st7789v.h>
+#include <stdbool.h>
+#include <util/log.h>
+#include <util/types.h>
+
+#ifndef CONSOLE_LOG_LEVEL
+#   define CONSOLE_LOG_LEVEL LOG_LEVEL
+#endif
+
+#define CONSOLE_LOG(...) LOG_AT(CONSOLE_LOG_LEVEL, LOG_LEVEL_INFO, "console", __VA_ARGS__)
+
+/**
+ * Send the line buffer to a row of the display memory, and clear it once it's sent
+ */
+internal error_t console_write_line(console_t *console, uint16_t row) {
+    console->line.y = row;
+
+    framebuffer_mark_dirty(&console->line, 0, 0, console->line.width, console->line.height);
+
+    error_t error = framebuffer_flush(&console->line);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    framebuffer_wait(&console->line);
+
+    // Clear it without marking it dirty, the next line is marked as a whole anyway
+    framebuffer_fill_rect(&console->line, 0, 0, console->line.width, console->line.height, console->background);
+
+    console->line.dirty_count = 0;
+
+    return 0x00;
+}
+
+error_t console_init(
+    console_t *console,
+    color_t *line_pixels,
+    uint16_t top,
+    uint16_t height,
+    uint16_t line_height,
+    color_t background
+) {
+    if (line_height == 0 || height == 0 || height % line_height != 0 || top + height > ST7789V_DISPLAY_HEIGHT) {
+        return -ENOTINRANGE;
+    }
+
+    console->top = top;
+    console->height = height;
+    console->line_height = line_height;
+    console->background = background;
+
+    error_t error = framebuffer_init(&console->line, line_pixels, 0, top, ST7789V_DISPLAY_WIDTH, line_height);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    error = st7789v_display_set_vertical_scrolling_parameters(
+        /*          top_fixed_area: */ top,
+        /* vertical_scrolling_area: */ height,
+        /*       bottom_fixed_area: */ ST7789V_DISPLAY_HEIGHT - top - height
+    );
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    return console_clear(console);
+}
+
+error_t console_push_line(console_t *console) {
+    // The oldest line is the one at the top of the pane, once the scroll start moves past it,
+    // it's shown at the bottom
+    error_t error = console_write_line(console, console->scroll);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    console->scroll += console->line_height;
+
+    if (console->scroll >= console->top + console->height) {
+        console->scroll = console->top;
+    }
+
+    return st7789v_display_set_vertical_scrolling_start_address(console->scroll);
+}
+
+error_t console_clear(console_t *console) {
+    framebuffer_wait(&console->line);
+
+    framebuffer_fill_rect(&console->line, 0, 0, console->line.width, console->line.height, console->background);
+
+    console->line.dirty_count = 0;
+
+    error_t error = st7789v_display_fill_rect(0, console->top, ST7789V_DISPLAY_WIDTH, console->height, console->background);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    console->scroll = console->top;
+
+    return st7789v_display_set_vertical_scrolling_start_address(console->scroll);
+}
+
+error_t console_deinit(console_t *console) {
+    framebuffer_wait(&console->line);
+
+    error_t error = st7789v_display_set_vertical_scrolling_parameters(
+        /*          top_fixed_area: */ 0,
+        /* vertical_scrolling_area: */ ST7789V_DISPLAY_HEIGHT,
+        /*       bottom_fixed_area: */ 0
+    );
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    return st7789v_display_set_vertical_scrolling_start_address(0);
+}
@@ -0,0 +1,114 @@
+#ifndef HAL_CONSOLE_H
+#define HAL_CONSOLE_H
+
+#include <hal/color.h>
+#include <hal/framebuffer.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+#include <errno.h>
+
+/**
+ * A scrolling pane of lines (like the calculator history), scrolled by the display itself.
+ *
+ * The pane is the display's vertical scrolling area (VSCRDEF), and the display memory of the
+ * pane is used as a ring of lines: appending a line only writes that line over the oldest one
+ * (the one at the top of the pane) and moves the scroll start (VSCSAD) past it, so the new
+ * line shows up at the bottom and everything else moves up without being sent again.
+ *
+ * The rows of the display above and below the pane are not scrolled. The console talks to the
+ * display driver, so only use it from the display core.
+ */
+typedef struct console_t
+{
+    /**
+     * The first row of the display memory of the pane, and how many rows it has (a multiple
+     * of `line_height`)
+     */
+    uint16_t        top;
+    uint16_t        height;
+
+    uint16_t        line_height;
+
+    /**
+     * The row of the display memory shown at the top of the pane, this is where the next
+     * line is written
+     */
+    uint16_t        scroll;
+
+    color_t         background;
+
+    /**
+     * Where the next line is drawn, it's `ST7789V_DISPLAY_WIDTH * line_height` pixels, draw
+     * into it with the framebuffer functions and append it with `console_push_line`.
+     */
+    framebuffer_t   line;
+} console_t;
+
+/**
+ * Initialize a console, set up the display's scrolling area and clear it
+ *
+ * PARAMETERS
+ * - console: the console to initialize
+ * - line_pixels: the memory for the next line, `ST7789V_DISPLAY_WIDTH * line_height` colors
+ * - top, height: the rows of the display the pane is in
+ * - line_height: the height of each line
+ * - background: the color of empty lines
+ *
+ * NOTES
+ * - The display only has one scrolling area, so only one console can be used at a time.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ * - ENOTINRANGE: if the pane doesn't fit in the display, or its height isn't a multiple of `line_height`
+ */
+external error_t console_init(
+    console_t *console,
+    color_t *line_pixels,
+    uint16_t top,
+    uint16_t height,
+    uint16_t line_height,
+    color_t background
+);
+
+/**
+ * Append the line drawn into `console->line` at the bottom of the pane, scrolling the other
+ * lines up by one, and clear `console->line` for the next one.
+ *
+ * PARAMETERS
+ * - console: the console to append to
+ *
+ * NOTES
+ * - Only the new line is sent to the display, plus the scroll start address.
+ * - This waits the line to be sent before clearing it, so it's ready to be drawn into when
+ *   this returns.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ */
+external error_t console_push_line(console_t *console);
+
+/**
+ * Clear the pane and go back to the start
+ *
+ * PARAMETERS
+ * - console: the console to clear
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ */
+external error_t console_clear(console_t *console);
+
+/**
+ * Stop scrolling the pane, the display goes back to showing its memory as is
+ *
+ * PARAMETERS
+ * - console: the console to stop using
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ */
+external error_t console_deinit(console_t *console);
+
+#endif /** HAL_CONSOLE_H */
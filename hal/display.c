@@ -0,0 +1,197 @@
+#include "display.h"
+#include <drivers/st7789v.h>
+#include <hardware/sync.h>
+#if PICO_ON_DEVICE
+#   include <pico/flash.h>
+#   include <pico/multicore.h>
+#endif
+#include <pico/sem.h>
+#include <pico/time.h>
+#include <stdbool.h>
+#include <util/log.h>
+#include <util/spsc.h>
+#include <util/trace.h>
+#include <util/types.h>
+
+#ifndef DISPLAY_LOG_LEVEL
+#   define DISPLAY_LOG_LEVEL LOG_LEVEL
+#endif
+
+#define DISPLAY_LOG(...) LOG_AT(DISPLAY_LOG_LEVEL, LOG_LEVEL_INFO, "display", __VA_ARGS__)
+
+#if PICO_ON_DEVICE
+/**
+ * Core 0 is the only producer and core 1 the only consumer
+ */
+internal display_job_t job_storage[DISPLAY_JOB_QUEUE_SIZE];
+internal spsc_queue_t jobs;
+#endif
+
+internal void display_job_run(const display_job_t *job) {
+    error_t error = 0x00;
+
+    TRACE_BEGIN(TRACE_SPAN_DISPLAY_JOB);
+
+    switch (job->type) {
+    case DISPLAY_JOB_DRAW_LIST: {
+        TRACE_BEGIN(TRACE_SPAN_RENDER_LIST);
+        error = render_list_draw(job->draw.list, job->draw.x, job->draw.y, job->draw.width, job->draw.height);
+        TRACE_END(TRACE_SPAN_RENDER_LIST);
+        break;
+    }
+
+    case DISPLAY_JOB_FLUSH_FRAMEBUFFER: {
+        // Until the framebuffer was sent, the DMA included
+        TRACE_BEGIN(TRACE_SPAN_FRAMEBUFFER_FLUSH);
+        error = framebuffer_flush(job->framebuffer);
+
+        // The DMA reads straight from the framebuffer, so it's only free when it was sent
+        framebuffer_wait(job->framebuffer);
+        TRACE_END(TRACE_SPAN_FRAMEBUFFER_FLUSH);
+        break;
+    }
+
+    case DISPLAY_JOB_CALL:
+        job->call.function(job->call.data);
+        break;
+
+    case DISPLAY_JOB_SYNC:
+        st7789v_sync_dma_operation();
+        break;
+    }
+
+    if (error != 0x00) {
+        DISPLAY_LOG("job %d failed: %d", job->type, error);
+    }
+
+    TRACE_END(TRACE_SPAN_DISPLAY_JOB);
+
+    if (job->completion_signal != NULL) {
+        sem_release(job->completion_signal);
+    }
+}
+
+#if PICO_ON_DEVICE
+internal void display_core_main(void) {
+    // Core 0 pauses this core while it writes the flash (see hal/store.h)
+    flash_safe_execute_core_init();
+
+    // The driver claims its DMA IRQ on the core that initializes it
+    error_t error = st7789v_init();
+    bool awake = error != 0x00;
+
+    multicore_fifo_push_blocking((uint32_t) error);
+
+    for (;;) {
+        display_job_t job;
+
+        // The display wakes up between the jobs, the alarm ending its delay wakes us up
+        if (!awake && st7789v_init_poll()) {
+            DISPLAY_LOG("display woken up %llu us after boot", (unsigned long long) time_us_64());
+
+            awake = true;
+        }
+
+        if (!spsc_queue_pop(&jobs, &job)) {
+            // Core 0 sends an event after queueing a job, and the DMA IRQ also wakes us up
+            __wfe();
+
+            continue;
+        }
+
+        // Core 0 can be waiting for a free slot
+        __sev();
+
+        display_job_run(&job);
+    }
+}
+
+void display_start(void) {
+    spsc_queue_init(&jobs, job_storage, sizeof(display_job_t), DISPLAY_JOB_QUEUE_SIZE);
+
+    multicore_launch_core1(display_core_main);
+}
+
+error_t display_wait_started(void) {
+    return (error_t) multicore_fifo_pop_blocking();
+}
+
+internal void display_core_deinit(void *data) {
+    (void) data;
+
+    st7789v_deinit();
+}
+
+void display_stop(void) {
+    semaphore_t done;
+
+    sem_init(&done, 0, 1);
+
+    display_submit(&(display_job_t) {
+        .type               = DISPLAY_JOB_CALL,
+        .call               = { display_core_deinit, NULL },
+        .completion_signal  = &done
+    });
+
+    sem_acquire_blocking(&done);
+
+    multicore_reset_core1();
+}
+
+bool display_try_submit(const display_job_t *job) {
+    if (!spsc_queue_push(&jobs, job)) {
+        return false;
+    }
+
+    __sev();
+
+    return true;
+}
+#else
+/**
+ * The host builds have a single thread and a simulated display (see st7789v_sim.c), the
+ * jobs are run as they are submitted
+ */
+internal error_t start_error;
+
+void display_start(void) {
+    start_error = st7789v_init();
+
+    // Nothing takes time in the simulation
+    while (start_error == 0x00 && !st7789v_init_poll());
+}
+
+error_t display_wait_started(void) {
+    return start_error;
+}
+
+void display_stop(void) {
+    st7789v_deinit();
+}
+
+bool display_try_submit(const display_job_t *job) {
+    display_job_run(job);
+
+    return true;
+}
+#endif
+
+void display_submit(const display_job_t *job) {
+    while (!display_try_submit(job)) {
+        // Core 1 sends an event every time it takes a job
+        __wfe();
+    }
+}
+
+void display_sync(void) {
+    semaphore_t done;
+
+    sem_init(&done, 0, 1);
+
+    display_submit(&(display_job_t) {
+        .type               = DISPLAY_JOB_SYNC,
+        .completion_signal  = &done
+    });
+
+    sem_acquire_blocking(&done);
+}
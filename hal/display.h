@@ -0,0 +1,157 @@
+#ifndef HAL_DISPLAY_H
+#define HAL_DISPLAY_H
+
+#include <hal/framebuffer.h>
+#include <hal/render.h>
+#include <pico/sem.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+#include <errno.h>
+
+/**
+ * The display pipeline runs on core 1: it owns the display driver (so the DMA IRQ is
+ * serviced there), rasterizes display lists and feeds the DMA. Core 0 is left for the input
+ * and the math, and hands work to core 1 through a lock-free job queue.
+ */
+
+/**
+ * How many jobs can wait for core 1, needs to be a power of two
+ */
+#define DISPLAY_JOB_QUEUE_SIZE  16
+
+/**
+ * The kind of a display job
+ */
+typedef enum display_job_type_t: byte
+{
+    /** Rasterize a region of the display from a display list */
+    DISPLAY_JOB_DRAW_LIST           = 0x00,
+
+    /** Send the dirty regions of a framebuffer */
+    DISPLAY_JOB_FLUSH_FRAMEBUFFER   = 0x01,
+
+    /** Call a function on core 1, for anything else that needs to talk to the display driver */
+    DISPLAY_JOB_CALL                = 0x02,
+
+    /** Wait everything queued before to be sent to the display */
+    DISPLAY_JOB_SYNC                = 0x03
+} display_job_type_t;
+
+/**
+ * A job for the display core
+ */
+typedef struct display_job_t
+{
+    display_job_type_t      type;
+
+    union {
+        struct {
+            const render_list_t *list;
+
+            uint16_t            x;
+            uint16_t            y;
+            uint16_t            width;
+            uint16_t            height;
+        } draw;
+
+        framebuffer_t           *framebuffer;
+
+        struct {
+            void                (*function)(void *data);
+            void                *data;
+        } call;
+    };
+
+    /**
+     * Released by core 1 when the memory of the job can be touched again by core 0: when a
+     * display list was rasterized, when the pixels of a framebuffer were sent or when the
+     * function was called.
+     *
+     * Can be NULL.
+     */
+    semaphore_t             *completion_signal;
+} display_job_t;
+
+/**
+ * Launch core 1 and initialize the display driver on it, without waiting for it: the rest
+ * of the startup runs meanwhile, and the display finishes waking up on core 1 in the
+ * background (its reset and sleep out take more than 100ms)
+ */
+external void display_start(void);
+
+/**
+ * Wait until the display driver was initialized by `display_start`, jobs can be submitted
+ * after this (they are run while the display is still waking up)
+ *
+ * RETURN VALUE
+ * - the return value of `st7789v_init`, core 1 is running even if it failed
+ */
+external error_t display_wait_started(void);
+
+/**
+ * Deinitialize the display driver and stop core 1, everything queued is sent before
+ */
+external void display_stop(void);
+
+/**
+ * Queue a job to core 1, only call this from core 0
+ *
+ * NOTES
+ * - Waits if the job queue is full
+ */
+external void display_submit(const display_job_t *job);
+
+/**
+ * Queue a job to core 1 if there's space for it, only call this from core 0
+ *
+ * RETURN VALUE
+ * - false if the job queue is full
+ */
+external bool display_try_submit(const display_job_t *job);
+
+/**
+ * Wait every job queued before to finish, and its pixels to be sent to the display
+ */
+external void display_sync(void);
+
+/**
+ * Queue a display list to be drawn by core 1
+ *
+ * PARAMETERS
+ * - list: the display list, needs to be kept alive until `completion_signal` is released
+ * - x, y, width, height: the region of the display to draw
+ * - completion_signal: is released when the list was rasterized, can be NULL
+ */
+static force_inline void display_draw_list(
+    const render_list_t *list,
+    uint16_t x,
+    uint16_t y,
+    uint16_t width,
+    uint16_t height,
+    semaphore_t *completion_signal
+) {
+    display_submit(&(display_job_t) {
+        .type               = DISPLAY_JOB_DRAW_LIST,
+        .draw               = { list, x, y, width, height },
+        .completion_signal  = completion_signal
+    });
+}
+
+/**
+ * Queue a framebuffer to be flushed by core 1
+ *
+ * PARAMETERS
+ * - framebuffer: the framebuffer, don't draw into it until `completion_signal` is released
+ * - completion_signal: is released when the pixels were sent, can be NULL
+ */
+static force_inline void display_flush_framebuffer(framebuffer_t *framebuffer, semaphore_t *completion_signal) {
+    display_submit(&(display_job_t) {
+        .type               = DISPLAY_JOB_FLUSH_FRAMEBUFFER,
+        .framebuffer        = framebuffer,
+        .completion_signal  = completion_signal
+    });
+}
+
+#endif /** HAL_DISPLAY_H */
@@ -0,0 +1,59 @@
+#include "font.h"
+#include <assert.h>
+
+// The row and glyph macros below are written for this cell size
+static_assert(FONT_WIDTH == 9 && FONT_HEIGHT == 18, "the font macros need to be updated for the new cell size");
+
+#define FONT_PIXEL(row, column) \
+    ((((row) >> (FONT_WIDTH - 1 - (column))) & 1) ? FONT_FOREGROUND : FONT_BACKGROUND)
+
+#define FONT_ROW(row) \
+    FONT_PIXEL(row, 0), FONT_PIXEL(row, 1), FONT_PIXEL(row, 2), \
+    FONT_PIXEL(row, 3), FONT_PIXEL(row, 4), FONT_PIXEL(row, 5), \
+    FONT_PIXEL(row, 6), FONT_PIXEL(row, 7), FONT_PIXEL(row, 8)
+
+#define FONT_GLYPH(r0, r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11, r12, r13, r14, r15, r16, r17) \
+    {                                                                                               \
+        FONT_ROW(r0),  FONT_ROW(r1),  FONT_ROW(r2),  FONT_ROW(r3),  FONT_ROW(r4),  FONT_ROW(r5),     \
+        FONT_ROW(r6),  FONT_ROW(r7),  FONT_ROW(r8),  FONT_ROW(r9),  FONT_ROW(r10), FONT_ROW(r11),    \
+        FONT_ROW(r12), FONT_ROW(r13), FONT_ROW(r14), FONT_ROW(r15), FONT_ROW(r16), FONT_ROW(r17)     \
+    },
+
+const color_t font_atlas[FONT_GLYPH_COUNT][FONT_GLYPH_SIZE] = {
+#include "font_glyphs.h"
+};
+
+#undef FONT_GLYPH
+#undef FONT_ROW
+#undef FONT_PIXEL
+
+#define FONT_ALPHA_GLYPH(...) __VA_ARGS__,
+
+internal const byte regular_alpha[] = {
+#include "font_regular_alpha.h"
+};
+
+internal const byte small_alpha[] = {
+#include "font_small_alpha.h"
+};
+
+#undef FONT_ALPHA_GLYPH
+
+const font_t font_regular = {
+    .width      = FONT_WIDTH,
+    .height     = FONT_HEIGHT,
+    .baseline   = FONT_BASELINE,
+    .stride     = (FONT_WIDTH + 1) / 2,
+    .alpha      = regular_alpha
+};
+
+const font_t font_small = {
+    .width      = 6,
+    .height     = 12,
+    .baseline   = 9,
+    .stride     = 3,
+    .alpha      = small_alpha
+};
+
+static_assert(sizeof(regular_alpha) == FONT_GLYPH_COUNT * ((FONT_WIDTH + 1) / 2) * FONT_HEIGHT, "wrong regular font size");
+static_assert(sizeof(small_alpha) == FONT_GLYPH_COUNT * 3 * 12, "wrong small font size");
@@ -0,0 +1,108 @@
+#ifndef HAL_FONT_H
+#define HAL_FONT_H
+
+#include <hal/color.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+
+/**
+ * The size of each glyph cell, the font is monospaced
+ */
+#define FONT_WIDTH          9
+#define FONT_HEIGHT         18
+
+/**
+ * The row of the cell the glyphs sit on
+ */
+#define FONT_BASELINE       14
+
+/**
+ * The characters the font has, anything else is drawn as `FONT_FALLBACK_CHAR`
+ */
+#define FONT_FIRST_CHAR     ' '
+#define FONT_LAST_CHAR      '~'
+#define FONT_FALLBACK_CHAR  '?'
+
+#define FONT_GLYPH_COUNT    (FONT_LAST_CHAR - FONT_FIRST_CHAR + 1)
+#define FONT_GLYPH_SIZE     (FONT_WIDTH * FONT_HEIGHT)
+
+/**
+ * The colors the atlas is rasterized with, these are baked into the atlas when it's compiled
+ */
+#ifndef FONT_FOREGROUND
+#   define FONT_FOREGROUND  COLOR_WHITE
+#endif
+
+#ifndef FONT_BACKGROUND
+#   define FONT_BACKGROUND  COLOR_BLACK
+#endif
+
+/**
+ * The glyph atlas, `FONT_GLYPH_SIZE` pixels per glyph (row by row), already expanded to
+ * colors, so a glyph row can be copied straight into what is sent to the display.
+ *
+ * The atlas is generated by the compiler from the 1-bit glyphs in `hal/font_glyphs.h` and,
+ * as it's constant, it's kept in flash.
+ */
+external const color_t font_atlas[FONT_GLYPH_COUNT][FONT_GLYPH_SIZE];
+
+/**
+ * Get the glyph of a character in the atlas
+ */
+static force_inline const color_t *font_glyph(char character) {
+    if (character < FONT_FIRST_CHAR || character > FONT_LAST_CHAR) {
+        character = FONT_FALLBACK_CHAR;
+    }
+
+    return font_atlas[character - FONT_FIRST_CHAR];
+}
+
+/**
+ * An anti-aliased font, with the same characters as the atlas. Each pixel of a glyph is its
+ * coverage, from 0 (background) to 15 (foreground), they're blended against the background
+ * with a palette (see `text_palette_t`) when drawn.
+ */
+typedef struct font_t
+{
+    /**
+     * The size of each glyph cell, and the row of the cell the glyphs sit on
+     */
+    uint8_t     width;
+    uint8_t     height;
+    uint8_t     baseline;
+
+    /**
+     * How many bytes each row of a glyph has, two pixels per byte (the high nibble is the
+     * leftmost pixel)
+     */
+    uint8_t     stride;
+
+    /**
+     * The glyphs, `stride * height` bytes each
+     */
+    const byte  *alpha;
+} font_t;
+
+/**
+ * The anti-aliased version of the atlas font, same size
+ */
+external const font_t font_regular;
+
+/**
+ * A smaller anti-aliased font (6x12), for superscripts and fractions
+ */
+external const font_t font_small;
+
+/**
+ * Get the coverage of a character's glyph in an anti-aliased font
+ */
+static force_inline const byte *font_alpha_glyph(const font_t *font, char character) {
+    if (character < FONT_FIRST_CHAR || character > FONT_LAST_CHAR) {
+        character = FONT_FALLBACK_CHAR;
+    }
+
+    return &font->alpha[(character - FONT_FIRST_CHAR) * font->stride * font->height];
+}
+
+#endif /** HAL_FONT_H */
@@ -0,0 +1,106 @@
+/**
+ * The glyphs of the font, one `FONT_GLYPH` per character from `FONT_FIRST_CHAR` to
+ * `FONT_LAST_CHAR`, each with `FONT_HEIGHT` rows of `FONT_WIDTH` bits (the MSB is the leftmost
+ * pixel).
+ *
+ * Rasterized from DejaVu Sans Mono Bold at 15 pixels per em, with the baseline at row 14, by
+ * `tools/font_glyphs.py` (the pixels that are at least half covered).
+ *
+ * This file has no include guard, it's included with `FONT_GLYPH` defined to what each
+ * glyph should expand to.
+ */
+/* ' '  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000)
+/* '!'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x010, 0x018, 0x018, 0x018, 0x018, 0x010, 0x010, 0x010, 0x000, 0x018, 0x018, 0x000, 0x000, 0x000, 0x000)
+/* '"'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x06C, 0x06C, 0x06C, 0x06C, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000)
+/* '#'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x012, 0x036, 0x036, 0x0FF, 0x0FF, 0x06C, 0x06C, 0x1FE, 0x0D8, 0x0D8, 0x0D8, 0x000, 0x000, 0x000, 0x000)
+/* '$'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x010, 0x038, 0x07C, 0x0D0, 0x0D0, 0x078, 0x03E, 0x016, 0x016, 0x0FE, 0x07C, 0x010, 0x010, 0x000, 0x000)
+/* '%'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x0E0, 0x1B0, 0x1B0, 0x0E2, 0x018, 0x064, 0x00F, 0x019, 0x01B, 0x00E, 0x000, 0x000, 0x000, 0x000)
+/* '&'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x07C, 0x07C, 0x060, 0x060, 0x070, 0x0F0, 0x19B, 0x19F, 0x1CE, 0x0FE, 0x07F, 0x000, 0x000, 0x000, 0x000)
+/* '\'' */ FONT_GLYPH(0x000, 0x000, 0x000, 0x010, 0x010, 0x010, 0x010, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000)
+/* '('  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x008, 0x018, 0x010, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x018, 0x018, 0x00C, 0x000, 0x000)
+/* ')'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x030, 0x030, 0x010, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x030, 0x030, 0x020, 0x000, 0x000)
+/* '*'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x010, 0x092, 0x07C, 0x038, 0x0FE, 0x010, 0x010, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000)
+/* '+'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x010, 0x010, 0x010, 0x0FE, 0x1FF, 0x010, 0x010, 0x010, 0x000, 0x000, 0x000, 0x000, 0x000)
+/* ','  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x010, 0x038, 0x038, 0x030, 0x030, 0x000, 0x000)
+/* '-'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07C, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000)
+/* '.'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x018, 0x038, 0x038, 0x000, 0x000, 0x000, 0x000)
+/* '/'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x006, 0x006, 0x00C, 0x00C, 0x008, 0x018, 0x010, 0x030, 0x020, 0x060, 0x040, 0x0C0, 0x000, 0x000, 0x000)
+/* '0'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x038, 0x07C, 0x0C6, 0x0C6, 0x0C6, 0x0D6, 0x0C6, 0x0C6, 0x0C6, 0x07C, 0x07C, 0x000, 0x000, 0x000, 0x000)
+/* '1'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x078, 0x078, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x0FE, 0x0FE, 0x000, 0x000, 0x000, 0x000)
+/* '2'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0F8, 0x0FC, 0x00E, 0x006, 0x00C, 0x01C, 0x038, 0x070, 0x0E0, 0x0FE, 0x0FE, 0x000, 0x000, 0x000, 0x000)
+/* '3'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0FC, 0x0FE, 0x006, 0x006, 0x03C, 0x03C, 0x00E, 0x006, 0x006, 0x0FE, 0x0FC, 0x000, 0x000, 0x000, 0x000)
+/* '4'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x00C, 0x01C, 0x03C, 0x02C, 0x06C, 0x0CC, 0x0CC, 0x0FE, 0x0FE, 0x00C, 0x00C, 0x000, 0x000, 0x000, 0x000)
+/* '5'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0FC, 0x0FC, 0x0C0, 0x0C0, 0x0FC, 0x0FE, 0x006, 0x006, 0x006, 0x0FC, 0x0FC, 0x000, 0x000, 0x000, 0x000)
+/* '6'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x03C, 0x07E, 0x0E0, 0x0C0, 0x0FC, 0x0FE, 0x0C6, 0x0C6, 0x0C6, 0x07E, 0x07C, 0x000, 0x000, 0x000, 0x000)
+/* '7'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0FE, 0x0FE, 0x00E, 0x00C, 0x00C, 0x018, 0x018, 0x038, 0x030, 0x030, 0x060, 0x000, 0x000, 0x000, 0x000)
+/* '8'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x07C, 0x0FE, 0x0C6, 0x0C6, 0x07C, 0x07C, 0x0C6, 0x0C6, 0x0C6, 0x0FE, 0x07C, 0x000, 0x000, 0x000, 0x000)
+/* '9'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x078, 0x0FC, 0x0C6, 0x0C6, 0x0C6, 0x0EE, 0x07E, 0x006, 0x006, 0x05C, 0x078, 0x000, 0x000, 0x000, 0x000)
+/* ':'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x038, 0x038, 0x038, 0x000, 0x000, 0x018, 0x038, 0x038, 0x000, 0x000, 0x000, 0x000)
+/* ';'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x038, 0x038, 0x038, 0x000, 0x000, 0x018, 0x038, 0x038, 0x030, 0x030, 0x000, 0x000)
+/* '<'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x006, 0x03E, 0x0F0, 0x0C0, 0x0F8, 0x01E, 0x002, 0x000, 0x000, 0x000, 0x000, 0x000)
+/* '='  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0FE, 0x0FE, 0x000, 0x0FE, 0x0FE, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000)
+/* '>'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0C0, 0x0F8, 0x01E, 0x006, 0x03E, 0x0F0, 0x080, 0x000, 0x000, 0x000, 0x000, 0x000)
+/* '?'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x07C, 0x07E, 0x006, 0x00E, 0x01C, 0x018, 0x030, 0x030, 0x000, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000)
+/* '@'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x03C, 0x0E6, 0x0C2, 0x19F, 0x1B7, 0x1A3, 0x1A3, 0x1B7, 0x19F, 0x0C0, 0x0E2, 0x03E, 0x000, 0x000)
+/* 'A'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x038, 0x038, 0x038, 0x06C, 0x06C, 0x06C, 0x0FE, 0x0FE, 0x0C6, 0x0C6, 0x1C7, 0x000, 0x000, 0x000, 0x000)
+/* 'B'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0FC, 0x0FE, 0x0C6, 0x0C6, 0x0FC, 0x0FC, 0x0C6, 0x0C6, 0x0C6, 0x0FE, 0x0FC, 0x000, 0x000, 0x000, 0x000)
+/* 'C'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x03E, 0x07E, 0x060, 0x0E0, 0x0C0, 0x0C0, 0x0C0, 0x0E0, 0x060, 0x07E, 0x03E, 0x000, 0x000, 0x000, 0x000)
+/* 'D'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0F8, 0x0FC, 0x0CE, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0CE, 0x0FC, 0x0F8, 0x000, 0x000, 0x000, 0x000)
+/* 'E'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0FE, 0x0FE, 0x0C0, 0x0C0, 0x0FC, 0x0FE, 0x0E0, 0x0C0, 0x0C0, 0x0FE, 0x0FE, 0x000, 0x000, 0x000, 0x000)
+/* 'F'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0FE, 0x0FE, 0x0E0, 0x0E0, 0x0FE, 0x0FE, 0x0E0, 0x0E0, 0x0E0, 0x0E0, 0x0E0, 0x000, 0x000, 0x000, 0x000)
+/* 'G'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x03E, 0x07E, 0x0E0, 0x0C0, 0x0C0, 0x0CE, 0x0CE, 0x0C6, 0x0E6, 0x07E, 0x03E, 0x000, 0x000, 0x000, 0x000)
+/* 'H'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0FE, 0x0FE, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x000, 0x000, 0x000, 0x000)
+/* 'I'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0FE, 0x0FE, 0x038, 0x038, 0x038, 0x038, 0x038, 0x038, 0x038, 0x0FE, 0x0FE, 0x000, 0x000, 0x000, 0x000)
+/* 'J'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x03C, 0x03C, 0x00C, 0x00C, 0x00C, 0x00C, 0x00C, 0x00C, 0x00C, 0x0FC, 0x0F8, 0x000, 0x000, 0x000, 0x000)
+/* 'K'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0C6, 0x0CE, 0x0DC, 0x0D8, 0x0F8, 0x0F8, 0x0FC, 0x0CC, 0x0CE, 0x0C6, 0x0C7, 0x000, 0x000, 0x000, 0x000)
+/* 'L'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x060, 0x060, 0x060, 0x060, 0x060, 0x060, 0x060, 0x060, 0x060, 0x07E, 0x07E, 0x000, 0x000, 0x000, 0x000)
+/* 'M'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0C6, 0x0EE, 0x0EE, 0x0EE, 0x0FA, 0x0FA, 0x0DA, 0x0C2, 0x0C2, 0x0C2, 0x0C2, 0x000, 0x000, 0x000, 0x000)
+/* 'N'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0C6, 0x0E6, 0x0E6, 0x0F6, 0x0F6, 0x0D6, 0x0DE, 0x0DE, 0x0CE, 0x0CE, 0x0C6, 0x000, 0x000, 0x000, 0x000)
+/* 'O'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x07C, 0x07C, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0FE, 0x07C, 0x000, 0x000, 0x000, 0x000)
+/* 'P'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0FC, 0x0FE, 0x0C6, 0x0C6, 0x0C6, 0x0FE, 0x0FC, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x000, 0x000, 0x000, 0x000)
+/* 'Q'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x07C, 0x07C, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0FE, 0x07C, 0x00C, 0x004, 0x000, 0x000)
+/* 'R'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0FC, 0x0FE, 0x0C6, 0x0C6, 0x0CE, 0x0FC, 0x0FC, 0x0CC, 0x0CE, 0x0C6, 0x0C7, 0x000, 0x000, 0x000, 0x000)
+/* 'S'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x07C, 0x0FE, 0x0C0, 0x0C0, 0x0F0, 0x07C, 0x00E, 0x006, 0x006, 0x0FE, 0x0FC, 0x000, 0x000, 0x000, 0x000)
+/* 'T'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0FE, 0x0FE, 0x038, 0x038, 0x038, 0x038, 0x038, 0x038, 0x038, 0x038, 0x038, 0x000, 0x000, 0x000, 0x000)
+/* 'U'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0FE, 0x07C, 0x000, 0x000, 0x000, 0x000)
+/* 'V'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0E6, 0x06C, 0x06C, 0x06C, 0x07C, 0x038, 0x038, 0x000, 0x000, 0x000, 0x000)
+/* 'W'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x183, 0x183, 0x183, 0x19B, 0x0BB, 0x0BA, 0x0EE, 0x0EE, 0x0EE, 0x0EE, 0x0C6, 0x000, 0x000, 0x000, 0x000)
+/* 'X'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0C6, 0x0C6, 0x06C, 0x07C, 0x038, 0x038, 0x038, 0x07C, 0x06C, 0x0C6, 0x1C7, 0x000, 0x000, 0x000, 0x000)
+/* 'Y'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x1C7, 0x0C6, 0x0EE, 0x06C, 0x07C, 0x038, 0x038, 0x038, 0x038, 0x038, 0x038, 0x000, 0x000, 0x000, 0x000)
+/* 'Z'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0FE, 0x0FE, 0x00E, 0x00C, 0x01C, 0x038, 0x030, 0x060, 0x0E0, 0x0FE, 0x0FF, 0x000, 0x000, 0x000, 0x000)
+/* '['  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x03C, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x03C, 0x000, 0x000)
+/* '\\' */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0C0, 0x0C0, 0x060, 0x060, 0x030, 0x030, 0x010, 0x018, 0x008, 0x00C, 0x004, 0x006, 0x000, 0x000, 0x000)
+/* ']'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x078, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x078, 0x000, 0x000)
+/* '^'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x038, 0x07C, 0x06C, 0x0C6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000)
+/* '_'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FF, 0x1FF)
+/* '`'  */ FONT_GLYPH(0x000, 0x000, 0x060, 0x030, 0x010, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000)
+/* 'a'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07C, 0x046, 0x006, 0x0FE, 0x0E6, 0x0C6, 0x0EE, 0x07E, 0x000, 0x000, 0x000, 0x000)
+/* 'b'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0C0, 0x0C0, 0x0C0, 0x0FC, 0x0EE, 0x0C6, 0x0C6, 0x0C6, 0x0E6, 0x0FE, 0x0FC, 0x000, 0x000, 0x000, 0x000)
+/* 'c'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x03E, 0x072, 0x0E0, 0x0C0, 0x0C0, 0x0E0, 0x07E, 0x03E, 0x000, 0x000, 0x000, 0x000)
+/* 'd'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x006, 0x006, 0x006, 0x07E, 0x0EE, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0FE, 0x076, 0x000, 0x000, 0x000, 0x000)
+/* 'e'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07C, 0x0EE, 0x0C6, 0x0FE, 0x0FE, 0x0C0, 0x0FE, 0x07E, 0x000, 0x000, 0x000, 0x000)
+/* 'f'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x01E, 0x038, 0x038, 0x0FE, 0x038, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000)
+/* 'g'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07E, 0x0EE, 0x0C6, 0x0C6, 0x0C6, 0x0CE, 0x0FE, 0x076, 0x006, 0x07E, 0x07C, 0x000)
+/* 'h'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0C0, 0x0C0, 0x0C0, 0x0FC, 0x0EE, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x000, 0x000, 0x000, 0x000)
+/* 'i'  */ FONT_GLYPH(0x000, 0x000, 0x018, 0x018, 0x000, 0x000, 0x078, 0x038, 0x018, 0x018, 0x018, 0x018, 0x0FE, 0x0FF, 0x000, 0x000, 0x000, 0x000)
+/* 'j'  */ FONT_GLYPH(0x000, 0x000, 0x018, 0x018, 0x000, 0x000, 0x078, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x0F8, 0x0F0, 0x000)
+/* 'k'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0C0, 0x0C0, 0x0C0, 0x0CE, 0x0DC, 0x0F8, 0x0F8, 0x0FC, 0x0CC, 0x0C6, 0x0C6, 0x000, 0x000, 0x000, 0x000)
+/* 'l'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0F0, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x03E, 0x01E, 0x000, 0x000, 0x000, 0x000)
+/* 'm'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0FE, 0x0FE, 0x092, 0x092, 0x092, 0x092, 0x092, 0x092, 0x000, 0x000, 0x000, 0x000)
+/* 'n'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0FC, 0x0EE, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x000, 0x000, 0x000, 0x000)
+/* 'o'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07C, 0x0EE, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0FE, 0x07C, 0x000, 0x000, 0x000, 0x000)
+/* 'p'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0FC, 0x0EE, 0x0C6, 0x0C6, 0x0C6, 0x0E6, 0x0FE, 0x0FC, 0x0C0, 0x0C0, 0x0C0, 0x000)
+/* 'q'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07E, 0x0EE, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0FE, 0x076, 0x006, 0x006, 0x006, 0x000)
+/* 'r'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07E, 0x07A, 0x070, 0x060, 0x060, 0x060, 0x060, 0x060, 0x000, 0x000, 0x000, 0x000)
+/* 's'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07C, 0x0E4, 0x0E0, 0x07C, 0x03E, 0x006, 0x0CE, 0x07C, 0x000, 0x000, 0x000, 0x000)
+/* 't'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x030, 0x030, 0x030, 0x0FE, 0x030, 0x030, 0x030, 0x030, 0x030, 0x03E, 0x01E, 0x000, 0x000, 0x000, 0x000)
+/* 'u'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0CE, 0x0FE, 0x07E, 0x000, 0x000, 0x000, 0x000)
+/* 'v'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0C6, 0x0C6, 0x0E6, 0x06C, 0x06C, 0x07C, 0x038, 0x038, 0x000, 0x000, 0x000, 0x000)
+/* 'w'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x183, 0x183, 0x19B, 0x0BA, 0x0FA, 0x0EE, 0x0EE, 0x0EE, 0x000, 0x000, 0x000, 0x000)
+/* 'x'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0EE, 0x06C, 0x038, 0x038, 0x038, 0x07C, 0x0EE, 0x0C6, 0x000, 0x000, 0x000, 0x000)
+/* 'y'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0C6, 0x0C6, 0x0EE, 0x06C, 0x07C, 0x038, 0x038, 0x038, 0x030, 0x0F0, 0x0E0, 0x000)
+/* 'z'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0FE, 0x00E, 0x00C, 0x018, 0x030, 0x060, 0x0FE, 0x0FE, 0x000, 0x000, 0x000, 0x000)
+/* '{'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x01E, 0x018, 0x018, 0x018, 0x018, 0x030, 0x0F0, 0x030, 0x038, 0x018, 0x018, 0x018, 0x01E, 0x000, 0x000)
+/* '|'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010)
+/* '}'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x0F0, 0x030, 0x030, 0x030, 0x018, 0x018, 0x01E, 0x018, 0x018, 0x030, 0x030, 0x030, 0x0F0, 0x000, 0x000)
+/* '~'  */ FONT_GLYPH(0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0F0, 0x0FE, 0x00C, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000)
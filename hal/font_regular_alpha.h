@@ -0,0 +1,106 @@
+/**
+ * The anti-aliased glyphs of the regular font, one `FONT_ALPHA_GLYPH` per character from
+ * `FONT_FIRST_CHAR` to `FONT_LAST_CHAR`. Each glyph has 18 rows of 9 pixels, with 4 bits
+ * of coverage per pixel (0 is the background, 15 the foreground), two pixels per byte (the
+ * high nibble is the leftmost pixel).
+ *
+ * Rasterized from DejaVu Sans Mono Bold at 15 pixels per em, with the baseline at row 14.
+ *
+ * This file has no include guard, it's included with `FONT_ALPHA_GLYPH` defined to what each
+ * glyph should expand to.
+ */
+/* ' '  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '!'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0D, 0xE0, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '"'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD2, 0x0D, 0xB0, 0x00, 0x0B, 0xF2, 0x0F, 0xD0, 0x00, 0x0B, 0xF2, 0x0F, 0xD0, 0x00, 0x0B, 0xF2, 0x0F, 0xD0, 0x00, 0x01, 0x20, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '#'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xB1, 0x5B, 0x20, 0x00, 0x0C, 0xD0, 0xAE, 0x00, 0x00, 0x1F, 0x90, 0xEB, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x18, 0xCF, 0x8B, 0xF9, 0x80, 0x00, 0xCD, 0x0A, 0xE0, 0x00, 0x44, 0xFB, 0x4E, 0xC4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x4A, 0xF4, 0x9F, 0x64, 0x00, 0x0C, 0xD0, 0xAE, 0x00, 0x00, 0x1F, 0x90, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '$'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x4A, 0xF9, 0x71, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0D, 0xF4, 0xF0, 0x42, 0x00, 0x0D, 0xF6, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x7D, 0xFF, 0xF6, 0x00, 0x00, 0x02, 0xF7, 0xFC, 0x00, 0x04, 0x02, 0xF2, 0xFD, 0x00, 0x0D, 0xEB, 0xFD, 0xF8, 0x00, 0x07, 0xCF, 0xFE, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '%'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x67, 0x10, 0x00, 0x00, 0x0C, 0xEE, 0xE1, 0x00, 0x00, 0x3F, 0x31, 0xE5, 0x00, 0x00, 0x3F, 0x64, 0xF5, 0x00, 0x00, 0x08, 0xFF, 0xA0, 0x4A, 0xB0, 0x00, 0x13, 0x7B, 0x82, 0x00, 0x04, 0xAB, 0x53, 0x99, 0x30, 0x05, 0x20, 0x0D, 0xCC, 0xE0, 0x00, 0x00, 0x4F, 0x20, 0xE0, 0x00, 0x00, 0x2F, 0x97, 0xF0, 0x00, 0x00, 0x06, 0xEE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '&'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xF3, 0x00, 0x00, 0xBF, 0xB8, 0xB4, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0xFD, 0x12, 0x80, 0x1F, 0xE1, 0xBF, 0x94, 0xF0, 0x4F, 0xB0, 0x2E, 0xFA, 0xF0, 0x2F, 0xF2, 0x06, 0xFF, 0xC0, 0x0C, 0xFD, 0x8B, 0xFF, 0x90, 0x01, 0xBF, 0xFF, 0xBF, 0xF0, 0x00, 0x01, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '\'' */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xF0, 0x00, 0x00, 0x00, 0x0D, 0xF0, 0x00, 0x00, 0x00, 0x0D, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '('  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, 0x00, 0xDE, 0x10, 0x00, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x00, 0x0E, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x08, 0xF7, 0x00, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x00, 0x00, 0x00, 0x2E, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* ')'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x00, 0x09, 0xF6, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0x00, 0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '*'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x0A, 0x62, 0xF2, 0x6A, 0x00, 0x06, 0xED, 0xFD, 0xE6, 0x00, 0x00, 0x4E, 0xFE, 0x40, 0x00, 0x0A, 0xF9, 0xF9, 0xFA, 0x00, 0x06, 0x22, 0xF2, 0x26, 0x00, 0x00, 0x02, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '+'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x99, 0x9E, 0xE9, 0x99, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x22, 0x2D, 0xD2, 0x22, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* ','  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB3, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x00, 0x00, 0x00, 0x8F, 0x30, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '-'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0xBB, 0xBB, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '.'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xB3, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '/'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x10, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x09, 0xE1, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '0'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x9F, 0xFE, 0x60, 0x00, 0x06, 0xFE, 0xBF, 0xF3, 0x00, 0x0D, 0xF6, 0x09, 0xFA, 0x00, 0x1F, 0xF1, 0x04, 0xFD, 0x00, 0x3F, 0xF1, 0x54, 0xFF, 0x00, 0x4F, 0xF7, 0xF5, 0xFF, 0x00, 0x3F, 0xF1, 0x63, 0xFF, 0x00, 0x1F, 0xF1, 0x04, 0xFD, 0x00, 0x0D, 0xF5, 0x08, 0xFA, 0x00, 0x07, 0xFE, 0xAF, 0xF4, 0x00, 0x00, 0x9F, 0xFF, 0x70, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '1'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8C, 0xDD, 0x20, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00, 0x02, 0x62, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x05, 0xDD, 0xFF, 0xDD, 0x80, 0x06, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '2'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x06, 0xEF, 0xFF, 0xA1, 0x00, 0x09, 0xDA, 0xAE, 0xFA, 0x00, 0x03, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xD1, 0x00, 0x00, 0x07, 0xFE, 0x20, 0x00, 0x00, 0x5F, 0xE2, 0x00, 0x00, 0x05, 0xFE, 0x20, 0x00, 0x00, 0x0D, 0xFE, 0xDD, 0xDD, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '3'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x07, 0xEF, 0xFF, 0xA1, 0x00, 0x09, 0xEB, 0xBF, 0xFA, 0x00, 0x02, 0x00, 0x05, 0xFD, 0x00, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x0B, 0xCF, 0xD3, 0x00, 0x00, 0x0F, 0xFF, 0xA2, 0x00, 0x00, 0x02, 0x28, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x20, 0x02, 0x00, 0x01, 0xFF, 0x20, 0x0F, 0xCA, 0xAE, 0xFD, 0x00, 0x0C, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x13, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '4'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0C, 0xDF, 0xF0, 0x00, 0x00, 0x6F, 0x4F, 0xF0, 0x00, 0x02, 0xEA, 0x0F, 0xF0, 0x00, 0x0B, 0xE1, 0x0F, 0xF0, 0x00, 0x4F, 0x94, 0x4F, 0xF4, 0x10, 0x6F, 0xFF, 0xFF, 0xFF, 0x40, 0x49, 0x99, 0x9F, 0xF9, 0x20, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '5'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xDD, 0xDD, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xB3, 0x20, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x0E, 0xA9, 0xCF, 0xF2, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x10, 0x00, 0x0B, 0xF8, 0x00, 0x6D, 0xA9, 0xDF, 0xE2, 0x00, 0x4E, 0xFF, 0xFD, 0x40, 0x00, 0x00, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '6'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xBA, 0xD6, 0x00, 0x0A, 0xF8, 0x00, 0x01, 0x00, 0x0F, 0xF0, 0x33, 0x00, 0x00, 0x2F, 0xEC, 0xFF, 0xD2, 0x00, 0x2F, 0xFE, 0x8C, 0xFB, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x00, 0x1F, 0xF2, 0x00, 0xFF, 0x20, 0x0D, 0xF4, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x8C, 0xFA, 0x00, 0x00, 0x9F, 0xFF, 0xB1, 0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '7'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xDD, 0xDD, 0xDB, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x00, 0x00, 0x00, 0x7F, 0xB0, 0x00, 0x00, 0x00, 0xDF, 0x60, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0xF3, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '8'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xA1, 0x00, 0x07, 0xFE, 0x9D, 0xF8, 0x00, 0x0B, 0xF4, 0x03, 0xFB, 0x00, 0x0A, 0xF4, 0x03, 0xFB, 0x00, 0x03, 0xEE, 0x9E, 0xE3, 0x00, 0x01, 0xAF, 0xFF, 0xB1, 0x00, 0x0B, 0xF8, 0x27, 0xFB, 0x00, 0x0F, 0xE0, 0x00, 0xEF, 0x10, 0x0F, 0xF1, 0x01, 0xEF, 0x10, 0x0B, 0xFC, 0x8C, 0xFB, 0x00, 0x01, 0xBF, 0xFF, 0xC2, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '9'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFE, 0x70, 0x00, 0x08, 0xFE, 0xAE, 0xF6, 0x00, 0x0E, 0xF3, 0x05, 0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFF, 0x10, 0x0F, 0xF2, 0x04, 0xFF, 0x20, 0x0C, 0xFC, 0x7D, 0xFF, 0x40, 0x03, 0xEF, 0xFE, 0xEF, 0x20, 0x00, 0x15, 0x51, 0xEF, 0x10, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x06, 0xB8, 0x9F, 0xF5, 0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x24, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* ':'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xB3, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xB3, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* ';'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBB, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBB, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '<'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x39, 0xFF, 0x00, 0x01, 0x7D, 0xFF, 0xB6, 0x00, 0x8F, 0xFD, 0x72, 0x00, 0x00, 0xBF, 0xB4, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xD8, 0x20, 0x00, 0x00, 0x16, 0xCF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '='  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x44, 0x44, 0x43, 0x00, 0xDF, 0xFF, 0xFF, 0xFD, 0x00, 0x78, 0x88, 0x88, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xDD, 0xDD, 0xDB, 0x00, 0xBD, 0xDD, 0xDD, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '>'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x10, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x40, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x71, 0x00, 0x00, 0x02, 0x7C, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xBF, 0xB0, 0x00, 0x28, 0xDF, 0xFA, 0x40, 0x0C, 0xFF, 0xC7, 0x10, 0x00, 0x0F, 0x93, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '?'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0x90, 0x00, 0x08, 0xFA, 0xAF, 0xF5, 0x00, 0x04, 0x10, 0x09, 0xF8, 0x00, 0x00, 0x00, 0x1D, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '@'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xA1, 0x00, 0x2E, 0xD5, 0x46, 0xF8, 0x00, 0xBE, 0x10, 0x11, 0x9E, 0x00, 0xF7, 0x09, 0xFF, 0xDF, 0x00, 0xF2, 0x6F, 0x84, 0xDF, 0x00, 0xF0, 0x9E, 0x00, 0x6F, 0x00, 0xF0, 0x9E, 0x00, 0x6F, 0x00, 0xF2, 0x6F, 0x84, 0xDF, 0x00, 0xF7, 0x0A, 0xFF, 0xDF, 0x00, 0xAE, 0x20, 0x11, 0x00, 0x00, 0x2E, 0xE6, 0x22, 0x55, 0x00, 0x02, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x02, 0x45, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'A'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xDD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x30, 0x00, 0x00, 0x7F, 0xCF, 0x80, 0x00, 0x00, 0xBF, 0x5F, 0xB0, 0x00, 0x00, 0xFE, 0x0E, 0xF1, 0x00, 0x04, 0xFB, 0x0A, 0xF4, 0x00, 0x08, 0xFC, 0x8B, 0xF9, 0x00, 0x0C, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xF4, 0x44, 0xFF, 0x20, 0x5F, 0xC0, 0x00, 0xBF, 0x60, 0x9F, 0x80, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'B'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0xA2, 0x00, 0x0F, 0xFC, 0xBE, 0xFD, 0x00, 0x0F, 0xF2, 0x01, 0xFF, 0x30, 0x0F, 0xF2, 0x00, 0xEF, 0x20, 0x0F, 0xFA, 0xAD, 0xF9, 0x00, 0x0F, 0xFF, 0xFF, 0xD6, 0x00, 0x0F, 0xF2, 0x03, 0xDF, 0x40, 0x0F, 0xF2, 0x00, 0x9F, 0x90, 0x0F, 0xF2, 0x00, 0xBF, 0x90, 0x0F, 0xFC, 0xBD, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'C'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xF6, 0x00, 0x03, 0xFF, 0xED, 0xF8, 0x00, 0x0B, 0xFC, 0x10, 0x24, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0C, 0xFB, 0x00, 0x14, 0x00, 0x04, 0xFF, 0xDB, 0xE8, 0x00, 0x00, 0x5D, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x23, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'D'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xDD, 0xC9, 0x20, 0x00, 0x2F, 0xFF, 0xFF, 0xE3, 0x00, 0x2F, 0xF0, 0x2C, 0xFB, 0x00, 0x2F, 0xF0, 0x04, 0xFF, 0x10, 0x2F, 0xF0, 0x01, 0xFF, 0x30, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x01, 0xFF, 0x30, 0x2F, 0xF0, 0x04, 0xFF, 0x10, 0x2F, 0xF0, 0x1C, 0xFB, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xEA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'E'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xDD, 0xDD, 0xDA, 0x00, 0x0F, 0xFF, 0xFF, 0xFB, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x99, 0x94, 0x00, 0x0F, 0xFF, 0xFF, 0xF6, 0x00, 0x0F, 0xF5, 0x44, 0x41, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0xDD, 0xDA, 0x00, 0x0F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'F'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xDD, 0xDD, 0xDA, 0x00, 0x0F, 0xFF, 0xFF, 0xFB, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x99, 0x94, 0x00, 0x0F, 0xFF, 0xFF, 0xF6, 0x00, 0x0F, 0xF5, 0x44, 0x41, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'G'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xE7, 0x00, 0x03, 0xFF, 0xED, 0xFB, 0x00, 0x0B, 0xFC, 0x10, 0x16, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x3D, 0xDD, 0x20, 0x4F, 0xF0, 0x3D, 0xFF, 0x20, 0x1F, 0xF4, 0x00, 0xBF, 0x20, 0x0C, 0xFB, 0x00, 0xBF, 0x20, 0x04, 0xFF, 0xDB, 0xFF, 0x20, 0x00, 0x5E, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'H'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD2, 0x02, 0xDD, 0x00, 0x0F, 0xF2, 0x02, 0xFF, 0x00, 0x0F, 0xF2, 0x02, 0xFF, 0x00, 0x0F, 0xF2, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0xBC, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xF4, 0x24, 0xFF, 0x00, 0x0F, 0xF2, 0x02, 0xFF, 0x00, 0x0F, 0xF2, 0x02, 0xFF, 0x00, 0x0F, 0xF2, 0x02, 0xFF, 0x00, 0x0F, 0xF2, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'I'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xDD, 0xDD, 0xD3, 0x00, 0x4F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x3D, 0xDF, 0xFD, 0xD3, 0x00, 0x4F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'J'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xDD, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x73, 0x00, 0x5F, 0xE0, 0x00, 0x9F, 0xCB, 0xFF, 0xA0, 0x00, 0x5D, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x24, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'K'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD2, 0x00, 0xBD, 0x80, 0x0F, 0xF2, 0x09, 0xFC, 0x00, 0x0F, 0xF2, 0x6F, 0xE2, 0x00, 0x0F, 0xF5, 0xFF, 0x40, 0x00, 0x0F, 0xFE, 0xFA, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x20, 0x00, 0x0F, 0xFB, 0xBF, 0xA0, 0x00, 0x0F, 0xF3, 0x2F, 0xF3, 0x00, 0x0F, 0xF2, 0x09, 0xFB, 0x00, 0x0F, 0xF2, 0x02, 0xFF, 0x40, 0x0F, 0xF2, 0x00, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'L'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0xDD, 0xDD, 0xA0, 0x00, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'M'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xB0, 0x0B, 0xDB, 0x00, 0xDF, 0xF1, 0x1F, 0xFD, 0x00, 0xDF, 0xE6, 0x5E, 0xFD, 0x00, 0xDF, 0xAA, 0x9B, 0xFD, 0x00, 0xDF, 0x7E, 0xD8, 0xFD, 0x00, 0xDF, 0x3F, 0xF4, 0xFD, 0x00, 0xDF, 0x0E, 0xF0, 0xFD, 0x00, 0xDF, 0x00, 0x00, 0xFD, 0x00, 0xDF, 0x00, 0x00, 0xFD, 0x00, 0xDF, 0x00, 0x00, 0xFD, 0x00, 0xDF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'N'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD7, 0x00, 0x8D, 0x30, 0x0F, 0xFD, 0x00, 0x9F, 0x40, 0x0F, 0xFF, 0x40, 0x9F, 0x40, 0x0F, 0xDE, 0xA0, 0x9F, 0x40, 0x0F, 0xD8, 0xF1, 0x9F, 0x40, 0x0F, 0xD2, 0xF6, 0x9F, 0x40, 0x0F, 0xD0, 0xCC, 0x9F, 0x40, 0x0F, 0xD0, 0x6F, 0xCF, 0x40, 0x0F, 0xD0, 0x1E, 0xFF, 0x40, 0x0F, 0xD0, 0x09, 0xFF, 0x40, 0x0F, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'O'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xDF, 0xF7, 0x00, 0x0E, 0xF6, 0x06, 0xFE, 0x00, 0x3F, 0xF1, 0x01, 0xFF, 0x30, 0x4F, 0xF0, 0x00, 0xEF, 0x50, 0x6F, 0xD0, 0x00, 0xDF, 0x60, 0x4F, 0xF0, 0x00, 0xEF, 0x50, 0x3F, 0xF1, 0x01, 0xFF, 0x30, 0x0E, 0xF6, 0x05, 0xFE, 0x00, 0x08, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x9F, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'P'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xDD, 0xDC, 0x81, 0x00, 0x0F, 0xFE, 0xDF, 0xFC, 0x00, 0x0F, 0xF4, 0x04, 0xFF, 0x30, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x04, 0xFF, 0x30, 0x0F, 0xFE, 0xEF, 0xFC, 0x00, 0x0F, 0xFE, 0xDC, 0x81, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'Q'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xDF, 0xF7, 0x00, 0x0E, 0xF6, 0x06, 0xFE, 0x00, 0x3F, 0xF1, 0x01, 0xFF, 0x30, 0x4F, 0xF0, 0x00, 0xEF, 0x50, 0x6F, 0xD0, 0x00, 0xDF, 0x60, 0x4F, 0xF0, 0x00, 0xEF, 0x50, 0x3F, 0xF1, 0x01, 0xFF, 0x30, 0x0E, 0xF6, 0x05, 0xFE, 0x00, 0x08, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x9F, 0xFF, 0xC1, 0x00, 0x00, 0x01, 0x4D, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'R'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xDD, 0xDC, 0x81, 0x00, 0x0F, 0xFD, 0xEF, 0xFA, 0x00, 0x0F, 0xF2, 0x07, 0xFF, 0x00, 0x0F, 0xF2, 0x04, 0xFF, 0x00, 0x0F, 0xF4, 0x29, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xB2, 0x00, 0x0F, 0xFA, 0xEF, 0xB0, 0x00, 0x0F, 0xF2, 0x2E, 0xF4, 0x00, 0x0F, 0xF2, 0x08, 0xFB, 0x00, 0x0F, 0xF2, 0x01, 0xFF, 0x40, 0x0F, 0xF2, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'S'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xC3, 0x00, 0x0C, 0xFD, 0xAC, 0xF6, 0x00, 0x2F, 0xF1, 0x00, 0x23, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xB5, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0xC2, 0x00, 0x00, 0x02, 0x8E, 0xFB, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x16, 0x00, 0x04, 0xFF, 0x00, 0x2F, 0xDA, 0xAE, 0xFA, 0x00, 0x1B, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x13, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'T'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xDD, 0xDD, 0xDB, 0x00, 0xDF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'U'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xB0, 0x00, 0xBD, 0x30, 0x4F, 0xD0, 0x00, 0xDF, 0x40, 0x4F, 0xD0, 0x00, 0xDF, 0x40, 0x4F, 0xD0, 0x00, 0xDF, 0x40, 0x4F, 0xD0, 0x00, 0xDF, 0x40, 0x4F, 0xD0, 0x00, 0xDF, 0x40, 0x4F, 0xD0, 0x00, 0xDF, 0x40, 0x3F, 0xE0, 0x00, 0xDF, 0x40, 0x1F, 0xF3, 0x03, 0xFF, 0x10, 0x0B, 0xFF, 0xBE, 0xFC, 0x00, 0x02, 0xCF, 0xFF, 0xC2, 0x00, 0x00, 0x02, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'V'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x90, 0x00, 0x9D, 0x60, 0x4F, 0xD0, 0x00, 0xDF, 0x40, 0x0F, 0xF2, 0x01, 0xFF, 0x10, 0x0B, 0xF5, 0x04, 0xFC, 0x00, 0x08, 0xF8, 0x08, 0xF8, 0x00, 0x04, 0xFB, 0x0B, 0xF5, 0x00, 0x01, 0xFE, 0x0E, 0xF1, 0x00, 0x00, 0xCF, 0x5F, 0xD0, 0x00, 0x00, 0x8F, 0xAF, 0x90, 0x00, 0x00, 0x5F, 0xFF, 0x60, 0x00, 0x00, 0x1F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'W'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x0C, 0xD0, 0xCF, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x21, 0x21, 0x1F, 0xB0, 0x9F, 0x47, 0xF8, 0x2F, 0x90, 0x7F, 0x5A, 0xFB, 0x4F, 0x80, 0x5F, 0x6D, 0xDE, 0x4F, 0x60, 0x3F, 0x8F, 0x7F, 0x8F, 0x40, 0x1F, 0xCF, 0x1F, 0xDF, 0x30, 0x0E, 0xFD, 0x0C, 0xFF, 0x10, 0x0D, 0xFA, 0x08, 0xFE, 0x00, 0x0B, 0xF7, 0x05, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'X'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xB0, 0x00, 0xAD, 0x60, 0x0D, 0xF5, 0x05, 0xFD, 0x00, 0x04, 0xFD, 0x1D, 0xF5, 0x00, 0x00, 0xBF, 0xCF, 0xB0, 0x00, 0x00, 0x2F, 0xFF, 0x30, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0xCF, 0xCF, 0xC0, 0x00, 0x05, 0xFD, 0x0C, 0xF6, 0x00, 0x1D, 0xF4, 0x04, 0xFE, 0x10, 0x8F, 0xB0, 0x00, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'Y'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xD2, 0x00, 0x1D, 0xD0, 0x0A, 0xF8, 0x00, 0x8F, 0xB0, 0x03, 0xFF, 0x11, 0xFF, 0x40, 0x00, 0xAF, 0x88, 0xFB, 0x00, 0x00, 0x3F, 0xFE, 0xF3, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0x30, 0x00, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'Z'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xDD, 0xDD, 0xDD, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1D, 0xF9, 0x00, 0x00, 0x00, 0xAF, 0xD0, 0x00, 0x00, 0x05, 0xFF, 0x30, 0x00, 0x00, 0x1E, 0xF7, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x06, 0xFE, 0x20, 0x00, 0x00, 0x2E, 0xF6, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0xDD, 0xDD, 0x20, 0x8F, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '['  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE6, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '\\' */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x70, 0x00, 0x00, 0x00, 0x09, 0xE1, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* ']'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x66, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x46, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '^'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x60, 0x00, 0x06, 0xFB, 0x3D, 0xF3, 0x00, 0x3F, 0xA1, 0x01, 0xDD, 0x10, 0x12, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '_'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xDD, 0xDD, 0xD0, 0x88, 0x88, 0x88, 0x88, 0x80)
+/* '`'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDE, 0x20, 0x00, 0x00, 0x00, 0x1D, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'a'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x65, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xF5, 0x00, 0x07, 0x84, 0x47, 0xFD, 0x00, 0x00, 0x25, 0x66, 0xFF, 0x10, 0x08, 0xFF, 0xFF, 0xFF, 0x20, 0x3F, 0xF8, 0x32, 0xFF, 0x20, 0x4F, 0xF0, 0x03, 0xFF, 0x20, 0x2F, 0xF8, 0x4D, 0xFF, 0x20, 0x07, 0xFF, 0xF8, 0xFF, 0x20, 0x00, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'b'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x46, 0x20, 0x00, 0x0F, 0xFA, 0xFF, 0xF4, 0x00, 0x0F, 0xFE, 0x6C, 0xFD, 0x00, 0x0F, 0xF5, 0x02, 0xFF, 0x20, 0x0F, 0xF2, 0x00, 0xEF, 0x40, 0x0F, 0xF2, 0x00, 0xEF, 0x40, 0x0F, 0xF6, 0x03, 0xFF, 0x10, 0x0F, 0xFE, 0x8D, 0xFC, 0x00, 0x0F, 0xF8, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'c'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x51, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0x20, 0x00, 0xDF, 0xC6, 0x6B, 0x20, 0x03, 0xFF, 0x10, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x30, 0x01, 0x10, 0x00, 0xBF, 0xE9, 0x9E, 0x20, 0x00, 0x1A, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x14, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'd'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x26, 0x42, 0xFF, 0x00, 0x04, 0xFF, 0xFB, 0xFF, 0x00, 0x0D, 0xFC, 0x6D, 0xFF, 0x00, 0x1F, 0xF2, 0x04, 0xFF, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF3, 0x06, 0xFF, 0x00, 0x0B, 0xFD, 0x9E, 0xFF, 0x00, 0x02, 0xDF, 0xF8, 0xFF, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'e'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x64, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xD2, 0x00, 0x0D, 0xF9, 0x49, 0xFC, 0x00, 0x4F, 0xD0, 0x00, 0xEF, 0x20, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x6F, 0xE9, 0x99, 0x99, 0x20, 0x4F, 0xD1, 0x00, 0x02, 0x00, 0x0C, 0xFC, 0x88, 0xBF, 0x00, 0x01, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x01, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'f'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x64, 0x00, 0x00, 0x09, 0xFF, 0xF9, 0x00, 0x00, 0x0E, 0xF7, 0x42, 0x00, 0x04, 0x4F, 0xF5, 0x42, 0x00, 0x0F, 0xFF, 0xFF, 0xF9, 0x00, 0x08, 0x8F, 0xF8, 0x85, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'g'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x44, 0x00, 0x03, 0xEF, 0xFB, 0xFF, 0x20, 0x0B, 0xFC, 0x6C, 0xFF, 0x20, 0x1F, 0xF3, 0x03, 0xFF, 0x20, 0x2F, 0xF0, 0x00, 0xFF, 0x20, 0x2F, 0xF1, 0x01, 0xFF, 0x20, 0x0E, 0xF6, 0x06, 0xFF, 0x20, 0x08, 0xFF, 0xDF, 0xFF, 0x20, 0x00, 0x8D, 0xC5, 0xFF, 0x20, 0x01, 0x00, 0x02, 0xFF, 0x10, 0x04, 0xDA, 0xAE, 0xFB, 0x00, 0x03, 0xEF, 0xFF, 0xB1, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00)
+/* 'h'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x46, 0x10, 0x00, 0x0F, 0xFB, 0xFF, 0xE2, 0x00, 0x0F, 0xFC, 0x6E, 0xF7, 0x00, 0x0F, 0xF4, 0x08, 0xF9, 0x00, 0x0F, 0xF2, 0x08, 0xF9, 0x00, 0x0F, 0xF2, 0x08, 0xF9, 0x00, 0x0F, 0xF2, 0x08, 0xF9, 0x00, 0x0F, 0xF2, 0x08, 0xF9, 0x00, 0x0F, 0xF2, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'i'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x01, 0x44, 0x44, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0x88, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x08, 0x9A, 0xFF, 0x99, 0x60, 0x0D, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'j'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x01, 0x44, 0x44, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00, 0x02, 0x88, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x02, 0xFF, 0x10, 0x00, 0x18, 0x8C, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00)
+/* 'k'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x01, 0x44, 0x10, 0x0F, 0xF2, 0x1D, 0xFA, 0x00, 0x0F, 0xF3, 0xBF, 0x90, 0x00, 0x0F, 0xFC, 0xF9, 0x00, 0x00, 0x0F, 0xFF, 0xFA, 0x00, 0x00, 0x0F, 0xF9, 0xDF, 0x40, 0x00, 0x0F, 0xF2, 0x5F, 0xD1, 0x00, 0x0F, 0xF2, 0x0B, 0xF8, 0x00, 0x0F, 0xF2, 0x02, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'l'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x66, 0x60, 0x00, 0x00, 0x6F, 0xFF, 0xF0, 0x00, 0x00, 0x14, 0x5F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x0D, 0xFD, 0x99, 0x00, 0x00, 0x04, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'm'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x45, 0x04, 0x50, 0x00, 0xDD, 0xFF, 0xCF, 0xF9, 0x00, 0xDF, 0x4E, 0xF5, 0xED, 0x00, 0xDD, 0x0D, 0xD0, 0xCE, 0x00, 0xDD, 0x0D, 0xD0, 0xBF, 0x00, 0xDD, 0x0D, 0xD0, 0xBF, 0x00, 0xDD, 0x0D, 0xD0, 0xBF, 0x00, 0xDD, 0x0D, 0xD0, 0xBF, 0x00, 0xDD, 0x0D, 0xD0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'n'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x46, 0x10, 0x00, 0x0F, 0xFB, 0xFF, 0xE2, 0x00, 0x0F, 0xFC, 0x6D, 0xF7, 0x00, 0x0F, 0xF4, 0x08, 0xF9, 0x00, 0x0F, 0xF2, 0x08, 0xF9, 0x00, 0x0F, 0xF2, 0x08, 0xF9, 0x00, 0x0F, 0xF2, 0x08, 0xF9, 0x00, 0x0F, 0xF2, 0x08, 0xF9, 0x00, 0x0F, 0xF2, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'o'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x64, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xD2, 0x00, 0x0B, 0xFC, 0x6B, 0xFB, 0x00, 0x2F, 0xF1, 0x01, 0xFF, 0x20, 0x4F, 0xD0, 0x00, 0xDF, 0x40, 0x4F, 0xE0, 0x00, 0xDF, 0x40, 0x1F, 0xF3, 0x02, 0xFF, 0x10, 0x0A, 0xFD, 0x8D, 0xFA, 0x00, 0x01, 0xAF, 0xFF, 0xA1, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'p'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x46, 0x20, 0x00, 0x0F, 0xFA, 0xFF, 0xF4, 0x00, 0x0F, 0xFD, 0x6C, 0xFD, 0x00, 0x0F, 0xF5, 0x02, 0xFF, 0x20, 0x0F, 0xF2, 0x00, 0xEF, 0x40, 0x0F, 0xF2, 0x00, 0xEF, 0x40, 0x0F, 0xF6, 0x03, 0xFF, 0x10, 0x0F, 0xFE, 0xAD, 0xFC, 0x00, 0x0F, 0xF8, 0xFF, 0xD2, 0x00, 0x0F, 0xF2, 0x13, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00)
+/* 'q'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x44, 0x00, 0x04, 0xFF, 0xFA, 0xFF, 0x00, 0x0D, 0xFC, 0x6D, 0xFF, 0x00, 0x1F, 0xF2, 0x04, 0xFF, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF3, 0x06, 0xFF, 0x00, 0x0B, 0xFD, 0xAE, 0xFF, 0x00, 0x02, 0xDF, 0xF8, 0xFF, 0x00, 0x00, 0x03, 0x12, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00)
+/* 'r'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x03, 0x64, 0x00, 0x00, 0xFF, 0x9F, 0xFF, 0x40, 0x00, 0xFF, 0xF9, 0x69, 0x40, 0x00, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 's'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x64, 0x10, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x25, 0x90, 0x00, 0x1F, 0xF6, 0x10, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x50, 0x00, 0x00, 0x59, 0xDF, 0xF3, 0x00, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x0E, 0x96, 0x6D, 0xF5, 0x00, 0x0D, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x13, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 't'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x81, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x04, 0x4F, 0xF5, 0x44, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x08, 0x8F, 0xF8, 0x88, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x00, 0x00, 0x0C, 0xFD, 0x99, 0x00, 0x00, 0x04, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'u'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x42, 0x00, 0x44, 0x00, 0x09, 0xF9, 0x02, 0xFF, 0x00, 0x09, 0xF9, 0x02, 0xFF, 0x00, 0x09, 0xF9, 0x02, 0xFF, 0x00, 0x09, 0xF9, 0x02, 0xFF, 0x00, 0x09, 0xF9, 0x02, 0xFF, 0x00, 0x09, 0xFA, 0x04, 0xFF, 0x00, 0x06, 0xFE, 0x8D, 0xFF, 0x00, 0x01, 0xCF, 0xF8, 0xFF, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'v'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x30, 0x00, 0x34, 0x20, 0x3F, 0xE0, 0x00, 0xEF, 0x40, 0x0D, 0xF3, 0x03, 0xFD, 0x00, 0x08, 0xF8, 0x07, 0xF9, 0x00, 0x04, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0xEF, 0x2F, 0xE0, 0x00, 0x00, 0x9F, 0x9F, 0xA0, 0x00, 0x00, 0x4F, 0xFF, 0x50, 0x00, 0x00, 0x0E, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'w'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x10, 0x00, 0x01, 0x40, 0x6F, 0x60, 0x00, 0x05, 0xF0, 0x3F, 0x80, 0x00, 0x08, 0xF0, 0x0F, 0xB0, 0xEF, 0x0A, 0xF0, 0x0C, 0xD3, 0xFF, 0x3C, 0xD0, 0x0A, 0xF7, 0xCC, 0x7F, 0xA0, 0x07, 0xFC, 0x98, 0xCF, 0x80, 0x04, 0xFF, 0x65, 0xFF, 0x50, 0x01, 0xFF, 0x22, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'x'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x40, 0x01, 0x44, 0x10, 0x1D, 0xF6, 0x09, 0xFB, 0x00, 0x04, 0xFE, 0x4F, 0xE2, 0x00, 0x00, 0x8F, 0xFF, 0x50, 0x00, 0x00, 0x0D, 0xFB, 0x00, 0x00, 0x00, 0x4F, 0xFE, 0x20, 0x00, 0x01, 0xDF, 0xAF, 0xB0, 0x00, 0x0A, 0xFA, 0x0D, 0xF7, 0x00, 0x5F, 0xF2, 0x04, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'y'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0x00, 0x34, 0x20, 0x6F, 0xC0, 0x01, 0xFF, 0x30, 0x1F, 0xF2, 0x05, 0xFD, 0x00, 0x09, 0xF8, 0x0A, 0xF7, 0x00, 0x04, 0xFD, 0x1F, 0xF2, 0x00, 0x00, 0xDF, 0x9F, 0xB0, 0x00, 0x00, 0x7F, 0xFF, 0x50, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x0D, 0xF3, 0x00, 0x00, 0x28, 0xBF, 0xC0, 0x00, 0x00, 0x4F, 0xFD, 0x30, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00)
+/* 'z'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x44, 0x44, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x66, 0x6B, 0xFE, 0x00, 0x00, 0x00, 0x5F, 0xE3, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x2E, 0xF6, 0x00, 0x00, 0x01, 0xDF, 0x80, 0x00, 0x00, 0x0A, 0xFE, 0x99, 0x99, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '{'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x61, 0x00, 0x00, 0x09, 0xFF, 0xF4, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0x8F, 0xD0, 0x00, 0x00, 0x4F, 0xFE, 0x30, 0x00, 0x00, 0x14, 0x9F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x46, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '|'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00)
+/* '}'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x64, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x4F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF8, 0x30, 0x00, 0x00, 0x03, 0xEF, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0x41, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x18, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '~'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xDB, 0x61, 0x18, 0x00, 0xBD, 0xBD, 0xFF, 0xFF, 0x00, 0x40, 0x00, 0x49, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
@@ -0,0 +1,106 @@
+/**
+ * The anti-aliased glyphs of the small font, one `FONT_ALPHA_GLYPH` per character from
+ * `FONT_FIRST_CHAR` to `FONT_LAST_CHAR`. Each glyph has 12 rows of 6 pixels, with 4 bits
+ * of coverage per pixel (0 is the background, 15 the foreground), two pixels per byte (the
+ * high nibble is the leftmost pixel).
+ *
+ * Rasterized from DejaVu Sans Mono Bold at 10 pixels per em, with the baseline at row 9.
+ *
+ * This file has no include guard, it's included with `FONT_ALPHA_GLYPH` defined to what each
+ * glyph should expand to.
+ */
+/* ' '  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '!'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0xF2, 0x00, 0x02, 0xF2, 0x00, 0x02, 0xF2, 0x00, 0x01, 0xF2, 0x00, 0x00, 0x90, 0x00, 0x01, 0x61, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '"'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x13, 0x03, 0x10, 0x6D, 0x0D, 0x60, 0x6D, 0x0D, 0x60, 0x25, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '#'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x5C, 0x3D, 0x05, 0xBB, 0xAC, 0x0A, 0xFC, 0xEC, 0x01, 0xF1, 0xE1, 0x7E, 0xFD, 0xFD, 0x19, 0x98, 0x92, 0x0C, 0x4B, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '$'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x5C, 0x50, 0x0B, 0xCD, 0xC2, 0x0E, 0x79, 0x00, 0x08, 0xFE, 0x91, 0x00, 0x2C, 0xE7, 0x06, 0x3A, 0xC8, 0x09, 0xEF, 0xC1, 0x00, 0x09, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00)
+/* '%'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xB0, 0x00, 0xC1, 0xA4, 0x00, 0x7D, 0xC1, 0x65, 0x04, 0x88, 0x40, 0x46, 0x1C, 0xC9, 0x00, 0x2C, 0x0E, 0x00, 0x0A, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '&'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x36, 0x50, 0x04, 0xFB, 0xC0, 0x05, 0xF1, 0x00, 0x03, 0xF9, 0x00, 0x0D, 0xBF, 0x36, 0x4F, 0x0A, 0xDC, 0x3F, 0x62, 0xFE, 0x09, 0xFF, 0xDF, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '\'' */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0xF2, 0x00, 0x02, 0xF2, 0x00, 0x01, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '('  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x19, 0x10, 0x00, 0x8B, 0x00, 0x00, 0xE5, 0x00, 0x04, 0xF2, 0x00, 0x06, 0xF0, 0x00, 0x05, 0xF0, 0x00, 0x03, 0xF3, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x00)
+/* ')'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x01, 0x91, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x60, 0x00, 0x0F, 0x60, 0x00, 0x3F, 0x30, 0x00, 0x7D, 0x00, 0x00, 0xC6, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00)
+/* '*'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x61, 0xB1, 0x60, 0x4C, 0xEC, 0x40, 0x6C, 0xDC, 0x60, 0x30, 0xB0, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '+'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x20, 0x00, 0x2F, 0x20, 0x1B, 0xCF, 0xCB, 0x18, 0x8F, 0x88, 0x00, 0x2F, 0x20, 0x00, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* ','  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0xF7, 0x00, 0x04, 0xE1, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00)
+/* '-'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x00, 0x0D, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '.'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '/'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x01, 0xE2, 0x00, 0x07, 0x90, 0x00, 0x0E, 0x30, 0x00, 0x6A, 0x00, 0x00, 0xD4, 0x00, 0x05, 0xB0, 0x00, 0x0C, 0x50, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '0'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x02, 0x64, 0x00, 0x3E, 0xDF, 0x60, 0x8D, 0x09, 0xC0, 0xBB, 0x27, 0xF0, 0xBA, 0xD8, 0xF0, 0xBB, 0x07, 0xF0, 0x7E, 0x3B, 0xB0, 0x1C, 0xFE, 0x30, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '1'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x0D, 0xFF, 0x00, 0x04, 0x6F, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x6F, 0x00, 0x04, 0x8F, 0x42, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '2'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x02, 0x56, 0x20, 0x0D, 0xCD, 0xF4, 0x01, 0x00, 0xE8, 0x00, 0x03, 0xF5, 0x00, 0x1D, 0xA0, 0x01, 0xCA, 0x00, 0x0B, 0xD4, 0x42, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '3'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x04, 0x65, 0x10, 0x0F, 0xCE, 0xE1, 0x01, 0x03, 0xF4, 0x00, 0x8B, 0xC1, 0x00, 0xBD, 0xB1, 0x00, 0x01, 0xE7, 0x24, 0x24, 0xF6, 0x3F, 0xFF, 0xB1, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '4'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x1E, 0xF0, 0x00, 0x9D, 0xF0, 0x04, 0xD6, 0xF0, 0x1D, 0x46, 0xF0, 0x4E, 0xBD, 0xFA, 0x16, 0x69, 0xF5, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '5'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x04, 0x44, 0x30, 0x0F, 0xFF, 0xD0, 0x0F, 0x20, 0x00, 0x0F, 0xCB, 0x40, 0x09, 0x6B, 0xF2, 0x00, 0x02, 0xF5, 0x13, 0x27, 0xF3, 0x3F, 0xFF, 0x80, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '6'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x15, 0x51, 0x03, 0xEC, 0xC6, 0x0B, 0xA0, 0x00, 0x0E, 0xAB, 0xA2, 0x0F, 0xD6, 0xDA, 0x0E, 0x90, 0x8D, 0x0B, 0xB0, 0xBB, 0x03, 0xEF, 0xE3, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '7'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x34, 0x44, 0x30, 0xBF, 0xFF, 0xD0, 0x00, 0x0D, 0x90, 0x00, 0x4F, 0x30, 0x00, 0xAC, 0x00, 0x01, 0xF6, 0x00, 0x07, 0xF1, 0x00, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '8'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x01, 0x55, 0x10, 0x0D, 0xDD, 0xD0, 0x2F, 0x22, 0xF3, 0x0D, 0x99, 0xD0, 0x0A, 0xDD, 0xB0, 0x5F, 0x11, 0xE5, 0x5F, 0x33, 0xF5, 0x0B, 0xFF, 0xB0, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '9'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x1E, 0xDE, 0xB0, 0x6E, 0x04, 0xF3, 0x7E, 0x03, 0xF5, 0x3F, 0xBC, 0xF6, 0x04, 0x96, 0xF5, 0x02, 0x07, 0xF1, 0x0F, 0xFF, 0x60, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* ':'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* ';'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x01, 0xF8, 0x00, 0x04, 0xF1, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00)
+/* '<'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x5B, 0xFA, 0x1E, 0xC6, 0x10, 0x1A, 0xEA, 0x50, 0x00, 0x17, 0xDE, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '='  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xD2, 0x66, 0x66, 0x61, 0x99, 0x99, 0x91, 0x88, 0x88, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '>'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0xAF, 0xB5, 0x00, 0x01, 0x6C, 0xE1, 0x05, 0xAE, 0xA1, 0xED, 0x71, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '?'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x02, 0x55, 0x10, 0x0F, 0xCE, 0xC0, 0x02, 0x06, 0xF1, 0x00, 0x2E, 0x80, 0x00, 0xC9, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x62, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '@'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xBB, 0x30, 0xAA, 0x35, 0xE0, 0xD1, 0x9A, 0xD2, 0x87, 0xA3, 0xE2, 0x89, 0x60, 0xB2, 0xA5, 0xD8, 0xF2, 0xE2, 0x45, 0x41, 0x6E, 0x76, 0xA0, 0x02, 0x78, 0x50, 0x00, 0x00, 0x00)
+/* 'A'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x14, 0x20, 0x00, 0x9F, 0x90, 0x00, 0xDC, 0xD0, 0x02, 0xF5, 0xF2, 0x06, 0xE0, 0xE6, 0x0A, 0xFF, 0xFA, 0x0E, 0x94, 0x9E, 0x3F, 0x30, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'B'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x04, 0x44, 0x20, 0x0F, 0xED, 0xF7, 0x0F, 0x60, 0xAB, 0x0F, 0xA8, 0xE7, 0x0F, 0xDB, 0xD6, 0x0F, 0x60, 0x7F, 0x0F, 0x72, 0xAF, 0x0F, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'C'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x46, 0x40, 0x0A, 0xFD, 0xF0, 0x3F, 0x70, 0x30, 0x7F, 0x10, 0x00, 0x8F, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x2F, 0xA3, 0x70, 0x06, 0xEF, 0xF0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'D'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x03, 0x44, 0x00, 0x0D, 0xFF, 0xE3, 0x0D, 0x91, 0xCC, 0x0D, 0x90, 0x8F, 0x0D, 0x90, 0x6F, 0x0D, 0x90, 0x8F, 0x0D, 0xB6, 0xEA, 0x0D, 0xFE, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'E'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x04, 0x44, 0x42, 0x0F, 0xFF, 0xF8, 0x0F, 0x60, 0x00, 0x0F, 0xA8, 0x82, 0x0F, 0xED, 0xD3, 0x0F, 0x60, 0x00, 0x0F, 0x84, 0x42, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'F'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x04, 0x44, 0x42, 0x0F, 0xFF, 0xF8, 0x0F, 0x80, 0x00, 0x0F, 0xB8, 0x82, 0x0F, 0xED, 0xD3, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'G'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x01, 0x55, 0x10, 0x2E, 0xFE, 0xB0, 0xAE, 0x10, 0x40, 0xDA, 0x00, 0x00, 0xD9, 0x3D, 0xD0, 0xCB, 0x17, 0xF0, 0x8F, 0x56, 0xF0, 0x1B, 0xFF, 0xB0, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'H'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x32, 0x02, 0x30, 0xD9, 0x09, 0xD0, 0xD9, 0x09, 0xD0, 0xDC, 0x8C, 0xD0, 0xDE, 0xBE, 0xD0, 0xD9, 0x09, 0xD0, 0xD9, 0x09, 0xD0, 0xD9, 0x09, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'I'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x14, 0x44, 0x40, 0x4F, 0xFF, 0xF0, 0x00, 0xD9, 0x00, 0x00, 0xD9, 0x00, 0x00, 0xD9, 0x00, 0x00, 0xD9, 0x00, 0x14, 0xEB, 0x40, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'J'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0xFF, 0xF2, 0x00, 0x04, 0xF2, 0x00, 0x04, 0xF2, 0x00, 0x04, 0xF2, 0x00, 0x04, 0xF2, 0x47, 0x29, 0xF1, 0x3E, 0xFF, 0x90, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'K'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x04, 0x10, 0x24, 0x0F, 0x61, 0xDA, 0x0F, 0x6B, 0xC1, 0x0F, 0xDF, 0x20, 0x0F, 0xFF, 0x70, 0x0F, 0x78, 0xE1, 0x0F, 0x61, 0xE8, 0x0F, 0x60, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'L'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x06, 0xF0, 0x00, 0x06, 0xF0, 0x00, 0x06, 0xF0, 0x00, 0x06, 0xF0, 0x00, 0x06, 0xF0, 0x00, 0x06, 0xF4, 0x44, 0x06, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'M'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x43, 0x03, 0x40, 0xFD, 0x0D, 0xF2, 0xFD, 0x4E, 0xF2, 0xF9, 0xBA, 0xF2, 0xF6, 0xF6, 0xF2, 0xF3, 0x63, 0xF2, 0xF2, 0x02, 0xF2, 0xF2, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'N'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x04, 0x20, 0x23, 0x0F, 0xC0, 0x8B, 0x0F, 0xF3, 0x8B, 0x0F, 0xB9, 0x8B, 0x0F, 0x5E, 0x8B, 0x0F, 0x4B, 0xDB, 0x0F, 0x45, 0xFB, 0x0F, 0x40, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'O'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x36, 0x30, 0x05, 0xFE, 0xF6, 0x0C, 0xB0, 0xBD, 0x0F, 0x80, 0x7F, 0x0F, 0x80, 0x6F, 0x0F, 0x80, 0x8F, 0x0B, 0xC3, 0xCB, 0x03, 0xDF, 0xE3, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'P'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x04, 0x44, 0x10, 0x0F, 0xEE, 0xF6, 0x0F, 0x80, 0xBC, 0x0F, 0x80, 0xBC, 0x0F, 0xFF, 0xF6, 0x0F, 0x94, 0x10, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'Q'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x36, 0x30, 0x05, 0xFE, 0xF6, 0x0C, 0xB0, 0xBD, 0x0F, 0x80, 0x7F, 0x0F, 0x80, 0x6F, 0x0F, 0x80, 0x8F, 0x0B, 0xC3, 0xCB, 0x03, 0xDF, 0xF3, 0x00, 0x03, 0xD8, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00)
+/* 'R'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x04, 0x44, 0x20, 0x0F, 0xEE, 0xF5, 0x0F, 0x80, 0xDB, 0x0F, 0x82, 0xD9, 0x0F, 0xFF, 0xC1, 0x0F, 0x87, 0xF2, 0x0F, 0x80, 0xD9, 0x0F, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'S'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x01, 0x56, 0x20, 0x1E, 0xDC, 0xF0, 0x5F, 0x10, 0x20, 0x3F, 0xB5, 0x00, 0x05, 0xCF, 0xC1, 0x00, 0x04, 0xF5, 0x46, 0x14, 0xF5, 0x4E, 0xFF, 0xB0, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'T'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x04, 0x44, 0x44, 0x0F, 0xFF, 0xFF, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'U'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x42, 0x02, 0x40, 0xF8, 0x08, 0xF0, 0xF8, 0x08, 0xF0, 0xF8, 0x08, 0xF0, 0xF8, 0x08, 0xF0, 0xF8, 0x08, 0xF0, 0xCB, 0x3B, 0xD0, 0x5F, 0xFF, 0x50, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'V'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x14, 0x10, 0x14, 0x1F, 0x60, 0x6F, 0x0C, 0x90, 0x9C, 0x08, 0xC0, 0xC9, 0x05, 0xF1, 0xF5, 0x01, 0xF7, 0xF1, 0x00, 0xDD, 0xD0, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'W'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x23, 0x00, 0x03, 0x6D, 0x00, 0x0C, 0x4E, 0x16, 0x1D, 0x2F, 0x4F, 0x4F, 0x0F, 0x8D, 0x8F, 0x0E, 0xD7, 0xDF, 0x0C, 0xF1, 0xFD, 0x0A, 0xC0, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'X'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x42, 0x00, 0x42, 0x9D, 0x05, 0xF2, 0x1E, 0x8D, 0x80, 0x07, 0xFE, 0x10, 0x02, 0xFA, 0x00, 0x0A, 0xDF, 0x30, 0x4F, 0x4B, 0xB0, 0xCA, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'Y'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x42, 0x00, 0x32, 0xCB, 0x03, 0xF5, 0x5F, 0x3A, 0xC0, 0x0C, 0xCF, 0x50, 0x04, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'Z'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x03, 0x44, 0x44, 0x0D, 0xFF, 0xFF, 0x00, 0x01, 0xEA, 0x00, 0x0B, 0xE1, 0x00, 0x6F, 0x40, 0x02, 0xE9, 0x00, 0x0B, 0xE4, 0x44, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '['  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x99, 0x50, 0x00, 0xF9, 0x30, 0x00, 0xF6, 0x00, 0x00, 0xF6, 0x00, 0x00, 0xF6, 0x00, 0x00, 0xF6, 0x00, 0x00, 0xF6, 0x00, 0x00, 0xF6, 0x00, 0x00, 0xFB, 0x50, 0x00, 0x66, 0x30, 0x00, 0x00, 0x00)
+/* '\\' */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x04, 0xC0, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x0D, 0x30, 0x00, 0x06, 0xA0, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* ']'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x05, 0x99, 0x00, 0x03, 0x9F, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x6F, 0x00, 0x05, 0xBF, 0x00, 0x03, 0x66, 0x00, 0x00, 0x00, 0x00)
+/* '^'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x05, 0xFE, 0x20, 0x3E, 0x58, 0xC1, 0x44, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '_'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x95, 0x66, 0x66, 0x63)
+/* '`'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x2D, 0x40, 0x00, 0x02, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'a'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x98, 0x20, 0x5A, 0x8C, 0xC0, 0x17, 0x9B, 0xF0, 0xBE, 0x79, 0xF0, 0xDA, 0x09, 0xF0, 0x7F, 0xDC, 0xF0, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'b'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x09, 0x40, 0x00, 0x0F, 0x60, 0x00, 0x0F, 0x78, 0x70, 0x0F, 0xEA, 0xF7, 0x0F, 0x80, 0xBC, 0x0F, 0x60, 0x9D, 0x0F, 0xB1, 0xDA, 0x0F, 0xBF, 0xE3, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'c'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x79, 0x60, 0x0C, 0xE9, 0xB0, 0x3F, 0x40, 0x00, 0x4F, 0x20, 0x00, 0x2F, 0x80, 0x40, 0x06, 0xFF, 0xE0, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'd'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x04, 0x90, 0x00, 0x06, 0xF0, 0x07, 0x87, 0xF0, 0x7F, 0xAE, 0xF0, 0xBB, 0x07, 0xF0, 0xB9, 0x06, 0xF0, 0xAD, 0x1A, 0xF0, 0x3E, 0xFB, 0xF0, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'e'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x71, 0x09, 0xE8, 0xDA, 0x0F, 0xA6, 0x9F, 0x0F, 0xDB, 0xBB, 0x0D, 0xA0, 0x15, 0x04, 0xEF, 0xFB, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'f'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x49, 0x90, 0x00, 0xFB, 0x80, 0x38, 0xFA, 0x80, 0x4A, 0xFB, 0x90, 0x02, 0xF6, 0x00, 0x02, 0xF6, 0x00, 0x02, 0xF6, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'g'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x85, 0x80, 0x8F, 0xAE, 0xF0, 0xD9, 0x08, 0xF0, 0xD8, 0x08, 0xF0, 0xAD, 0x4C, 0xF0, 0x2C, 0xDC, 0xF0, 0x33, 0x2A, 0xD0, 0x5F, 0xFE, 0x50, 0x00, 0x10, 0x00)
+/* 'h'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x19, 0x20, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x69, 0x50, 0x2F, 0xCB, 0xF1, 0x2F, 0x44, 0xF4, 0x2F, 0x44, 0xF4, 0x2F, 0x44, 0xF4, 0x2F, 0x44, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'i'  */ FONT_ALPHA_GLYPH(0x00, 0x02, 0x00, 0x00, 0x4F, 0x20, 0x00, 0x28, 0x10, 0x05, 0x88, 0x10, 0x06, 0xBF, 0x20, 0x00, 0x4F, 0x20, 0x00, 0x4F, 0x20, 0x02, 0x5F, 0x42, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'j'  */ FONT_ALPHA_GLYPH(0x00, 0x02, 0x10, 0x00, 0x0F, 0x60, 0x00, 0x08, 0x30, 0x04, 0x88, 0x30, 0x05, 0x9F, 0x60, 0x00, 0x0F, 0x60, 0x00, 0x0F, 0x60, 0x00, 0x0F, 0x60, 0x00, 0x0F, 0x60, 0x00, 0x3F, 0x50, 0x0F, 0xFD, 0x10, 0x02, 0x10, 0x00)
+/* 'k'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x09, 0x40, 0x00, 0x0F, 0x60, 0x00, 0x0F, 0x61, 0x75, 0x0F, 0x6B, 0xC1, 0x0F, 0xEE, 0x10, 0x0F, 0xCF, 0x60, 0x0F, 0x67, 0xE1, 0x0F, 0x60, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'l'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x89, 0x90, 0x00, 0x7B, 0xF0, 0x00, 0x08, 0xF0, 0x00, 0x08, 0xF0, 0x00, 0x08, 0xF0, 0x00, 0x08, 0xF0, 0x00, 0x06, 0xF3, 0x20, 0x01, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'm'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x68, 0x60, 0xFA, 0xFA, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'n'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x49, 0x50, 0x2F, 0xCB, 0xF1, 0x2F, 0x44, 0xF4, 0x2F, 0x44, 0xF4, 0x2F, 0x44, 0xF4, 0x2F, 0x44, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'o'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x96, 0x00, 0x8E, 0x9E, 0x90, 0xE8, 0x07, 0xE0, 0xF6, 0x06, 0xF0, 0xCB, 0x1B, 0xD0, 0x3E, 0xFE, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'p'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x48, 0x70, 0x0F, 0xEA, 0xF7, 0x0F, 0x80, 0xBC, 0x0F, 0x60, 0x9D, 0x0F, 0xB2, 0xDA, 0x0F, 0xBF, 0xE3, 0x0F, 0x61, 0x10, 0x0F, 0x60, 0x00, 0x02, 0x10, 0x00)
+/* 'q'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x84, 0x80, 0x7F, 0xAE, 0xF0, 0xBB, 0x07, 0xF0, 0xB9, 0x06, 0xF0, 0xAD, 0x2B, 0xF0, 0x3E, 0xFB, 0xF0, 0x01, 0x16, 0xF0, 0x00, 0x06, 0xF0, 0x00, 0x01, 0x20)
+/* 'r'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x47, 0x81, 0x0F, 0xFA, 0xA4, 0x0F, 0x90, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 's'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x89, 0x60, 0x0E, 0xB8, 0xB0, 0x0E, 0xB5, 0x10, 0x04, 0xAE, 0xE2, 0x04, 0x01, 0xF5, 0x0E, 0xEE, 0xD1, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 't'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF2, 0x00, 0x69, 0xF8, 0x80, 0x7B, 0xFA, 0x90, 0x04, 0xF2, 0x00, 0x04, 0xF2, 0x00, 0x04, 0xF4, 0x20, 0x01, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'u'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x13, 0x80, 0x6F, 0x26, 0xF0, 0x6F, 0x26, 0xF0, 0x6F, 0x26, 0xF0, 0x5F, 0x39, 0xF0, 0x1E, 0xFC, 0xF0, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'v'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x02, 0x81, 0xAB, 0x07, 0xE0, 0x5F, 0x0B, 0xA0, 0x1F, 0x5F, 0x50, 0x0B, 0xCE, 0x00, 0x06, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'w'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x05, 0x5D, 0x00, 0x0C, 0x2F, 0x3F, 0x3F, 0x0E, 0x8D, 0x8F, 0x0C, 0xE6, 0xDC, 0x09, 0xE0, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'x'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x21, 0x83, 0x1D, 0xA9, 0xD1, 0x03, 0xFF, 0x30, 0x01, 0xEE, 0x10, 0x0A, 0xCC, 0xB0, 0x6F, 0x43, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* 'y'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x48, 0x0E, 0x80, 0xBB, 0x09, 0xD1, 0xF6, 0x03, 0xF9, 0xE1, 0x00, 0xCF, 0x90, 0x00, 0x6F, 0x40, 0x00, 0x8D, 0x00, 0x0F, 0xF5, 0x00, 0x02, 0x10, 0x00)
+/* 'z'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x83, 0x09, 0x9B, 0xF5, 0x00, 0x1E, 0xA0, 0x01, 0xCB, 0x00, 0x0B, 0xE3, 0x21, 0x2F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+/* '{'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x59, 0x60, 0x01, 0xF9, 0x40, 0x02, 0xF4, 0x00, 0x02, 0xF3, 0x00, 0x5B, 0xD1, 0x00, 0x5B, 0xD1, 0x00, 0x02, 0xF3, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF8, 0x20, 0x00, 0x59, 0x60, 0x00, 0x00, 0x00)
+/* '|'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x60, 0x00)
+/* '}'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x07, 0x94, 0x00, 0x04, 0xAE, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x2E, 0xA4, 0x00, 0x1D, 0xA4, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x03, 0x9E, 0x00, 0x07, 0x94, 0x00, 0x00, 0x00, 0x00)
+/* '~'  */ FONT_ALPHA_GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xB6, 0x92, 0x52, 0x6B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
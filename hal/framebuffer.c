@@ -0,0 +1,327 @@
+#include "framebuffer.h"
+#include <drivers/st7789v.h>
+#include <pico/sem.h>
+#include <stdbool.h>
+#include <string.h>
+#include <util/log.h>
+#include <util/trace.h>
+#include <util/types.h>
+
+#ifndef FRAMEBUFFER_LOG_LEVEL
+#   define FRAMEBUFFER_LOG_LEVEL LOG_LEVEL
+#endif
+
+#define FB_LOG(...) LOG_AT(FRAMEBUFFER_LOG_LEVEL, LOG_LEVEL_INFO, "framebuffer", __VA_ARGS__)
+
+internal force_inline
+uint32_t rect_area(const framebuffer_rect_t *rect) {
+    return (uint32_t) rect->width * rect->height;
+}
+
+internal framebuffer_rect_t rect_union(const framebuffer_rect_t *a, const framebuffer_rect_t *b) {
+    uint16_t left   = MIN(a->x, b->x);
+    uint16_t top    = MIN(a->y, b->y);
+    uint16_t right  = MAX(a->x + a->width, b->x + b->width);
+    uint16_t bottom = MAX(a->y + a->height, b->y + b->height);
+
+    return (framebuffer_rect_t) {
+        .x      = left,
+        .y      = top,
+        .width  = right - left,
+        .height = bottom - top
+    };
+}
+
+internal uint32_t rect_intersection_area(const framebuffer_rect_t *a, const framebuffer_rect_t *b) {
+    int32_t left   = MAX(a->x, b->x);
+    int32_t top    = MAX(a->y, b->y);
+    int32_t right  = MIN(a->x + a->width, b->x + b->width);
+    int32_t bottom = MIN(a->y + a->height, b->y + b->height);
+
+    if (right <= left || bottom <= top) {
+        return 0;
+    }
+
+    return (uint32_t) (right - left) * (bottom - top);
+}
+
+/**
+ * How many clean pixels would be sent if `a` and `b` were merged
+ */
+internal uint32_t rect_merge_waste(const framebuffer_rect_t *a, const framebuffer_rect_t *b) {
+    framebuffer_rect_t merged = rect_union(a, b);
+
+    return rect_area(&merged) + rect_intersection_area(a, b) - rect_area(a) - rect_area(b);
+}
+
+internal void framebuffer_remove_dirty(framebuffer_t *framebuffer, uint8_t index) {
+    framebuffer->dirty[index] = framebuffer->dirty[--framebuffer->dirty_count];
+}
+
+/**
+ * Sort the dirty regions from top to bottom
+ */
+internal void framebuffer_sort_dirty(framebuffer_t *framebuffer) {
+    for (uint8_t index = 1; index < framebuffer->dirty_count; index++) {
+        framebuffer_rect_t rect = framebuffer->dirty[index];
+        uint8_t position = index;
+
+        while (position > 0 && framebuffer->dirty[position - 1].y > rect.y) {
+            framebuffer->dirty[position] = framebuffer->dirty[position - 1];
+            position--;
+        }
+
+        framebuffer->dirty[position] = rect;
+    }
+}
+
+/**
+ * Clip a region to the framebuffer, returns false if nothing is left of it
+ */
+internal bool framebuffer_clip(
+    framebuffer_t *framebuffer,
+    int32_t x,
+    int32_t y,
+    int32_t width,
+    int32_t height,
+    framebuffer_rect_t *clipped
+) {
+    int32_t left   = MAX(x, 0);
+    int32_t top    = MAX(y, 0);
+    int32_t right  = MIN(x + width, (int32_t) framebuffer->width);
+    int32_t bottom = MIN(y + height, (int32_t) framebuffer->height);
+
+    if (right <= left || bottom <= top) {
+        return false;
+    }
+
+    *clipped = (framebuffer_rect_t) {
+        .x      = left,
+        .y      = top,
+        .width  = right - left,
+        .height = bottom - top
+    };
+
+    return true;
+}
+
+error_t framebuffer_init(
+    framebuffer_t *framebuffer,
+    color_t *pixels,
+    uint16_t x,
+    uint16_t y,
+    uint16_t width,
+    uint16_t height
+) {
+    if (x + width > ST7789V_DISPLAY_WIDTH || y + height > ST7789V_DISPLAY_HEIGHT) {
+        return -ENOTINRANGE;
+    }
+
+    framebuffer->pixels = pixels;
+    framebuffer->x = x;
+    framebuffer->y = y;
+    framebuffer->width = width;
+    framebuffer->height = height;
+    framebuffer->dirty_count = 0;
+    framebuffer->flush_pending = false;
+    framebuffer->vsync = false;
+
+    sem_init(&framebuffer->flush_signal, 0, 1);
+
+    framebuffer_mark_dirty(framebuffer, 0, 0, width, height);
+
+    return 0x00;
+}
+
+void framebuffer_mark_dirty(
+    framebuffer_t *framebuffer,
+    int32_t x,
+    int32_t y,
+    int32_t width,
+    int32_t height
+) {
+    framebuffer_rect_t rect;
+
+    if (!framebuffer_clip(framebuffer, x, y, width, height, &rect)) {
+        return;
+    }
+
+    for (int index = 0; index < framebuffer->dirty_count; index++) {
+        framebuffer_rect_t *other = &framebuffer->dirty[index];
+
+        // Overlapping regions are always merged, so no pixel is sent twice. The others are
+        // merged if the clean pixels in between are cheaper than setting another window.
+        if (rect_intersection_area(&rect, other) > 0 || rect_merge_waste(&rect, other) <= FRAMEBUFFER_MERGE_SLACK) {
+            rect = rect_union(&rect, other);
+
+            framebuffer_remove_dirty(framebuffer, index);
+
+            // The merged region can now touch regions we already checked
+            index = -1;
+        }
+    }
+
+    if (framebuffer->dirty_count == FRAMEBUFFER_MAX_DIRTY_RECTS) {
+        // No space left, merge with the region that grows the least
+        uint8_t best = 0;
+        uint32_t best_waste = UINT32_MAX;
+
+        for (uint8_t index = 0; index < framebuffer->dirty_count; index++) {
+            uint32_t waste = rect_merge_waste(&rect, &framebuffer->dirty[index]);
+
+            if (waste < best_waste) {
+                best = index;
+                best_waste = waste;
+            }
+        }
+
+        framebuffer_rect_t merged = rect_union(&rect, &framebuffer->dirty[best]);
+
+        framebuffer_remove_dirty(framebuffer, best);
+
+        // The merged region can overlap others, so mark it again
+        framebuffer_mark_dirty(framebuffer, merged.x, merged.y, merged.width, merged.height);
+
+        return;
+    }
+
+    framebuffer->dirty[framebuffer->dirty_count++] = rect;
+}
+
+void framebuffer_fill_rect(
+    framebuffer_t *framebuffer,
+    int32_t x,
+    int32_t y,
+    int32_t width,
+    int32_t height,
+    color_t color
+) {
+    framebuffer_rect_t rect;
+
+    if (!framebuffer_clip(framebuffer, x, y, width, height, &rect)) {
+        return;
+    }
+
+    for (uint16_t row = 0; row < rect.height; row++) {
+        color_t *line = &framebuffer->pixels[(rect.y + row) * framebuffer->width + rect.x];
+
+        for (uint16_t column = 0; column < rect.width; column++) {
+            line[column] = color;
+        }
+    }
+
+    framebuffer_mark_dirty(framebuffer, rect.x, rect.y, rect.width, rect.height);
+}
+
+void framebuffer_blit(
+    framebuffer_t *framebuffer,
+    int32_t x,
+    int32_t y,
+    uint16_t width,
+    uint16_t height,
+    const color_t *image
+) {
+    framebuffer_rect_t rect;
+
+    if (!framebuffer_clip(framebuffer, x, y, width, height, &rect)) {
+        return;
+    }
+
+    for (uint16_t row = 0; row < rect.height; row++) {
+        const color_t *source = &image[(rect.y - y + row) * width + (rect.x - x)];
+        color_t *line = &framebuffer->pixels[(rect.y + row) * framebuffer->width + rect.x];
+
+        memcpy(line, source, rect.width * sizeof(color_t));
+    }
+
+    framebuffer_mark_dirty(framebuffer, rect.x, rect.y, rect.width, rect.height);
+}
+
+error_t framebuffer_flush(framebuffer_t *framebuffer) {
+    if (framebuffer->dirty_count == 0) {
+        return 0x00;
+    }
+
+    // The flush signal can only be waited for once, so the previous flush needs to be done
+    framebuffer_wait(framebuffer);
+
+    if (framebuffer->vsync) {
+        // Send the regions top to bottom, starting right behind the scan, so the scan never
+        // passes over a region while it's being written
+        framebuffer_sort_dirty(framebuffer);
+
+        error_t error = st7789v_queue_vsync(framebuffer->y + framebuffer->dirty[0].y);
+
+        if (error != 0x00) {
+            return error;
+        }
+    }
+
+    for (uint8_t index = 0; index < framebuffer->dirty_count; index++) {
+        framebuffer_rect_t *rect = &framebuffer->dirty[index];
+        bool last_rect = index + 1 == framebuffer->dirty_count;
+
+        uint16_t left = framebuffer->x + rect->x;
+        uint16_t top  = framebuffer->y + rect->y;
+
+        error_t error = st7789v_display_set_column_address_window(left, left + rect->width - 1);
+
+        if (error != 0x00) {
+            return error;
+        }
+
+        if ((error = st7789v_display_set_row_address_window(top, top + rect->height - 1)) != 0x00) {
+            return error;
+        }
+
+        color_t *first_line = &framebuffer->pixels[rect->y * framebuffer->width + rect->x];
+
+        if (rect->width == framebuffer->width) {
+            // The lines are contiguous in memory, send all of them at once
+            error = st7789v_display_memory_write_pixels_async(
+                /*            pixels: */ first_line,
+                /*             count: */ rect_area(rect),
+                /* completion_signal: */ last_rect ? &framebuffer->flush_signal : NULL,
+                /*  continue_writing: */ false
+            );
+
+            if (error != 0x00) {
+                return error;
+            }
+
+            continue;
+        }
+
+        for (uint16_t row = 0; row < rect->height; row++) {
+            bool last_row = row + 1 == rect->height;
+
+            error = st7789v_display_memory_write_pixels_async(
+                /*            pixels: */ &first_line[row * framebuffer->width],
+                /*             count: */ rect->width,
+                /* completion_signal: */ last_rect && last_row ? &framebuffer->flush_signal : NULL,
+                /*  continue_writing: */ row > 0
+            );
+
+            if (error != 0x00) {
+                return error;
+            }
+        }
+    }
+
+    framebuffer->dirty_count = 0;
+    framebuffer->flush_pending = true;
+
+    TRACE_COUNT(TRACE_COUNTER_FRAMES_FLUSHED, 1);
+
+    return 0x00;
+}
+
+void framebuffer_wait(framebuffer_t *framebuffer) {
+    if (!framebuffer->flush_pending) {
+        return;
+    }
+
+    sem_acquire_blocking(&framebuffer->flush_signal);
+
+    framebuffer->flush_pending = false;
+}
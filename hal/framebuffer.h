@@ -0,0 +1,186 @@
+#ifndef HAL_FRAMEBUFFER_H
+#define HAL_FRAMEBUFFER_H
+
+#include <hal/color.h>
+#include <pico/sem.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+#include <errno.h>
+
+/**
+ * How many separate dirty regions a framebuffer keeps before merging the closest ones
+ */
+#define FRAMEBUFFER_MAX_DIRTY_RECTS     8
+
+/**
+ * How much bigger (in pixels) the union of two rectangles can be than both of them together
+ * to merge them anyway, sending a few clean pixels is cheaper than an extra window set.
+ */
+#define FRAMEBUFFER_MERGE_SLACK         256
+
+/**
+ * An rectangle, in pixels
+ */
+typedef struct framebuffer_rect_t
+{
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+} framebuffer_rect_t;
+
+/**
+ * A framebuffer keeping a copy of a region of the display memory, tracking which parts of it
+ * changed since the last flush, so only these parts are sent to the display.
+ *
+ * The framebuffer doesn't need to cover the whole display, it can be placed anywhere on it
+ * with `x` and `y`, this way a 150 KB full-frame buffer is only needed if you really want it.
+ */
+typedef struct framebuffer_t
+{
+    /**
+     * The pixels, `width * height` colors in the CPU's byte order, they're sent as they are
+     */
+    color_t             *pixels;
+
+    /**
+     * Where this framebuffer is on the display
+     */
+    uint16_t            x;
+    uint16_t            y;
+
+    /**
+     * The size of this framebuffer
+     */
+    uint16_t            width;
+    uint16_t            height;
+
+    /**
+     * The regions changed since the last flush, no two of them overlap
+     */
+    framebuffer_rect_t  dirty[FRAMEBUFFER_MAX_DIRTY_RECTS];
+    uint8_t             dirty_count;
+
+    /**
+     * Released when the last flush is sent to the display
+     */
+    semaphore_t         flush_signal;
+
+    /**
+     * If a flush was queued and `framebuffer_wait` wasn't called after it
+     */
+    bool                flush_pending;
+
+    /**
+     * If flushes should be paced by the panel's scan (see `st7789v_queue_vsync`), so they
+     * never tear. False after `framebuffer_init`, and needs vsync enabled in the driver.
+     */
+    bool                vsync;
+} framebuffer_t;
+
+/**
+ * Initialize a framebuffer
+ *
+ * PARAMETERS
+ * - framebuffer: the framebuffer to initialize
+ * - pixels: the memory for the pixels, it needs to hold `width * height` colors
+ * - x, y: where this framebuffer is on the display
+ * - width, height: the size of this framebuffer
+ *
+ * NOTES
+ * - The framebuffer starts with everything marked as dirty, so the first flush sends all of it.
+ *
+ * RETURN VALUE
+ * - ENOTINRANGE: if the framebuffer doesn't fit in the display
+ */
+external error_t framebuffer_init(
+    framebuffer_t *framebuffer,
+    color_t *pixels,
+    uint16_t x,
+    uint16_t y,
+    uint16_t width,
+    uint16_t height
+);
+
+/**
+ * Mark a region of the framebuffer as changed, it's clipped to the framebuffer, and merged
+ * with the regions already marked when that's cheaper to send.
+ *
+ * PARAMETERS
+ * - framebuffer: the framebuffer to mark
+ * - x, y, width, height: the region that changed, relative to the framebuffer
+ */
+external void framebuffer_mark_dirty(
+    framebuffer_t *framebuffer,
+    int32_t x,
+    int32_t y,
+    int32_t width,
+    int32_t height
+);
+
+/**
+ * Fill a rectangle of the framebuffer with a color, and mark it as dirty
+ *
+ * PARAMETERS
+ * - framebuffer: the framebuffer to draw into
+ * - x, y, width, height: the rectangle to fill, relative to the framebuffer
+ * - color: the color to fill
+ */
+external void framebuffer_fill_rect(
+    framebuffer_t *framebuffer,
+    int32_t x,
+    int32_t y,
+    int32_t width,
+    int32_t height,
+    color_t color
+);
+
+/**
+ * Copy an image into the framebuffer, and mark it as dirty
+ *
+ * PARAMETERS
+ * - framebuffer: the framebuffer to draw into
+ * - x, y: where to put the image, relative to the framebuffer
+ * - width, height: the size of the image
+ * - image: `width * height` colors
+ */
+external void framebuffer_blit(
+    framebuffer_t *framebuffer,
+    int32_t x,
+    int32_t y,
+    uint16_t width,
+    uint16_t height,
+    const color_t *image
+);
+
+/**
+ * Queue the dirty regions of the framebuffer to be sent to the display, and clear them.
+ *
+ * PARAMETERS
+ * - framebuffer: the framebuffer to flush
+ *
+ * NOTES
+ * - This returns as soon everything is queued, the pixels of the flushed regions are read by
+ *   the DMA after that, call `framebuffer_wait` before drawing into them again if you don't
+ *   want the display to get a half-drawn region.
+ * - This talks to the display driver, so only call it from the display core, use
+ *   `display_flush_framebuffer` from core 0.
+ * - If it fails the regions stay dirty, the next flush sends them all again.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ */
+external error_t framebuffer_flush(framebuffer_t *framebuffer);
+
+/**
+ * Wait the last flush of this framebuffer to be sent to the display
+ *
+ * PARAMETERS
+ * - framebuffer: the framebuffer to wait
+ */
+external void framebuffer_wait(framebuffer_t *framebuffer);
+
+#endif /** HAL_FRAMEBUFFER_H */
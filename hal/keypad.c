@@ -0,0 +1,179 @@
+#include "keypad.h"
+#include <hardware/sync.h>
+#if PICO_ON_DEVICE
+#   include <hardware/gpio.h>
+#   include <hardware/irq.h>
+#   include <hardware/timer.h>
+#endif
+#include <pico/time.h>
+#include <util/log.h>
+#include <util/spsc.h>
+
+#ifndef KEYPAD_LOG_LEVEL
+#   define KEYPAD_LOG_LEVEL LOG_LEVEL
+#endif
+
+#define KEYPAD_LOG(...) LOG_AT(KEYPAD_LOG_LEVEL, LOG_LEVEL_INFO, "keypad", __VA_ARGS__)
+
+#define KEYPAD_ROW_MASK         (((1u << KEYPAD_ROWS) - 1) << KEYPAD_PIN_ROW_BASE)
+#define KEYPAD_COLUMN_MASK      (((1u << KEYPAD_COLUMNS) - 1) << KEYPAD_PIN_COLUMN_BASE)
+
+/**
+ * The scans (the timer's IRQ handler) are the only producer, the application the only
+ * consumer
+ */
+internal keypad_event_t event_storage[KEYPAD_QUEUE_SIZE];
+internal spsc_queue_t events;
+internal volatile uint32_t dropped = 0;
+
+/**
+ * A bit for each key, the debounced state and the last scan
+ */
+internal volatile uint64_t pressed = 0;
+
+#if PICO_ON_DEVICE
+internal uint64_t last_scan = 0;
+
+internal void keypad_set_edge_irqs(bool enable) {
+    for (uint column = 0; column < KEYPAD_COLUMNS; column++) {
+        gpio_acknowledge_irq(KEYPAD_PIN_COLUMN_BASE + column, GPIO_IRQ_EDGE_FALL);
+        gpio_set_irq_enabled(KEYPAD_PIN_COLUMN_BASE + column, GPIO_IRQ_EDGE_FALL, enable);
+    }
+}
+
+/**
+ * The columns that are pulled low, with every row driven
+ */
+internal force_inline uint32_t keypad_read_columns(void) {
+    return (~gpio_get_all() & KEYPAD_COLUMN_MASK) >> KEYPAD_PIN_COLUMN_BASE;
+}
+
+internal uint64_t keypad_scan(void) {
+    uint64_t keys = 0;
+
+    for (uint row = 0; row < KEYPAD_ROWS; row++) {
+        // The row outputs are always low, only the driven row is an output: the others float
+        // so a key down in them can't pull the columns
+        gpio_set_dir_masked(KEYPAD_ROW_MASK, 1u << (KEYPAD_PIN_ROW_BASE + row));
+        busy_wait_us_32(KEYPAD_SETTLE_US);
+
+        keys |= (uint64_t) keypad_read_columns() << (row * KEYPAD_COLUMNS);
+    }
+
+    // Every row driven again, for the edge interrupts
+    gpio_set_dir_masked(KEYPAD_ROW_MASK, KEYPAD_ROW_MASK);
+
+    return keys;
+}
+
+internal void keypad_push(uint8_t key, bool down, uint32_t now) {
+    keypad_event_t event = { key, down, now };
+
+    if (!spsc_queue_push(&events, &event)) {
+        dropped++;
+    }
+}
+
+internal int64_t keypad_scan_alarm_callback(alarm_id_t alarm_id, void *data) {
+    uint64_t scan = keypad_scan();
+    uint32_t now = time_us_32();
+
+    // The keys whose last two scans agree, and differ from their state
+    uint64_t changed = (scan ^ pressed) & ~(scan ^ last_scan);
+
+    last_scan = scan;
+    pressed ^= changed;
+
+    for (uint8_t key = 0; changed != 0; key++, changed >>= 1) {
+        if (changed & 1) {
+            keypad_push(key, (scan >> key) & 1, now);
+        }
+    }
+
+    if (scan != 0 || pressed != 0) {
+        return KEYPAD_SCAN_US;
+    }
+
+    keypad_set_edge_irqs(true);
+
+    // A key that went down after the scan made no edge the interrupt could see
+    if (keypad_read_columns() != 0) {
+        keypad_set_edge_irqs(false);
+
+        return KEYPAD_SCAN_US;
+    }
+
+    return 0;
+}
+
+internal void __isr keypad_irq_handler(void) {
+    bool edge = false;
+
+    for (uint column = 0; column < KEYPAD_COLUMNS; column++) {
+        if (gpio_get_irq_event_mask(KEYPAD_PIN_COLUMN_BASE + column) & GPIO_IRQ_EDGE_FALL) {
+            edge = true;
+        }
+    }
+
+    if (!edge) {
+        // The IO bank IRQ is shared, this was caused by another pin
+        return;
+    }
+
+    // The scans take over until every key is up again
+    keypad_set_edge_irqs(false);
+
+    add_alarm_in_us(KEYPAD_SCAN_US, keypad_scan_alarm_callback, NULL, true);
+}
+
+void keypad_init(void) {
+    spsc_queue_init(&events, event_storage, sizeof(keypad_event_t), KEYPAD_QUEUE_SIZE);
+
+    gpio_init_mask(KEYPAD_ROW_MASK | KEYPAD_COLUMN_MASK);
+
+    gpio_put_masked(KEYPAD_ROW_MASK, 0);
+    gpio_set_dir_masked(KEYPAD_ROW_MASK | KEYPAD_COLUMN_MASK, KEYPAD_ROW_MASK);
+
+    for (uint column = 0; column < KEYPAD_COLUMNS; column++) {
+        gpio_pull_up(KEYPAD_PIN_COLUMN_BASE + column);
+    }
+
+    // The pull ups need a moment before the columns read high
+    busy_wait_us_32(KEYPAD_SETTLE_US);
+
+    gpio_add_raw_irq_handler_masked(KEYPAD_COLUMN_MASK, keypad_irq_handler);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+
+    keypad_set_edge_irqs(true);
+
+    KEYPAD_LOG(
+        "%dx%d keys, rows from pin %d, columns from pin %d",
+        KEYPAD_ROWS,
+        KEYPAD_COLUMNS,
+        KEYPAD_PIN_ROW_BASE,
+        KEYPAD_PIN_COLUMN_BASE
+    );
+}
+#else
+void keypad_init(void) {
+    spsc_queue_init(&events, event_storage, sizeof(keypad_event_t), KEYPAD_QUEUE_SIZE);
+}
+#endif
+
+bool keypad_pop(keypad_event_t *event) {
+    return spsc_queue_pop(&events, event);
+}
+
+bool keypad_is_pressed(uint8_t key) {
+    // The M0+ reads the state in two words, the scan can't run between them
+    uint32_t status = save_and_disable_interrupts();
+    uint64_t keys = pressed;
+
+    restore_interrupts(status);
+
+    return (keys >> key) & 1;
+}
+
+uint32_t keypad_dropped(void) {
+    return dropped;
+}
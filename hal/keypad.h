@@ -0,0 +1,88 @@
+#ifndef HAL_KEYPAD_H
+#define HAL_KEYPAD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+
+/**
+ * The keypad: a matrix of keys, the rows are driven and the columns read (pulled up, a key
+ * connects its row and its column).
+ *
+ * Nothing is polled while no key is down: every row is driven low, and a key pulls its
+ * column low, which is an edge interrupt. The interrupt starts a timer that scans the
+ * matrix every `KEYPAD_SCAN_US`, a key only changes state when two scans in a row agree (the
+ * debounce), and the timer stops when every key is up, going back to the interrupts.
+ *
+ * The scans run in the timer's IRQ handler, so a key is seen in a bounded time however busy
+ * the application is, its events wait in a queue until it takes them.
+ */
+
+#define KEYPAD_ROWS             6
+#define KEYPAD_COLUMNS          6
+#define KEYPAD_KEYS             (KEYPAD_ROWS * KEYPAD_COLUMNS)
+
+/**
+ * The rows and the columns are on consecutive pins, from these
+ */
+#define KEYPAD_PIN_ROW_BASE     2
+#define KEYPAD_PIN_COLUMN_BASE  8
+
+/**
+ * The time between two scans while a key is down, a key needs to be stable for this long
+ */
+#define KEYPAD_SCAN_US          5000
+
+/**
+ * How long a column takes to follow the row that was just driven
+ */
+#define KEYPAD_SETTLE_US        2
+
+/**
+ * How many events wait for the application, needs to be a power of two
+ */
+#define KEYPAD_QUEUE_SIZE       16
+
+#define KEYPAD_KEY(row, column) ((row) * KEYPAD_COLUMNS + (column))
+
+typedef struct keypad_event_t
+{
+    /** The key, `KEYPAD_KEY(row, column)` */
+    uint8_t     key;
+
+    /** If the key went down, or up */
+    bool        pressed;
+
+    /** When the scan saw it, in microseconds since boot (wraps after ~71 minutes) */
+    uint32_t    time_us;
+} keypad_event_t;
+
+/**
+ * Set the pins up and wait for a key, call it from core 0: the interrupts and the scans run
+ * on the core that calls it
+ *
+ * NOTES
+ * - The host builds have no keypad, no event ever comes.
+ */
+external void keypad_init(void);
+
+/**
+ * Take the oldest event, only call it from the core that called `keypad_init`
+ *
+ * RETURN VALUE
+ * - false if there's none
+ */
+external bool keypad_pop(keypad_event_t *event);
+
+/**
+ * If a key is down, as of the last scan
+ */
+external bool keypad_is_pressed(uint8_t key);
+
+/**
+ * How many events were dropped because the queue was full
+ */
+external uint32_t keypad_dropped(void);
+
+#endif /** HAL_KEYPAD_H */
@@ -0,0 +1,164 @@
+#include "power.h"
+#include <drivers/st7789v.h>
+#include <hal/display.h>
+#include <hardware/sync.h>
+#if PICO_ON_DEVICE
+#   include <hardware/clocks.h>
+#endif
+#include <pico/sem.h>
+#include <pico/time.h>
+#include <stdint.h>
+#include <util/log.h>
+
+#ifndef POWER_LOG_LEVEL
+#   define POWER_LOG_LEVEL LOG_LEVEL
+#endif
+
+#define POWER_LOG(...) LOG_AT(POWER_LOG_LEVEL, LOG_LEVEL_INFO, "power", __VA_ARGS__)
+
+internal power_state_t state = POWER_STATE_ACTIVE;
+internal bool display_attached = false;
+internal absolute_time_t last_activity;
+
+#if PICO_ON_DEVICE
+/**
+ * The system clock before it was lowered, it's put back on the next key
+ */
+internal uint32_t normal_clock_khz = 0;
+#endif
+
+/**
+ * The state the display is in, only used by core 1
+ */
+internal power_state_t display_state = POWER_STATE_ACTIVE;
+
+/******************** DISPLAY *************************/
+
+/**
+ * Move the display to a state, on core 1 (the driver is only used from there)
+ */
+internal void power_display_switch(void *data) {
+    power_state_t target = (power_state_t) (uintptr_t) data;
+
+    if (target == display_state) {
+        return;
+    }
+
+    if (display_state == POWER_STATE_SLEEP) {
+        st7789v_display_sleep_out(false);
+    }
+
+    switch (target) {
+    case POWER_STATE_ACTIVE:
+        st7789v_display_set_idle(false);
+        break;
+
+    case POWER_STATE_IDLE:
+        st7789v_display_set_idle(true);
+        break;
+
+    case POWER_STATE_SLEEP:
+        // The memory is kept, the idle mode is left on until the display wakes up
+        st7789v_display_sleep_in(false);
+        break;
+    }
+
+    display_state = target;
+}
+
+internal void power_switch(power_state_t target) {
+    if (target == state) {
+        return;
+    }
+
+    POWER_LOG("state %d -> %d", state, target);
+
+#if PICO_ON_DEVICE
+    if (state == POWER_STATE_SLEEP) {
+        // Before the display is used again, its SPI dividers are for this clock
+        set_sys_clock_khz(normal_clock_khz, false);
+
+        // `set_sys_clock_48mhz` moved the peripheral clock to the USB PLL, and setting the
+        // system clock leaves it there
+        clock_configure(
+            /* clk_index: */ clk_peri,
+            /*       src: */ 0,
+            /*    auxsrc: */ CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLK_SYS,
+            /*  src_freq: */ normal_clock_khz * 1000,
+            /*      freq: */ normal_clock_khz * 1000
+        );
+    }
+#endif
+
+    if (display_attached) {
+        semaphore_t done;
+
+        sem_init(&done, 0, 1);
+
+        display_submit(&(display_job_t) {
+            .type               = DISPLAY_JOB_CALL,
+            .call               = { power_display_switch, (void *) (uintptr_t) target },
+            .completion_signal  = target == POWER_STATE_SLEEP ? &done : NULL
+        });
+
+        // Nothing is sent to the display once it sleeps, so the SPI is free and its clock
+        // can change
+        if (target == POWER_STATE_SLEEP) {
+            sem_acquire_blocking(&done);
+        }
+    }
+
+#if PICO_ON_DEVICE
+    if (target == POWER_STATE_SLEEP) {
+        normal_clock_khz = clock_get_hz(clk_sys) / 1000;
+
+        set_sys_clock_48mhz();
+    }
+#endif
+
+    state = target;
+}
+
+/******************** POLICY *************************/
+
+void power_init(bool has_display) {
+    display_attached = has_display;
+    last_activity = get_absolute_time();
+}
+
+void power_activity(void) {
+    last_activity = get_absolute_time();
+
+    power_switch(POWER_STATE_ACTIVE);
+}
+
+void power_wait(uint32_t timeout_us) {
+    int64_t inactive_us = absolute_time_diff_us(last_activity, get_absolute_time());
+
+    if (inactive_us >= POWER_SLEEP_US) {
+        power_switch(POWER_STATE_SLEEP);
+    } else if (inactive_us >= POWER_IDLE_US) {
+        power_switch(POWER_STATE_IDLE);
+    }
+
+#if PICO_ON_DEVICE
+    best_effort_wfe_or_timeout(make_timeout_time_us(timeout_us));
+#else
+    // The host has no events to wait for
+    sleep_us(timeout_us);
+#endif
+}
+
+void power_halt(void) {
+    for (;;) {
+#if PICO_ON_DEVICE
+        __wfi();
+#else
+        sleep_ms(1000 * 1000);
+#endif
+    }
+}
+
+power_state_t power_state(void) {
+    return state;
+}
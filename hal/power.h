@@ -0,0 +1,81 @@
+#ifndef HAL_POWER_H
+#define HAL_POWER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+
+/**
+ * The power policy of core 0: instead of polling, core 0 sleeps (WFE) until an interrupt or
+ * an event wakes it up (the USB, the DMA and the alarms have interrupts, and core 1 sends an
+ * event when it takes a job), and the longer nothing is typed the less power is used:
+ *
+ * - after `POWER_IDLE_US`, the display goes into its idle mode (8 colours)
+ * - after `POWER_SLEEP_US`, the display goes to sleep, and the system clock is lowered to
+ *   48MHz (from the USB PLL) until the next key
+ *
+ * The clock is only lowered while the display sleeps: the peripheral clock is put back on
+ * the system clock when it's restored, and the SPI dividers were set for the normal one (a
+ * lower clock only makes the SPI slower, but raising it would go past the display's limit).
+ */
+
+/**
+ * How long without a key before the display goes into its idle mode
+ */
+#define POWER_IDLE_US   (30 * 1000 * 1000)
+
+/**
+ * How long without a key before the display goes to sleep
+ */
+#define POWER_SLEEP_US  (2 * 60 * 1000 * 1000)
+
+typedef enum power_state_t: byte
+{
+    POWER_STATE_ACTIVE  = 0x00,
+
+    /** The display shows 8 colours */
+    POWER_STATE_IDLE    = 0x01,
+
+    /** The display is off, and the system clock is lowered */
+    POWER_STATE_SLEEP   = 0x02
+} power_state_t;
+
+/**
+ * Start counting the inactivity from now, call it after `display_start`
+ *
+ * PARAMETERS
+ * - has_display: if the display was found, its power modes are left alone if not
+ */
+external void power_init(bool has_display);
+
+/**
+ * Something was typed: wake the display and the clock up if they were lowered
+ *
+ * NOTES
+ * - The clock is back when this returns, the display is woken up by core 1 (the jobs
+ *   submitted after this are run after it).
+ */
+external void power_activity(void);
+
+/**
+ * Sleep until an interrupt or an event, or until `timeout_us` passed, after lowering the
+ * power if nothing was typed for long enough
+ *
+ * NOTES
+ * - It can return early (any interrupt wakes the core up), the caller checks what it waits
+ *   for and calls this again.
+ */
+external void power_wait(uint32_t timeout_us);
+
+/**
+ * Stop core 0 for good, sleeping between the interrupts
+ */
+external void __attribute__((noreturn)) power_halt(void);
+
+/**
+ * The current state, for the logs
+ */
+external power_state_t power_state(void);
+
+#endif /** HAL_POWER_H */
@@ -0,0 +1,275 @@
+#include "render.h"
+#include <drivers/st7789v.h>
+#include <pico/sem.h>
+#include <stdbool.h>
+#include <string.h>
+#include <util/log.h>
+#include <util/types.h>
+
+#ifndef RENDER_LOG_LEVEL
+#   define RENDER_LOG_LEVEL LOG_LEVEL
+#endif
+
+#define RENDER_LOG(...) LOG_AT(RENDER_LOG_LEVEL, LOG_LEVEL_INFO, "render", __VA_ARGS__)
+
+#define RENDER_STRIP_COUNT 2
+
+/**
+ * The ping-pong strip buffers, one is being sent by the DMA while the other is rasterized
+ */
+internal color_t strips[RENDER_STRIP_COUNT][ST7789V_DISPLAY_WIDTH * RENDER_STRIP_HEIGHT];
+
+/**
+ * Released by the DMA IRQ handler when the strip is sent, and acquired before drawing into it
+ */
+internal semaphore_t strip_free[RENDER_STRIP_COUNT];
+
+/**
+ * If each draw waits for the scan to reach it
+ */
+internal bool vsync = false;
+
+void render_init(void) {
+    for (int index = 0; index < RENDER_STRIP_COUNT; index++) {
+        sem_init(&strip_free[index], 1, 1);
+    }
+}
+
+internal render_command_t *render_list_add(render_list_t *list) {
+    if (list->count >= RENDER_MAX_COMMANDS) {
+        RENDER_LOG("display list is full, dropping command");
+
+        return NULL;
+    }
+
+    return &list->commands[list->count++];
+}
+
+void render_list_clear(render_list_t *list, color_t background) {
+    list->count = 0;
+    list->background = background;
+}
+
+error_t render_fill_rect(
+    render_list_t *list,
+    int16_t x,
+    int16_t y,
+    uint16_t width,
+    uint16_t height,
+    color_t color
+) {
+    render_command_t *command = render_list_add(list);
+
+    if (command == NULL) {
+        return -ENOTINRANGE;
+    }
+
+    *command = (render_command_t) {
+        .type   = RENDER_COMMAND_FILL_RECT,
+        .x      = x,
+        .y      = y,
+        .width  = width,
+        .height = height,
+        .color  = color
+    };
+
+    return 0x00;
+}
+
+error_t render_bitmap(
+    render_list_t *list,
+    int16_t x,
+    int16_t y,
+    uint16_t width,
+    uint16_t height,
+    const byte *bits,
+    uint16_t stride,
+    color_t color
+) {
+    render_command_t *command = render_list_add(list);
+
+    if (command == NULL) {
+        return -ENOTINRANGE;
+    }
+
+    *command = (render_command_t) {
+        .type   = RENDER_COMMAND_BITMAP,
+        .x      = x,
+        .y      = y,
+        .width  = width,
+        .height = height,
+        .color  = color,
+        .stride = stride,
+        .data   = bits
+    };
+
+    return 0x00;
+}
+
+error_t render_image(
+    render_list_t *list,
+    int16_t x,
+    int16_t y,
+    uint16_t width,
+    uint16_t height,
+    const color_t *pixels
+) {
+    render_command_t *command = render_list_add(list);
+
+    if (command == NULL) {
+        return -ENOTINRANGE;
+    }
+
+    *command = (render_command_t) {
+        .type   = RENDER_COMMAND_IMAGE,
+        .x      = x,
+        .y      = y,
+        .width  = width,
+        .height = height,
+        .data   = pixels
+    };
+
+    return 0x00;
+}
+
+/**
+ * Rasterize one command into a strip.
+ *
+ * PARAMETERS
+ * - strip: the strip buffer, `width` pixels per line
+ * - left, top: the display position of the strip's first pixel
+ * - width, height: the size of the strip
+ */
+internal void render_command_rasterize(
+    const render_command_t *command,
+    color_t *strip,
+    int32_t left,
+    int32_t top,
+    int32_t width,
+    int32_t height
+) {
+    // Clip the command with the strip
+    int32_t x0 = MAX(command->x, left);
+    int32_t y0 = MAX(command->y, top);
+    int32_t x1 = MIN(command->x + command->width, left + width);
+    int32_t y1 = MIN(command->y + command->height, top + height);
+
+    if (x1 <= x0 || y1 <= y0) {
+        return;
+    }
+
+    for (int32_t y = y0; y < y1; y++) {
+        color_t *line = &strip[(y - top) * width];
+        int32_t row = y - command->y;
+
+        switch (command->type) {
+        case RENDER_COMMAND_FILL_RECT:
+            for (int32_t x = x0; x < x1; x++) {
+                line[x - left] = command->color;
+            }
+            break;
+
+        case RENDER_COMMAND_BITMAP: {
+            const byte *bits = (const byte *) command->data + row * command->stride;
+
+            for (int32_t x = x0; x < x1; x++) {
+                int32_t column = x - command->x;
+
+                if (bits[column >> 3] & (0x80 >> (column & 7))) {
+                    line[x - left] = command->color;
+                }
+            }
+            break;
+        }
+
+        case RENDER_COMMAND_IMAGE: {
+            const color_t *pixels = (const color_t *) command->data + row * command->width;
+
+            memcpy(&line[x0 - left], &pixels[x0 - command->x], (x1 - x0) * sizeof(color_t));
+            break;
+        }
+        }
+    }
+}
+
+error_t render_list_draw(
+    const render_list_t *list,
+    uint16_t x,
+    uint16_t y,
+    uint16_t width,
+    uint16_t height
+) {
+    if (width == 0 || height == 0 || x + width > ST7789V_DISPLAY_WIDTH || y + height > ST7789V_DISPLAY_HEIGHT) {
+        return -ENOTINRANGE;
+    }
+
+    error_t error = st7789v_display_set_column_address_window(x, x + width - 1);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    error = st7789v_display_set_row_address_window(y, y + height - 1);
+
+    if (error == 0x00 && vsync) {
+        // The other strips follow right behind the first one, they could only be caught by
+        // the next scan if the whole region took longer than a frame to draw
+        error = st7789v_queue_vsync(y);
+    }
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    color_t background = list->background;
+
+    int current = 0;
+
+    for (uint16_t top = y; top < y + height; top += RENDER_STRIP_HEIGHT) {
+        uint16_t rows = MIN(RENDER_STRIP_HEIGHT, y + height - top);
+        size_t pixel_count = (size_t) rows * width;
+
+        color_t *strip = strips[current];
+
+        // Wait the DMA to finish sending this strip the last time it was used
+        sem_acquire_blocking(&strip_free[current]);
+
+        for (size_t index = 0; index < pixel_count; index++) {
+            strip[index] = background;
+        }
+
+        for (uint16_t index = 0; index < list->count; index++) {
+            render_command_rasterize(&list->commands[index], strip, x, top, width, rows);
+        }
+
+        // The display keeps writing where the last strip ended, inside the window we set
+        error = st7789v_display_memory_write_pixels_async(
+            /*            pixels: */ strip,
+            /*             count: */ pixel_count,
+            /* completion_signal: */ &strip_free[current],
+            /*  continue_writing: */ top != y
+        );
+
+        if (error != 0x00) {
+            // Nothing will release it if the strip wasn't queued
+            sem_release(&strip_free[current]);
+
+            return error;
+        }
+
+        current = (current + 1) % RENDER_STRIP_COUNT;
+    }
+
+    return 0x00;
+}
+
+void render_set_vsync(bool enable) {
+    vsync = enable;
+}
+
+void render_wait(void) {
+    for (int index = 0; index < RENDER_STRIP_COUNT; index++) {
+        sem_acquire_blocking(&strip_free[index]);
+        sem_release(&strip_free[index]);
+    }
+}
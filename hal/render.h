@@ -0,0 +1,199 @@
+#ifndef HAL_RENDER_H
+#define HAL_RENDER_H
+
+#include <hal/color.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+#include <errno.h>
+
+/**
+ * How many lines of the display are rasterized at once, the renderer keeps two strips of
+ * `ST7789V_DISPLAY_WIDTH * RENDER_STRIP_HEIGHT` pixels, one is sent while the other is drawn.
+ */
+#define RENDER_STRIP_HEIGHT     16
+
+/**
+ * How many commands a display list holds
+ */
+#define RENDER_MAX_COMMANDS     128
+
+/**
+ * The kind of a command recorded in a display list
+ */
+typedef enum render_command_type_t: byte
+{
+    /** Fill a rectangle with `color` */
+    RENDER_COMMAND_FILL_RECT    = 0x00,
+
+    /** Draw the set bits of a 1-bit-per-pixel bitmap with `color`, the other bits are transparent */
+    RENDER_COMMAND_BITMAP       = 0x01,
+
+    /** Copy an image */
+    RENDER_COMMAND_IMAGE        = 0x02
+} render_command_type_t;
+
+/**
+ * A drawing command, in display coordinates
+ */
+typedef struct render_command_t
+{
+    render_command_type_t   type;
+
+    int16_t                 x;
+    int16_t                 y;
+    uint16_t                width;
+    uint16_t                height;
+
+    color_t                 color;
+
+    /**
+     * The bytes per row of `data`, for bitmaps
+     */
+    uint16_t                stride;
+
+    /**
+     * The bitmap (MSB is the leftmost pixel) or image of this command, must be kept alive until
+     * the list is drawn
+     */
+    const void              *data;
+} render_command_t;
+
+/**
+ * A display list, the commands are recorded once and rasterized strip by strip when the
+ * list is drawn, so a full screen redraw only needs the memory of two strips.
+ *
+ * Commands are drawn in the order they were recorded, over the list's `background`.
+ */
+typedef struct render_list_t
+{
+    render_command_t    commands[RENDER_MAX_COMMANDS];
+    uint16_t            count;
+
+    color_t             background;
+} render_list_t;
+
+/**
+ * Initialize the renderer's strip buffers, call this once before drawing any list
+ */
+external void render_init(void);
+
+/**
+ * Remove all commands of a display list
+ *
+ * PARAMETERS
+ * - list: the display list to clear
+ * - background: the color of the pixels no command draws to
+ */
+external void render_list_clear(render_list_t *list, color_t background);
+
+/**
+ * Record a rectangle fill into a display list
+ *
+ * PARAMETERS
+ * - list: the display list to record into
+ * - x, y, width, height: the rectangle to fill
+ * - color: the color to fill
+ *
+ * RETURN VALUE
+ * - ENOTINRANGE: if the display list is full
+ */
+external error_t render_fill_rect(
+    render_list_t *list,
+    int16_t x,
+    int16_t y,
+    uint16_t width,
+    uint16_t height,
+    color_t color
+);
+
+/**
+ * Record a 1-bit-per-pixel bitmap into a display list
+ *
+ * PARAMETERS
+ * - list: the display list to record into
+ * - x, y, width, height: where to draw the bitmap
+ * - bits: the bitmap, the MSB of each byte is the leftmost pixel
+ * - stride: how many bytes each row of the bitmap has
+ * - color: the color of the set bits
+ *
+ * RETURN VALUE
+ * - ENOTINRANGE: if the display list is full
+ */
+external error_t render_bitmap(
+    render_list_t *list,
+    int16_t x,
+    int16_t y,
+    uint16_t width,
+    uint16_t height,
+    const byte *bits,
+    uint16_t stride,
+    color_t color
+);
+
+/**
+ * Record an image into a display list
+ *
+ * PARAMETERS
+ * - list: the display list to record into
+ * - x, y, width, height: where to draw the image
+ * - pixels: `width * height` colors
+ *
+ * RETURN VALUE
+ * - ENOTINRANGE: if the display list is full
+ */
+external error_t render_image(
+    render_list_t *list,
+    int16_t x,
+    int16_t y,
+    uint16_t width,
+    uint16_t height,
+    const color_t *pixels
+);
+
+/**
+ * Rasterize a region of the display from a display list, and queue it to the display.
+ *
+ * PARAMETERS
+ * - list: the display list to draw
+ * - x, y, width, height: the region of the display to draw
+ *
+ * NOTES
+ * - Each strip is queued as soon it's rasterized, and the next strip is rasterized while it's
+ *   sent. This returns when the last strip is queued, use `render_wait` to wait it to be sent.
+ * - This talks to the display driver, so only call it from the display core, use
+ *   `display_draw_list` from core 0.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ * - ENOTINRANGE: if the region doesn't fit in the display
+ */
+external error_t render_list_draw(
+    const render_list_t *list,
+    uint16_t x,
+    uint16_t y,
+    uint16_t width,
+    uint16_t height
+);
+
+/**
+ * Wait all the strips queued by `render_list_draw` to be sent to the display
+ */
+external void render_wait(void);
+
+/**
+ * Pace `render_list_draw` by the panel's scan, the first strip of a region is only sent
+ * when the scan reaches the region, so it's never torn (see `st7789v_queue_vsync`).
+ *
+ * PARAMETERS
+ * - enable: if the draws should wait for the scan, needs vsync enabled in the driver
+ *
+ * NOTES
+ * - Call it from core 1, like the draws. The TE IRQ is always handled by the core that
+ *   initialized the driver, whichever core starts a wait for it.
+ */
+external void render_set_vsync(bool enable);
+
+#endif /** HAL_RENDER_H */
@@ -0,0 +1,601 @@
+#include "store.h"
+#include <hal/display.h>
+#include <pico.h>
+#include <pico/time.h>
+#include <string.h>
+#include <util/log.h>
+
+#if PICO_ON_DEVICE
+#   include <hardware/flash.h>
+#   include <pico/flash.h>
+#else
+#   define FLASH_PAGE_SIZE      (1u << 8)
+#   define FLASH_SECTOR_SIZE    (1u << 12)
+#endif
+
+#ifndef STORE_LOG_LEVEL
+#   define STORE_LOG_LEVEL LOG_LEVEL
+#endif
+
+#define STORE_LOG(...) LOG_AT(STORE_LOG_LEVEL, LOG_LEVEL_INFO, "store", __VA_ARGS__)
+
+#define STORE_REGION_SIZE       (STORE_SECTORS * FLASH_SECTOR_SIZE)
+
+/**
+ * The first bytes of a sector that was opened, "DSX1"
+ */
+#define STORE_MAGIC             0x31585344
+
+/**
+ * What a record is, an erased flash reads as `STORE_KIND_FREE`
+ */
+#define STORE_KIND_DATA         0x01
+#define STORE_KIND_REMOVED      0x02
+#define STORE_KIND_FREE         0xFF
+
+/**
+ * The start of each sector in use, the sector with the highest sequence has the newest
+ * records
+ */
+typedef struct store_sector_t
+{
+    uint32_t    magic;
+    uint32_t    sequence;
+} store_sector_t;
+
+/**
+ * A record never crosses a page, and the rest of a page after its last record is left
+ * erased. Records are aligned to 4 bytes, so the XIP window can be read by words.
+ */
+typedef struct store_record_t
+{
+    uint16_t    key;
+    uint8_t     kind;
+    uint8_t     size;
+
+    /** A hash of the rest of the record, a page cut by a power loss is skipped */
+    uint32_t    check;
+
+    byte        data[];
+} store_record_t;
+
+typedef struct store_index_entry_t
+{
+    uint16_t    key;
+
+    /** Where the newest record of the key is, from the start of the region */
+    uint32_t    offset;
+} store_index_entry_t;
+
+internal store_index_entry_t index_entries[STORE_MAX_KEYS];
+internal uint8_t index_count = 0;
+
+/**
+ * The page the next records are written to, it's programmed at `page_offset` of the region
+ */
+internal byte __attribute__((aligned(4))) page[FLASH_PAGE_SIZE];
+internal uint16_t page_used = 0;
+internal uint32_t page_offset = 0;
+
+/**
+ * If the page has records that aren't in the flash yet, and when the last one was added
+ */
+internal bool pending = false;
+internal absolute_time_t last_write;
+
+internal uint32_t sequence = 0;
+
+/**
+ * The sectors `store_init` found to compact or erase, it only reads the flash so it can run
+ * while core 1 starts, they are prepared before the first write
+ */
+internal uint8_t unprepared = 0;
+
+/******************** FLASH *************************/
+
+#if PICO_ON_DEVICE
+#define STORE_FLASH_OFFSET      (PICO_FLASH_SIZE_BYTES - STORE_REGION_SIZE)
+
+internal const byte *const region = (const byte *) (XIP_BASE + STORE_FLASH_OFFSET);
+
+typedef struct store_flash_operation_t
+{
+    uint32_t    offset;
+
+    /** The page to program, NULL to erase the sector */
+    const byte  *data;
+} store_flash_operation_t;
+
+internal void store_flash_run(void *param) {
+    const store_flash_operation_t *operation = param;
+
+    if (operation->data == NULL) {
+        flash_range_erase(STORE_FLASH_OFFSET + operation->offset, FLASH_SECTOR_SIZE);
+    } else {
+        flash_range_program(STORE_FLASH_OFFSET + operation->offset, operation->data, FLASH_PAGE_SIZE);
+    }
+}
+
+internal void store_flash(uint32_t offset, const byte *data) {
+    // The DMA can be reading glyphs through the XIP window, which is off while the flash
+    // is written
+    display_sync();
+
+    store_flash_operation_t operation = { offset, data };
+
+    // Core 1 waits in RAM meanwhile, and the interrupts of core 0 are off
+    int result = flash_safe_execute(store_flash_run, &operation, /* enter_exit_timeout_ms: */ 100);
+
+    if (result != PICO_OK) {
+        STORE_LOG("flash operation at %lu failed: %d", (unsigned long) offset, result);
+    }
+}
+#else
+/**
+ * The host builds have no flash, the store lives until the program exits
+ */
+internal byte __attribute__((aligned(4))) region[STORE_REGION_SIZE];
+
+internal void store_flash(uint32_t offset, const byte *data) {
+    if (data == NULL) {
+        memset(&region[offset], 0xFF, FLASH_SECTOR_SIZE);
+    } else {
+        memcpy(&region[offset], data, FLASH_PAGE_SIZE);
+    }
+}
+#endif
+
+internal bool store_sector_is_erased(uint8_t sector) {
+    const uint32_t *words = (const uint32_t *) &region[sector * FLASH_SECTOR_SIZE];
+
+    for (size_t index = 0; index < FLASH_SECTOR_SIZE / sizeof(uint32_t); index++) {
+        if (words[index] != 0xFFFFFFFF) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+internal const store_sector_t *store_sector(uint8_t sector) {
+    const store_sector_t *header = (const store_sector_t *) &region[sector * FLASH_SECTOR_SIZE];
+
+    return header->magic == STORE_MAGIC ? header : NULL;
+}
+
+/******************** RECORDS *************************/
+
+internal force_inline uint16_t store_record_size(uint8_t size) {
+    return (sizeof(store_record_t) + size + 3) & ~3;
+}
+
+internal uint32_t store_record_check(uint16_t key, uint8_t kind, uint8_t size, const byte *data) {
+    // FNV-1a
+    uint32_t hash = 0x811C9DC5;
+    byte fields[4] = { key & 0xFF, key >> 8, kind, size };
+
+    for (size_t index = 0; index < sizeof(fields); index++) {
+        hash = (hash ^ fields[index]) * 0x01000193;
+    }
+
+    for (size_t index = 0; index < size; index++) {
+        hash = (hash ^ data[index]) * 0x01000193;
+    }
+
+    return hash;
+}
+
+/**
+ * A record is in the pending page until it's programmed, so the index can point to either
+ */
+internal const store_record_t *store_record_at(uint32_t offset) {
+    if (offset - page_offset < FLASH_PAGE_SIZE) {
+        return (const store_record_t *) &page[offset - page_offset];
+    }
+
+    return (const store_record_t *) &region[offset];
+}
+
+internal store_index_entry_t *store_index_find(uint16_t key) {
+    for (uint8_t index = 0; index < index_count; index++) {
+        if (index_entries[index].key == key) {
+            return &index_entries[index];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Apply a record to the index
+ *
+ * RETURN VALUE
+ * - false if it's a new key and the index is full
+ */
+internal bool store_index_update(uint16_t key, uint8_t kind, uint32_t offset) {
+    store_index_entry_t *entry = store_index_find(key);
+
+    if (kind == STORE_KIND_REMOVED) {
+        if (entry != NULL) {
+            *entry = index_entries[--index_count];
+        }
+
+        return true;
+    }
+
+    if (entry == NULL) {
+        if (index_count == STORE_MAX_KEYS) {
+            return false;
+        }
+
+        entry = &index_entries[index_count++];
+        entry->key = key;
+    }
+
+    entry->offset = offset;
+
+    return true;
+}
+
+/******************** LOG *************************/
+
+internal void store_program_page(void) {
+    store_flash(page_offset, page);
+
+    memset(page, 0xFF, sizeof(page));
+
+    page_used = 0;
+    page_offset = (page_offset + FLASH_PAGE_SIZE) % STORE_REGION_SIZE;
+    pending = false;
+}
+
+/**
+ * Add a record to the pending page, programming the page first if it doesn't fit in it. The
+ * callers make sure the log isn't at the start of a sector that needs to be opened.
+ */
+internal void store_write_record(uint16_t key, uint8_t kind, const void *data, uint8_t size) {
+    uint16_t record_size = store_record_size(size);
+
+    if (page_used + record_size > FLASH_PAGE_SIZE) {
+        store_program_page();
+    }
+
+    store_record_t *record = (store_record_t *) &page[page_used];
+
+    record->key = key;
+    record->kind = kind;
+    record->size = size;
+    record->check = store_record_check(key, kind, size, data);
+
+    if (size > 0) {
+        memcpy(record->data, data, size);
+    }
+
+    store_index_update(key, kind, page_offset + page_used);
+
+    page_used += record_size;
+    pending = true;
+    last_write = get_absolute_time();
+}
+
+/**
+ * The live record of a sector with the lowest offset after `after`
+ *
+ * RETURN VALUE
+ * - its index entry, or -1 if there's none left
+ */
+internal int store_next_live(uint32_t start, uint32_t after) {
+    int found = -1;
+
+    for (uint8_t index = 0; index < index_count; index++) {
+        uint32_t offset = index_entries[index].offset;
+
+        if (offset - start < FLASH_SECTOR_SIZE && offset > after && (found < 0 || offset < index_entries[found].offset)) {
+            found = index;
+        }
+    }
+
+    return found;
+}
+
+/**
+ * Move the records of a sector that weren't replaced to the log, and erase it. They're moved
+ * in the order they were written, so they pack in no more pages than they took.
+ *
+ * RETURN VALUE
+ * - ESTOREFULL: if they don't fit in the rest of the sector the log is in, nothing is moved
+ *   and the sector is left as it is
+ */
+internal error_t store_compact(uint8_t sector) {
+    if (store_sector(sector) != NULL) {
+        uint32_t start = sector * FLASH_SECTOR_SIZE;
+
+        // The log can't run into the next sector, it's only opened by `store_append`: if the
+        // log is at the start of a sector, the one before it is full
+        uint32_t end = page_offset + page_used;
+        uint32_t limit = page_used == 0 && page_offset % FLASH_SECTOR_SIZE == 0
+            ? page_offset
+            : (page_offset / FLASH_SECTOR_SIZE + 1) * FLASH_SECTOR_SIZE;
+        uint8_t moved = 0;
+        int index;
+
+        for (uint32_t after = start; (index = store_next_live(start, after)) >= 0; after = index_entries[index].offset) {
+            uint16_t record_size = store_record_size(((const store_record_t *) &region[index_entries[index].offset])->size);
+
+            if (end % FLASH_PAGE_SIZE + record_size > FLASH_PAGE_SIZE) {
+                end += FLASH_PAGE_SIZE - end % FLASH_PAGE_SIZE;
+            }
+
+            end += record_size;
+
+            if (end > limit) {
+                STORE_LOG("sector %u can't be compacted, its records don't fit", (unsigned) sector);
+
+                return -ESTOREFULL;
+            }
+        }
+
+        // Moving a record points its index entry out of the sector, so the next one is
+        // always the lowest offset left
+        while ((index = store_next_live(start, start)) >= 0) {
+            const store_record_t *record = (const store_record_t *) &region[index_entries[index].offset];
+
+            store_write_record(record->key, record->kind, record->data, record->size);
+            moved++;
+        }
+
+        // The only copy of the moved records can't be in RAM when the sector is gone
+        if (pending) {
+            store_program_page();
+        }
+
+        STORE_LOG("compacted sector %u, %u records moved", (unsigned) sector, (unsigned) moved);
+    }
+
+    if (!store_sector_is_erased(sector)) {
+        store_flash(sector * FLASH_SECTOR_SIZE, NULL);
+    }
+
+    return 0x00;
+}
+
+/**
+ * Start writing to a sector, it needs to be erased: the oldest sector is the next one, and
+ * it's compacted now to be the next erased one
+ *
+ * RETURN VALUE
+ * - ESTOREFLASH: if the sector isn't erased
+ * - the errors of `store_compact`, the sector isn't opened
+ */
+internal error_t store_open_sector(uint8_t sector) {
+    if (!store_sector_is_erased(sector)) {
+        STORE_LOG("sector %u should be erased, it isn't", (unsigned) sector);
+
+        return -ESTOREFLASH;
+    }
+
+    store_sector_t header = { STORE_MAGIC, sequence + 1 };
+
+    memcpy(page, &header, sizeof(header));
+    page_used = sizeof(header);
+
+    error_t error = store_compact((sector + 1) % STORE_SECTORS);
+
+    if (error != 0x00) {
+        // Nothing was moved, so nothing was programmed
+        memset(page, 0xFF, sizeof(header));
+        page_used = 0;
+
+        return error;
+    }
+
+    sequence++;
+
+    return 0x00;
+}
+
+/**
+ * Compact or erase the sectors `store_init` found, a sector that can't be stays unprepared
+ * (and the store read only)
+ */
+internal error_t store_prepare(void) {
+    for (uint8_t sector = 0; sector < STORE_SECTORS; sector++) {
+        if (unprepared & (1 << sector)) {
+            error_t error = store_compact(sector);
+
+            if (error != 0x00) {
+                return error;
+            }
+
+            unprepared &= ~(1 << sector);
+        }
+    }
+
+    return 0x00;
+}
+
+internal error_t store_append(uint16_t key, uint8_t kind, const void *data, uint8_t size) {
+    error_t error = unprepared != 0 ? store_prepare() : 0x00;
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    uint16_t record_size = store_record_size(size);
+
+    // Opening a sector compacts the next one into it, which can fill it: then the next one
+    // is opened, it was just erased
+    for (uint8_t opened = 0;; opened++) {
+        if (page_used + record_size > FLASH_PAGE_SIZE) {
+            store_program_page();
+        }
+
+        if (page_used != 0 || page_offset % FLASH_SECTOR_SIZE != 0) {
+            break;
+        }
+
+        if (opened == STORE_SECTORS) {
+            return -ESTOREFULL;
+        }
+
+        if ((error = store_open_sector(page_offset / FLASH_SECTOR_SIZE)) != 0x00) {
+            return error;
+        }
+    }
+
+    store_write_record(key, kind, data, size);
+
+    return 0x00;
+}
+
+/******************** RESTORE *************************/
+
+/**
+ * Apply the records of a sector to the index, oldest first
+ *
+ * RETURN VALUE
+ * - the offset of its first free page, or the end of the sector if it's full
+ */
+internal uint32_t store_scan_sector(uint8_t sector) {
+    uint32_t start = sector * FLASH_SECTOR_SIZE;
+
+    for (uint32_t page_start = start; page_start < start + FLASH_SECTOR_SIZE; page_start += FLASH_PAGE_SIZE) {
+        uint32_t offset = page_start == start ? page_start + sizeof(store_sector_t) : page_start;
+
+        if (((const store_record_t *) &region[offset])->kind == STORE_KIND_FREE) {
+            return page_start;
+        }
+
+        while (offset + sizeof(store_record_t) <= page_start + FLASH_PAGE_SIZE) {
+            const store_record_t *record = (const store_record_t *) &region[offset];
+            uint16_t record_size = store_record_size(record->size);
+
+            if (record->kind == STORE_KIND_FREE || offset + record_size > page_start + FLASH_PAGE_SIZE) {
+                break;
+            }
+
+            if (record->check != store_record_check(record->key, record->kind, record->size, record->data)) {
+                STORE_LOG("skipping a damaged page at %lu", (unsigned long) page_start);
+                break;
+            }
+
+            if (!store_index_update(record->key, record->kind, offset)) {
+                STORE_LOG("the index is full, key %u is lost", (unsigned) record->key);
+            }
+
+            offset += record_size;
+        }
+    }
+
+    return start + FLASH_SECTOR_SIZE;
+}
+
+void store_init(void) {
+    index_count = 0;
+    pending = false;
+    unprepared = 0;
+
+    memset(page, 0xFF, sizeof(page));
+
+    // The sectors in use, oldest first
+    uint8_t order[STORE_SECTORS];
+    uint8_t count = 0;
+
+    for (uint8_t sector = 0; sector < STORE_SECTORS; sector++) {
+        const store_sector_t *header = store_sector(sector);
+
+        if (header == NULL) {
+            continue;
+        }
+
+        uint8_t position = count++;
+
+        while (position > 0 && store_sector(order[position - 1])->sequence > header->sequence) {
+            order[position] = order[position - 1];
+            position--;
+        }
+
+        order[position] = sector;
+    }
+
+    if (count == 0) {
+        // A new store, the sector after the first one needs to be erased too
+        sequence = 0;
+        page_offset = 0;
+        page_used = 0;
+
+        unprepared = (1 << 0) | (1 << 1);
+
+        STORE_LOG("no records, starting a new store");
+
+        return;
+    }
+
+    uint32_t end = 0;
+
+    for (uint8_t position = 0; position < count; position++) {
+        end = store_scan_sector(order[position]);
+    }
+
+    uint8_t newest = order[count - 1];
+
+    sequence = store_sector(newest)->sequence;
+    page_used = 0;
+    page_offset = end % STORE_REGION_SIZE;
+
+    // The sector after the newest one was being compacted if it's still in use, the records
+    // that were already moved are found in the newest one, so only the rest is moved
+    unprepared = 1 << ((newest + 1) % STORE_SECTORS);
+
+    STORE_LOG("restored %u keys from %u sectors", (unsigned) index_count, (unsigned) count);
+}
+
+/******************** API *************************/
+
+error_t store_put(uint16_t key, const void *data, uint8_t size) {
+    if (size > STORE_MAX_DATA) {
+        return -ESTORETOOBIG;
+    }
+
+    if (store_index_find(key) == NULL && index_count == STORE_MAX_KEYS) {
+        return -ESTOREFULL;
+    }
+
+    return store_append(key, STORE_KIND_DATA, data, size);
+}
+
+error_t store_remove(uint16_t key) {
+    if (store_index_find(key) == NULL) {
+        return 0x00;
+    }
+
+    return store_append(key, STORE_KIND_REMOVED, NULL, 0);
+}
+
+const void *store_get(uint16_t key, uint8_t *size) {
+    store_index_entry_t *entry = store_index_find(key);
+
+    if (entry == NULL) {
+        return NULL;
+    }
+
+    const store_record_t *record = store_record_at(entry->offset);
+
+    if (size != NULL) {
+        *size = record->size;
+    }
+
+    return record->data;
+}
+
+void store_flush(void) {
+    if (pending) {
+        store_program_page();
+    }
+}
+
+void store_poll(void) {
+    if (pending && absolute_time_diff_us(last_write, get_absolute_time()) >= STORE_FLUSH_DELAY_US) {
+        store_program_page();
+    }
+}
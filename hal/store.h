@@ -0,0 +1,121 @@
+#ifndef HAL_STORE_H
+#define HAL_STORE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+#include <errno.h>
+
+/**
+ * A key-value store in the last sectors of the flash, kept across power cycles (the history
+ * of the calculator is saved in it).
+ *
+ * Erasing a sector takes tens of milliseconds, with the flash (and so the code running from
+ * it) stopped on both cores, so nothing is ever rewritten in place: the store is a log of
+ * records, and writing a key appends a new record that replaces the older ones. The records
+ * are gathered in a page in RAM and programmed one page at a time, when the page is full or
+ * a moment after the last write (`store_poll`), so a burst of writes is a single program.
+ *
+ * The sectors are used as a ring, so they wear evenly, and one of them is always erased:
+ * when the log reaches it, the oldest sector (the next one) is compacted, its records that
+ * weren't replaced are appended again, and it's erased to be the next free one.
+ *
+ * A RAM index has where the newest record of each key is, found at boot by reading the
+ * records through the XIP window (they are never copied), and `store_get` returns pointers
+ * to them there.
+ *
+ * Only use it from core 0: core 1 is paused while the flash is written.
+ */
+
+/**
+ * How many sectors of the flash are used, at the end of it (the firmware needs to stay
+ * under them)
+ */
+#define STORE_SECTORS           8
+
+/**
+ * How many keys the index can hold
+ */
+#define STORE_MAX_KEYS          64
+
+/**
+ * The most data a record has, so it fits in a page with the headers
+ */
+#define STORE_MAX_DATA          240
+
+/**
+ * How long after the last write the pending records are programmed
+ */
+#define STORE_FLUSH_DELAY_US    (2 * 1000 * 1000)
+
+typedef enum store_error_t
+{
+    /** The data doesn't fit in a record */
+    ESTORETOOBIG        = 0x20,
+
+    /** The index has no room for a new key, or the sectors have no room for the records */
+    ESTOREFULL          = 0x21,
+
+    /** A sector that should be erased isn't (its erase failed), it's never written */
+    ESTOREFLASH         = 0x22
+} store_error_t;
+
+/**
+ * Read the records of the flash into the index, a compaction that was cut by a power loss
+ * is finished before the next write
+ *
+ * NOTES
+ * - This only reads the flash, so it can run before core 1 is ready for the flash to be
+ *   written.
+ */
+external void store_init(void);
+
+/**
+ * Write a key, the data is copied in the pending page (it's only in the flash after the
+ * next program)
+ *
+ * RETURN VALUE
+ * - ESTORETOOBIG: if `size` is more than `STORE_MAX_DATA`
+ * - ESTOREFULL: if it's a new key and the index is full, or the records of the oldest
+ *   sector don't fit in the next one when it's compacted
+ * - ESTOREFLASH: if the next sector to write isn't erased
+ */
+external error_t store_put(uint16_t key, const void *data, uint8_t size);
+
+/**
+ * Forget a key, like `store_put` this is a record
+ *
+ * RETURN VALUE
+ * - the errors of `store_put`, but ESTORETOOBIG
+ */
+external error_t store_remove(uint16_t key);
+
+/**
+ * Find the newest data of a key
+ *
+ * PARAMETERS
+ * - size: where the size of the data is written, can be NULL
+ *
+ * NOTES
+ * - The pointer is only valid until the next write (the record can be moved, or still be
+ *   in the pending page), it's in the XIP window otherwise.
+ *
+ * RETURN VALUE
+ * - NULL if the key doesn't exist
+ */
+external const void *store_get(uint16_t key, uint8_t *size);
+
+/**
+ * Program the pending page now, if it has records
+ */
+external void store_flush(void);
+
+/**
+ * Program the pending page if it was last written more than `STORE_FLUSH_DELAY_US` ago,
+ * call it while waiting for input
+ */
+external void store_poll(void);
+
+#endif /** HAL_STORE_H */
@@ -0,0 +1,173 @@
+#include "text.h"
+#include <drivers/st7789v.h>
+#include <pico/sem.h>
+#include <string.h>
+#include <util/types.h>
+
+#define TEXT_RUN_COUNT 2
+
+/**
+ * The ping-pong run buffers, one is being sent by the DMA while the other is built
+ */
+internal color_t runs[TEXT_RUN_COUNT][ST7789V_DISPLAY_WIDTH * FONT_HEIGHT];
+
+/**
+ * Released by the DMA IRQ handler when the run is sent, and acquired before building it
+ */
+internal semaphore_t run_free[TEXT_RUN_COUNT];
+
+internal int current = 0;
+
+void text_init(void) {
+    for (int index = 0; index < TEXT_RUN_COUNT; index++) {
+        sem_init(&run_free[index], 1, 1);
+    }
+}
+
+internal force_inline
+color_t text_blend(color_t foreground, color_t background, uint32_t alpha) {
+    int32_t r = (background >> 11) & 0x1F;
+    int32_t g = (background >> 5) & 0x3F;
+    int32_t b = background & 0x1F;
+
+    r += ((((foreground >> 11) & 0x1F) - r) * (int32_t) alpha) / 15;
+    g += ((((foreground >> 5) & 0x3F) - g) * (int32_t) alpha) / 15;
+    b += (((foreground & 0x1F) - b) * (int32_t) alpha) / 15;
+
+    return (color_t) ((r << 11) | (g << 5) | b);
+}
+
+void text_palette_init(text_palette_t *palette, color_t foreground, color_t background) {
+    color_t levels[16];
+
+    for (uint32_t alpha = 0; alpha < 16; alpha++) {
+        levels[alpha] = text_blend(foreground, background, alpha);
+    }
+
+    for (uint32_t value = 0; value < 256; value++) {
+        palette->pairs[value] = levels[value >> 4] | ((uint32_t) levels[value & 0x0F] << 16);
+    }
+}
+
+/**
+ * Wait for a run buffer and set the window for a run, returns how many characters fit or
+ * a negative error
+ */
+internal int32_t text_begin_run(uint16_t x, uint16_t y, uint16_t cell_width, uint16_t cell_height, size_t length) {
+    if (x >= ST7789V_DISPLAY_WIDTH || y + cell_height > ST7789V_DISPLAY_HEIGHT) {
+        return -ENOTINRANGE;
+    }
+
+    size_t count = MIN(length, (size_t) (ST7789V_DISPLAY_WIDTH - x) / cell_width);
+
+    if (count == 0) {
+        return -ENOTINRANGE;
+    }
+
+    error_t error = st7789v_display_set_column_address_window(x, x + count * cell_width - 1);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    st7789v_display_set_row_address_window(y, y + cell_height - 1);
+
+    // Wait the DMA to finish sending this buffer the last time it was used
+    sem_acquire_blocking(&run_free[current]);
+
+    return count;
+}
+
+/**
+ * Queue the current run buffer and switch to the other one
+ */
+internal error_t text_end_run(size_t pixel_count) {
+    error_t error = st7789v_display_memory_write_pixels_async(
+        /*            pixels: */ runs[current],
+        /*             count: */ pixel_count,
+        /* completion_signal: */ &run_free[current],
+        /*  continue_writing: */ false
+    );
+
+    if (error != 0x00) {
+        // Nothing will release it if the run wasn't queued
+        sem_release(&run_free[current]);
+    }
+
+    current = (current + 1) % TEXT_RUN_COUNT;
+
+    return error;
+}
+
+error_t text_draw(uint16_t x, uint16_t y, const char *text, size_t length) {
+    int32_t count = text_begin_run(x, y, FONT_WIDTH, FONT_HEIGHT, length);
+
+    if (count < 0) {
+        return count;
+    }
+
+    uint16_t width = count * FONT_WIDTH;
+    color_t *run = runs[current];
+
+    // The display fills the window row by row, so each row of the run has one row of every glyph
+    for (int32_t index = 0; index < count; index++) {
+        const color_t *glyph = font_glyph(text[index]);
+        color_t *cell = &run[index * FONT_WIDTH];
+
+        for (uint16_t row = 0; row < FONT_HEIGHT; row++) {
+            memcpy(&cell[row * width], &glyph[row * FONT_WIDTH], FONT_WIDTH * sizeof(color_t));
+        }
+    }
+
+    return text_end_run((size_t) width * FONT_HEIGHT);
+}
+
+error_t text_draw_aa(
+    const font_t *font,
+    const text_palette_t *palette,
+    uint16_t x,
+    uint16_t y,
+    const char *text,
+    size_t length
+) {
+    int32_t count = text_begin_run(x, y, font->width, font->height, length);
+
+    if (count < 0) {
+        return count;
+    }
+
+    uint16_t width = count * font->width;
+    uint8_t pairs = font->width / 2;
+    color_t *run = runs[current];
+
+    for (int32_t index = 0; index < count; index++) {
+        const byte *alpha = font_alpha_glyph(font, text[index]);
+        color_t *cell = &run[index * font->width];
+
+        for (uint16_t row = 0; row < font->height; row++, alpha += font->stride) {
+            color_t *line = &cell[row * width];
+
+            // The cells can start at odd pixels, so the pairs are stored as two halves
+            for (uint8_t pair = 0; pair < pairs; pair++) {
+                uint32_t colors = palette->pairs[alpha[pair]];
+
+                line[pair * 2] = (color_t) colors;
+                line[pair * 2 + 1] = (color_t) (colors >> 16);
+            }
+
+            if (font->width & 1) {
+                // Only the left pixel of the last byte is in the cell
+                line[font->width - 1] = (color_t) palette->pairs[alpha[pairs]];
+            }
+        }
+    }
+
+    return text_end_run((size_t) width * font->height);
+}
+
+void text_wait(void) {
+    for (int index = 0; index < TEXT_RUN_COUNT; index++) {
+        sem_acquire_blocking(&run_free[index]);
+        sem_release(&run_free[index]);
+    }
+}
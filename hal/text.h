@@ -0,0 +1,101 @@
+#ifndef HAL_TEXT_H
+#define HAL_TEXT_H
+
+#include <drivers/st7789v.h>
+#include <hal/font.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+#include <errno.h>
+
+/**
+ * The most characters drawn in a single run, a full line of the display
+ */
+#define TEXT_MAX_RUN    (ST7789V_DISPLAY_WIDTH / FONT_WIDTH)
+
+/**
+ * The colors an anti-aliased font is drawn with, every coverage level of a pair of pixels is
+ * blended once when the palette is made, so drawing is only a table lookup per two pixels
+ * (the Cortex-M0+ has no FPU and no SIMD, and this way there's no multiply per pixel).
+ *
+ * A palette is 1 KB, make one for each foreground/background pair and keep it around.
+ */
+typedef struct text_palette_t
+{
+    /**
+     * The two pixels of each coverage byte, the high nibble (leftmost pixel) in the low half
+     */
+    uint32_t    pairs[256];
+} text_palette_t;
+
+/**
+ * Initialize the text run buffers, call this once before drawing any text
+ */
+external void text_init(void);
+
+/**
+ * Draw a run of text with the font atlas colors
+ *
+ * PARAMETERS
+ * - x, y: the top left corner of the first character
+ * - text: the characters to draw
+ * - length: how many characters to draw
+ *
+ * NOTES
+ * - The whole run is a single window and memory write: the glyph rows are copied from the
+ *   atlas into a run buffer, line by line, and the buffer is sent with one DMA transfer.
+ * - The characters that don't fit in the display are not drawn.
+ * - This returns when the run is queued, the next run is built while it's sent. Use
+ *   `text_wait` to wait it to be sent.
+ * - This talks to the display driver, so only call it from the display core.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ * - ENOTINRANGE: if not even one character fits in the display
+ */
+external error_t text_draw(uint16_t x, uint16_t y, const char *text, size_t length);
+
+/**
+ * Blend the coverage levels of a foreground/background pair into a palette
+ *
+ * PARAMETERS
+ * - palette: the palette to fill
+ * - foreground: the color of a fully covered pixel
+ * - background: the color of an empty pixel
+ */
+external void text_palette_init(text_palette_t *palette, color_t foreground, color_t background);
+
+/**
+ * Draw a run of text with an anti-aliased font
+ *
+ * PARAMETERS
+ * - font: the font to draw with, it can't be taller than `FONT_HEIGHT`
+ * - palette: the colors to draw with
+ * - x, y: the top left corner of the first character
+ * - text: the characters to draw
+ * - length: how many characters to draw
+ *
+ * NOTES
+ * - Same as `text_draw`, but each pair of pixels is looked up in the palette instead of
+ *   copied from the atlas.
+ *
+ * RETURN VALUE
+ * - ENODISPLAYCONNECTED: if the display is not plugged in, or unavailable
+ * - ENOTINRANGE: if not even one character fits in the display
+ */
+external error_t text_draw_aa(
+    const font_t *font,
+    const text_palette_t *palette,
+    uint16_t x,
+    uint16_t y,
+    const char *text,
+    size_t length
+);
+
+/**
+ * Wait all the runs queued by `text_draw` and `text_draw_aa` to be sent to the display
+ */
+external void text_wait(void);
+
+#endif /** HAL_TEXT_H */
@@ -3,22 +3,33 @@
 #include <stdbool.h>
 
 #include <app/entry.h>
-#include <drivers/st7789v.h>
+#include <bench/bench.h>
+#include <hal/display.h>
+#include <hal/keypad.h>
+#include <hal/power.h>
+#include <hal/render.h>
+#include <hal/store.h>
+#include <hal/text.h>
 #include <stdio.h>
 #include <util/time.h>
 #include <util/log.h>
 
-#include <pico/bootrom.h>
-
 #include <pico/time.h>
 #include <pico/stdio.h>
-#include <pico/stdio_usb.h>
+
+#if PICO_ON_DEVICE
+#   include <pico/bootrom.h>
+#   include <pico/stdio_usb.h>
+#endif
 
 int main(void)
 {
-    assert(stdio_usb_init());
+    // The display core starts first: the display's reset and sleep out delays (more than
+    // 100ms) run on core 1 while the rest starts up, the USB wait included
+    display_start();
 
-    bool restart = false;
+#if PICO_ON_DEVICE
+    assert(stdio_usb_init());
 
     char c = 0x00;
 
@@ -31,21 +42,48 @@ int main(void)
     // Clear terminal on the OS side
     printf("\033[H\033[J\033[2J");
     fflush(stdout);
+#else
+    // The host builds print to the terminal they were started from
+    stdio_init_all();
+#endif
 
     LOG("init", "starting up...");
-    LOG("init", "loading drivers...");
+    LOG("init", "loading HALs...");
+
+    render_init();
+    text_init();
+    keypad_init();
+
+    // Only reads the flash, core 1 isn't ready for it to be written yet
+    store_init();
+
+#if !DESCARTEX_BENCH
+    app_init();
+#endif
 
-    if (0 != st7789v_init()) {
-        LOG("init", "warning: no display is attached");
+    LOG("init", "waiting for the display core...");
+
+    // The display driver lives on core 1, with the rest of the display pipeline
+    bool has_display = display_wait_started() == 0;
+
+    if (!has_display) {
+        LOG_WARNING("init", "no display is attached");
     }
 
-    LOG("init", "loading HALs...");
+    power_init(has_display);
 
+#if DESCARTEX_BENCH
+    // The benchmark firmware runs its measurements once, instead of the application
+    LOG("init", "starting the benchmarks...");
+    log_flush();
+
+    bench_main(has_display);
+#else
     LOG("init", "starting up application...");
 
     for (;;)
     {
-        restart = app_main();
+        bool restart = app_main();
 
         if (!restart) {
             LOG("init", "exiting out of application...");
@@ -54,22 +92,33 @@ int main(void)
         }
 
         LOG("init", "application asked to restart, restarting...");
+
+        app_init();
     }
+#endif
 
-    LOG("init", "deinitializing drivers");
+    // The flash can only be written while core 1 runs
+    store_flush();
 
-    st7789v_deinit();
+    LOG("init", "stopping the display core");
 
-#ifndef DO_NOT_REBOOT_IN_BOOTSEL
+    display_stop();
+
+    // The logs are only printed when the application waits for input, print the last ones
+    log_flush();
+
+#if !PICO_ON_DEVICE
+    return 0;
+#endif
+
+#if PICO_ON_DEVICE && !defined(DO_NOT_REBOOT_IN_BOOTSEL)
     LOG("init", "rebooting into BOOTSEL mode");
 
     reset_usb_boot(0, 0);
 #endif
 
     LOG("init", "halting CPU");
+    log_flush();
 
-    for (;;) {
-        sleep_ms(1000 * 1000);
-        tight_loop_contents();
-    }
+    power_halt();
 }
@@ -0,0 +1,125 @@
+#include "benchmark.h"
+#include <pico.h>
+#if PICO_ON_DEVICE
+#   include <hardware/clocks.h>
+#endif
+#include <hardware/timer.h>
+#include <math.h>
+#include <math/kernel.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * How many points of each function's range are measured
+ */
+#define BENCHMARK_SAMPLES 2000
+
+typedef struct benchmark_function_t
+{
+    const char  *name;
+
+    double      (*kernel)(double value, kernel_precision_t precision);
+
+    /** The range the function is measured on */
+    double      from;
+    double      to;
+} benchmark_function_t;
+
+internal const benchmark_function_t functions[] = {
+    { "sin",  kernel_sin,  -10,   10   },
+    { "cos",  kernel_cos,  -10,   10   },
+    { "tan",  kernel_tan,  -1.5,  1.5  },
+    { "atan", kernel_atan, -100,  100  },
+    { "exp",  kernel_exp,  -20,   20   },
+    { "ln",   kernel_ln,   1e-3,  1e3  }
+};
+
+internal const char *const precision_names[KERNEL_PRECISION_COUNT] = {
+    [KERNEL_PRECISION_LOW]      = "low",
+    [KERNEL_PRECISION_MEDIUM]   = "medium",
+    [KERNEL_PRECISION_HIGH]     = "high",
+    [KERNEL_PRECISION_EXACT]    = "exact"
+};
+
+/**
+ * Keeps the compiler from throwing the results away
+ */
+internal volatile double sink;
+
+/**
+ * How many `double`s are between two numbers
+ */
+internal uint64_t benchmark_ulps(double a, double b) {
+    int64_t x, y;
+
+    memcpy(&x, &a, sizeof(x));
+    memcpy(&y, &b, sizeof(y));
+
+    // Make the bits ordered like the numbers, when negative
+    if (x < 0) x = INT64_MIN - x;
+    if (y < 0) y = INT64_MIN - y;
+
+    return x > y ? (uint64_t) x - (uint64_t) y : (uint64_t) y - (uint64_t) x;
+}
+
+internal double benchmark_sample(const benchmark_function_t *function, uint32_t index) {
+    return function->from + (function->to - function->from) * index / (BENCHMARK_SAMPLES - 1);
+}
+
+void kernel_benchmark(void) {
+    static double inputs[BENCHMARK_SAMPLES];
+    static double expected[BENCHMARK_SAMPLES];
+
+#if PICO_ON_DEVICE
+    uint32_t mhz = clock_get_hz(clk_sys) / 1000000;
+    const char *unit = "cycles";
+#else
+    // The host has no system clock to count in, a thousand ticks per microsecond are ns
+    uint32_t mhz = 1000;
+    const char *unit = "ns";
+#endif
+
+    for (size_t f = 0; f < sizeof(functions) / sizeof(functions[0]); f++) {
+        const benchmark_function_t *function = &functions[f];
+
+        // The inputs and the libm results are computed before, so they're not in the timing
+        for (uint32_t index = 0; index < BENCHMARK_SAMPLES; index++) {
+            inputs[index] = benchmark_sample(function, index);
+            expected[index] = function->kernel(inputs[index], KERNEL_PRECISION_EXACT);
+        }
+
+        for (int precision = 0; precision < KERNEL_PRECISION_COUNT; precision++) {
+            double result = 0;
+            uint32_t start = time_us_32();
+
+            for (uint32_t index = 0; index < BENCHMARK_SAMPLES; index++) {
+                result += function->kernel(inputs[index], precision);
+            }
+
+            uint32_t elapsed = time_us_32() - start;
+
+            sink = result;
+
+            uint64_t worst_ulps = 0;
+            double worst_error = 0;
+
+            for (uint32_t index = 0; index < BENCHMARK_SAMPLES; index++) {
+                double value = function->kernel(inputs[index], precision);
+                double error = fabs(value - expected[index]) / fmax(1, fabs(expected[index]));
+
+                worst_ulps = MAX(worst_ulps, benchmark_ulps(value, expected[index]));
+                worst_error = fmax(worst_error, error);
+            }
+
+            printf(
+                "kernel %s %s %s=%lu ulp=%llu error=%.3e\n",
+                function->name,
+                precision_names[precision],
+                unit,
+                (unsigned long) ((uint64_t) elapsed * mhz / BENCHMARK_SAMPLES),
+                (unsigned long long) worst_ulps,
+                worst_error
+            );
+        }
+    }
+}
@@ -0,0 +1,19 @@
+#ifndef MATH_BENCHMARK_H
+#define MATH_BENCHMARK_H
+
+#include <util/util.h>
+
+/**
+ * Compare the math kernels against libm, for every precision: the worst error (in ULPs of a
+ * `double`, and relative) over a sweep of each function's range, and the cycles per call.
+ *
+ * NOTES
+ * - The results are printed to stdio, one line per function and precision:
+ *     `kernel <function> <precision> cycles=<n> ulp=<n> error=<relative error>`
+ *   where the precision `exact` is libm itself. The host builds have no system clock, they
+ *   print `ns=<n>` per call instead of the cycles.
+ * - This takes a few seconds, and blocks the core it runs on.
+ */
+external void kernel_benchmark(void);
+
+#endif /** MATH_BENCHMARK_H */
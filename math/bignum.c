@@ -0,0 +1,414 @@
+#include "bignum.h"
+#include <hardware/divider.h>
+#include <pico.h>
+#include <string.h>
+
+/**
+ * The most factors of a product tree leaf, they're multiplied into its limbs one at a time
+ * (each limb times the factor, in 64 bits), the bigger products are split in two
+ */
+#define BIGNUM_FACTORIAL_LEAF   16
+
+/******************** LIMB ARRAYS *************************/
+
+internal force_inline uint32_t limbs_trim(const uint32_t *limbs, uint32_t length) {
+    while (length > 0 && limbs[length - 1] == 0) {
+        length--;
+    }
+
+    return length;
+}
+
+internal int limbs_compare(const uint32_t *a, uint32_t a_length, const uint32_t *b, uint32_t b_length) {
+    if (a_length != b_length) {
+        return a_length > b_length ? 1 : -1;
+    }
+
+    for (uint32_t index = a_length; index > 0; index--) {
+        if (a[index - 1] != b[index - 1]) {
+            return a[index - 1] > b[index - 1] ? 1 : -1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * out = a + b, with a_length >= b_length, out has a_length limbs (can be a), returns the carry
+ */
+internal uint32_t limbs_add(uint32_t *out, const uint32_t *a, uint32_t a_length, const uint32_t *b, uint32_t b_length) {
+    uint64_t carry = 0;
+
+    for (uint32_t index = 0; index < a_length; index++) {
+        carry += (uint64_t) a[index] + (index < b_length ? b[index] : 0);
+        out[index] = (uint32_t) carry;
+        carry >>= 32;
+    }
+
+    return (uint32_t) carry;
+}
+
+/**
+ * out = a - b, with a >= b, out has a_length limbs (can be a)
+ */
+internal void limbs_subtract(uint32_t *out, const uint32_t *a, uint32_t a_length, const uint32_t *b, uint32_t b_length) {
+    int64_t borrow = 0;
+
+    for (uint32_t index = 0; index < a_length; index++) {
+        borrow += (int64_t) a[index] - (index < b_length ? b[index] : 0);
+        out[index] = (uint32_t) borrow;
+        borrow >>= 32;
+    }
+}
+
+/**
+ * out += value at an offset, up to out_length limbs
+ */
+internal void limbs_accumulate(uint32_t *out, uint32_t out_length, const uint32_t *value, uint32_t value_length) {
+    uint64_t carry = 0;
+    uint32_t index = 0;
+
+    for (; index < value_length; index++) {
+        carry += (uint64_t) out[index] + value[index];
+        out[index] = (uint32_t) carry;
+        carry >>= 32;
+    }
+
+    for (; carry != 0 && index < out_length; index++) {
+        carry += out[index];
+        out[index] = (uint32_t) carry;
+        carry >>= 32;
+    }
+}
+
+/**
+ * out = a * b, out has a_length + b_length limbs and can't be a or b
+ */
+internal void limbs_multiply_schoolbook(uint32_t *out, const uint32_t *a, uint32_t a_length, const uint32_t *b, uint32_t b_length) {
+    memset(out, 0, (a_length + b_length) * sizeof(uint32_t));
+
+    for (uint32_t i = 0; i < a_length; i++) {
+        uint64_t carry = 0;
+        uint64_t factor = a[i];
+
+        if (factor == 0) {
+            continue;
+        }
+
+        for (uint32_t j = 0; j < b_length; j++) {
+            carry += factor * b[j] + out[i + j];
+            out[i + j] = (uint32_t) carry;
+            carry >>= 32;
+        }
+
+        out[i + b_length] = (uint32_t) carry;
+    }
+}
+
+internal error_t limbs_multiply(arena_t *arena, uint32_t *out, const uint32_t *a, uint32_t a_length, const uint32_t *b, uint32_t b_length);
+
+/**
+ * out = a * b, both with `length` limbs, out has 2 * length limbs
+ */
+internal error_t limbs_karatsuba(arena_t *arena, uint32_t *out, const uint32_t *a, const uint32_t *b, uint32_t length) {
+    // a = a1 * B^low + a0, the same for b
+    uint32_t low = length / 2;
+    uint32_t high = length - low;
+
+    arena_mark_t mark = arena_mark(arena);
+
+    uint32_t *a_sum = arena_new(arena, uint32_t, high + 1);
+    uint32_t *b_sum = arena_new(arena, uint32_t, high + 1);
+    uint32_t *middle = arena_new(arena, uint32_t, 2 * (high + 1));
+
+    if (a_sum == NULL || b_sum == NULL || middle == NULL) {
+        arena_rewind(arena, mark);
+
+        return -EOUTOFMEMORY;
+    }
+
+    // z0 = a0 * b0 and z2 = a1 * b1 go straight where they belong
+    error_t error = limbs_multiply(arena, out, a, low, b, low);
+
+    if (error == 0x00) {
+        error = limbs_multiply(arena, &out[2 * low], &a[low], high, &b[low], high);
+    }
+
+    if (error == 0x00) {
+        // z1 = (a0 + a1) * (b0 + b1) - z0 - z2
+        a_sum[high] = limbs_add(a_sum, &a[low], high, a, low);
+        b_sum[high] = limbs_add(b_sum, &b[low], high, b, low);
+
+        error = limbs_multiply(arena, middle, a_sum, high + 1, b_sum, high + 1);
+    }
+
+    if (error == 0x00) {
+        uint32_t middle_length = 2 * (high + 1);
+
+        limbs_subtract(middle, middle, middle_length, out, 2 * low);
+        limbs_subtract(middle, middle, middle_length, &out[2 * low], 2 * high);
+
+        limbs_accumulate(&out[low], 2 * length - low, middle, limbs_trim(middle, middle_length));
+    }
+
+    arena_rewind(arena, mark);
+
+    return error;
+}
+
+/**
+ * out = a * b, out has a_length + b_length limbs and can't be a or b
+ */
+internal error_t limbs_multiply(arena_t *arena, uint32_t *out, const uint32_t *a, uint32_t a_length, const uint32_t *b, uint32_t b_length) {
+    if (a_length < b_length) {
+        return limbs_multiply(arena, out, b, b_length, a, a_length);
+    }
+
+    if (b_length < BIGNUM_KARATSUBA_THRESHOLD) {
+        limbs_multiply_schoolbook(out, a, a_length, b, b_length);
+
+        return 0x00;
+    }
+
+    if (a_length == b_length) {
+        return limbs_karatsuba(arena, out, a, b, a_length);
+    }
+
+    // Unbalanced: multiply b by each b-sized slice of a, so every product is balanced
+    arena_mark_t mark = arena_mark(arena);
+    uint32_t *product = arena_new(arena, uint32_t, 2 * b_length);
+
+    if (product == NULL) {
+        return -EOUTOFMEMORY;
+    }
+
+    memset(out, 0, (a_length + b_length) * sizeof(uint32_t));
+
+    error_t error = 0x00;
+
+    for (uint32_t offset = 0; offset < a_length && error == 0x00; offset += b_length) {
+        uint32_t slice = MIN(b_length, a_length - offset);
+
+        error = limbs_multiply(arena, product, &a[offset], slice, b, b_length);
+
+        if (error == 0x00) {
+            limbs_accumulate(&out[offset], a_length + b_length - offset, product, slice + b_length);
+        }
+    }
+
+    arena_rewind(arena, mark);
+
+    return error;
+}
+
+/******************** BIG NUMBERS *************************/
+
+internal error_t bignum_allocate(arena_t *arena, uint32_t length, bignum_t *result) {
+    // Zero doesn't need limbs, but keep a valid pointer
+    result->limbs = arena_new(arena, uint32_t, MAX(length, 1));
+    result->length = length;
+    result->negative = false;
+
+    return result->limbs == NULL ? -EOUTOFMEMORY : 0x00;
+}
+
+error_t bignum_from_integer(arena_t *arena, int64_t value, bignum_t *result) {
+    uint64_t magnitude = value < 0 ? -(uint64_t) value : (uint64_t) value;
+    error_t error = bignum_allocate(arena, 2, result);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    result->limbs[0] = (uint32_t) magnitude;
+    result->limbs[1] = (uint32_t) (magnitude >> 32);
+    result->length = limbs_trim(result->limbs, 2);
+    result->negative = value < 0;
+
+    return 0x00;
+}
+
+/**
+ * result = |left| + |right| or |left| - |right|, with the sign of left (flipped if the
+ * magnitude of right is bigger and they're subtracted)
+ */
+internal error_t bignum_add_magnitudes(arena_t *arena, const bignum_t *left, const bignum_t *right, bool subtract, bignum_t *result) {
+    int order = limbs_compare(left->limbs, left->length, right->limbs, right->length);
+    const bignum_t *big = order >= 0 ? left : right;
+    const bignum_t *small = order >= 0 ? right : left;
+
+    error_t error = bignum_allocate(arena, big->length + 1, result);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    if (subtract) {
+        limbs_subtract(result->limbs, big->limbs, big->length, small->limbs, small->length);
+        result->limbs[big->length] = 0;
+        result->negative = order >= 0 ? left->negative : !left->negative;
+    } else {
+        result->limbs[big->length] = limbs_add(result->limbs, big->limbs, big->length, small->limbs, small->length);
+        result->negative = left->negative;
+    }
+
+    result->length = limbs_trim(result->limbs, big->length + 1);
+
+    if (result->length == 0) {
+        result->negative = false;
+    }
+
+    return 0x00;
+}
+
+error_t bignum_add(arena_t *arena, const bignum_t *left, const bignum_t *right, bignum_t *result) {
+    return bignum_add_magnitudes(arena, left, right, left->negative != right->negative, result);
+}
+
+error_t bignum_subtract(arena_t *arena, const bignum_t *left, const bignum_t *right, bignum_t *result) {
+    return bignum_add_magnitudes(arena, left, right, left->negative == right->negative, result);
+}
+
+error_t bignum_multiply(arena_t *arena, const bignum_t *left, const bignum_t *right, bignum_t *result) {
+    uint32_t length = left->length + right->length;
+    error_t error = bignum_allocate(arena, length, result);
+
+    if (error != 0x00 || length == 0 || left->length == 0 || right->length == 0) {
+        result->length = 0;
+
+        return error;
+    }
+
+    error = limbs_multiply(arena, result->limbs, left->limbs, left->length, right->limbs, right->length);
+
+    result->length = limbs_trim(result->limbs, length);
+    result->negative = result->length != 0 && left->negative != right->negative;
+
+    return error;
+}
+
+/**
+ * The product of every integer in [from, to]
+ */
+internal error_t bignum_product(arena_t *arena, uint32_t from, uint32_t to, bignum_t *result) {
+    if (to - from < BIGNUM_FACTORIAL_LEAF) {
+        error_t error = bignum_allocate(arena, to - from + 2, result);
+
+        if (error != 0x00) {
+            return error;
+        }
+
+        // Multiply by each factor in place, a limb times a 32-bit factor at a time
+        result->limbs[0] = 1;
+        result->length = 1;
+
+        for (uint32_t factor = from; factor <= to; factor++) {
+            uint64_t carry = 0;
+
+            for (uint32_t index = 0; index < result->length; index++) {
+                carry += (uint64_t) result->limbs[index] * factor;
+                result->limbs[index] = (uint32_t) carry;
+                carry >>= 32;
+            }
+
+            if (carry != 0) {
+                result->limbs[result->length++] = (uint32_t) carry;
+            }
+        }
+
+        return 0x00;
+    }
+
+    arena_mark_t mark = arena_mark(arena);
+    uint32_t middle = from + (to - from) / 2;
+    bignum_t low, high, product;
+
+    error_t error = bignum_product(arena, from, middle, &low);
+
+    if (error == 0x00) error = bignum_product(arena, middle + 1, to, &high);
+    if (error == 0x00) error = bignum_multiply(arena, &low, &high, &product);
+
+    if (error != 0x00) {
+        arena_rewind(arena, mark);
+
+        return error;
+    }
+
+    // Only the product is kept: move it down to the mark, over the halves
+    arena_rewind(arena, mark);
+    error = bignum_allocate(arena, product.length, result);
+
+    memmove(result->limbs, product.limbs, product.length * sizeof(uint32_t));
+
+    return error;
+}
+
+error_t bignum_factorial(arena_t *arena, uint32_t n, bignum_t *result) {
+    if (n < 2) {
+        return bignum_from_integer(arena, 1, result);
+    }
+
+    return bignum_product(arena, 2, n, result);
+}
+
+uint32_t bignum_divide_small(bignum_t *value, uint16_t divisor) {
+    uint32_t remainder = 0;
+
+    // The hardware divider is 32/32 bits, so each limb is divided 16 bits at a time: the
+    // remainder is below the divisor, so `remainder << 16 | half` always fits
+    for (uint32_t index = value->length; index > 0; index--) {
+        uint32_t limb = value->limbs[index - 1];
+
+        divmod_result_t high = hw_divider_divmod_u32((remainder << 16) | (limb >> 16), divisor);
+        divmod_result_t low = hw_divider_divmod_u32((to_remainder_u32(high) << 16) | (limb & 0xFFFF), divisor);
+
+        value->limbs[index - 1] = (to_quotient_u32(high) << 16) | to_quotient_u32(low);
+        remainder = to_remainder_u32(low);
+    }
+
+    value->length = limbs_trim(value->limbs, value->length);
+
+    return remainder;
+}
+
+error_t bignum_digits_init(arena_t *arena, const bignum_t *value, bignum_digits_t *digits) {
+    error_t error = bignum_allocate(arena, value->length, &digits->rest);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    memcpy(digits->rest.limbs, value->limbs, value->length * sizeof(uint32_t));
+
+    digits->started = false;
+
+    return 0x00;
+}
+
+size_t bignum_digits_next(bignum_digits_t *digits, char *chunk) {
+    if (digits->rest.length == 0 && digits->started) {
+        return 0;
+    }
+
+    digits->started = true;
+
+    uint32_t value = bignum_divide_small(&digits->rest, 10000);
+
+    // Only the last chunk (the most significant one) drops its leading zeros
+    size_t count = BIGNUM_DIGITS_CHUNK;
+
+    if (digits->rest.length == 0) {
+        count = 1;
+
+        for (uint32_t bound = 10; count < BIGNUM_DIGITS_CHUNK && value >= bound; bound *= 10) {
+            count++;
+        }
+    }
+
+    for (size_t index = count; index > 0; index--) {
+        chunk[index - 1] = '0' + value % 10;
+        value /= 10;
+    }
+
+    return count;
+}
@@ -0,0 +1,117 @@
+#ifndef MATH_BIGNUM_H
+#define MATH_BIGNUM_H
+
+#include <math/expr.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <util/arena.h>
+#include <util/util.h>
+#include <errno.h>
+
+/**
+ * Arbitrary precision integers, for exact results that don't fit in 64 bits (`100!`).
+ *
+ * The limbs of every number are allocated in an arena, so a whole computation is freed at
+ * once by resetting (or rewinding) it.
+ */
+
+/**
+ * Products of numbers with at least this many limbs use Karatsuba, below it the schoolbook
+ * method is faster (it has no additions and no scratch memory)
+ */
+#define BIGNUM_KARATSUBA_THRESHOLD  24
+
+/**
+ * How many decimal digits `bignum_digits_next` makes at a time
+ */
+#define BIGNUM_DIGITS_CHUNK         4
+
+typedef struct bignum_t
+{
+    /**
+     * The magnitude in base 2^32, least significant limb first, without leading zero limbs
+     * (zero has no limbs at all)
+     */
+    uint32_t    *limbs;
+    uint32_t    length;
+
+    bool        negative;
+} bignum_t;
+
+/**
+ * Turns a number into decimal digits a chunk at a time, so the display can start showing
+ * them before the whole conversion is done
+ */
+typedef struct bignum_digits_t
+{
+    /** What's left to convert, a copy that is divided by 10^4 every chunk */
+    bignum_t    rest;
+
+    /** If a chunk was made, so zero still makes a `0` */
+    bool        started;
+} bignum_digits_t;
+
+/**
+ * Make a number from an integer
+ *
+ * RETURN VALUE
+ * - EOUTOFMEMORY: if the arena is full
+ */
+external error_t bignum_from_integer(arena_t *arena, int64_t value, bignum_t *result);
+
+/**
+ * The arithmetic of big numbers, the result is allocated in the arena (it can't be one of
+ * the operands)
+ *
+ * NOTES
+ * - `bignum_multiply` uses Karatsuba when both numbers have at least
+ *   `BIGNUM_KARATSUBA_THRESHOLD` limbs, its scratch memory is taken from the arena and
+ *   given back before it returns.
+ *
+ * RETURN VALUE
+ * - EOUTOFMEMORY: if the arena is full
+ */
+external error_t bignum_add(arena_t *arena, const bignum_t *left, const bignum_t *right, bignum_t *result);
+external error_t bignum_subtract(arena_t *arena, const bignum_t *left, const bignum_t *right, bignum_t *result);
+external error_t bignum_multiply(arena_t *arena, const bignum_t *left, const bignum_t *right, bignum_t *result);
+
+/**
+ * n!, multiplied as a balanced product tree so most of the work is in big Karatsuba products
+ *
+ * RETURN VALUE
+ * - EOUTOFMEMORY: if the arena is full
+ */
+external error_t bignum_factorial(arena_t *arena, uint32_t n, bignum_t *result);
+
+/**
+ * Divide a number by a small divisor, in place, with the hardware divider
+ *
+ * RETURN VALUE
+ * - the remainder of the magnitude
+ */
+external uint32_t bignum_divide_small(bignum_t *value, uint16_t divisor);
+
+/**
+ * Start converting a number to decimal
+ *
+ * RETURN VALUE
+ * - EOUTOFMEMORY: if the arena is full (the number is copied)
+ */
+external error_t bignum_digits_init(arena_t *arena, const bignum_t *value, bignum_digits_t *digits);
+
+/**
+ * Make the next chunk of digits of the magnitude, from the least significant one: the
+ * digits come right to left, like a right aligned result is drawn.
+ *
+ * PARAMETERS
+ * - digits: the conversion
+ * - chunk: where the digits are written (in reading order), `BIGNUM_DIGITS_CHUNK` of them,
+ *   the leading zeros of the last chunk are not written
+ *
+ * RETURN VALUE
+ * - how many digits were written, 0 when the conversion is done (zero is a single `0`)
+ */
+external size_t bignum_digits_next(bignum_digits_t *digits, char *chunk);
+
+#endif /** MATH_BIGNUM_H */
@@ -0,0 +1,171 @@
+#ifndef MATH_EXPR_H
+#define MATH_EXPR_H
+
+#include <math/number.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <util/util.h>
+#include <util/types.h>
+#include <errno.h>
+
+/**
+ * An expression is compiled once (see `math/parser.h`) into a compact stack machine program,
+ * and then evaluated as many times as needed (see `math/vm.h`), e.g. once per column of a
+ * graph, without parsing it again or allocating any memory.
+ */
+
+/**
+ * The limits of a compiled expression, everything is kept inside the `expr_t` itself
+ */
+#define EXPR_MAX_CODE           128
+#define EXPR_MAX_CONSTANTS      32
+#define EXPR_MAX_STACK          16
+
+/**
+ * The variables an expression can use, one for each letter (`a` to `z`). The letter `e` is
+ * always Euler's number, so its slot is never used.
+ */
+#define EXPR_VARIABLE_COUNT     26
+
+typedef enum expr_error_t
+{
+    /** The expression is not well formed */
+    ESYNTAX             = 0x10,
+
+    /** The expression doesn't fit in the limits of an `expr_t` */
+    ETOOCOMPLEX         = 0x11,
+
+    /** The expression uses a function or constant that doesn't exist */
+    EUNKNOWNNAME        = 0x12,
+
+    /** The result is not a number (e.g. `sqrt(-1)` or `0/0`) */
+    EDOMAIN             = 0x13,
+
+    /** The result doesn't fit in the kind of number it was evaluated with */
+    ENUMBERRANGE        = 0x14,
+
+    /** The arena the result is allocated in is full */
+    EOUTOFMEMORY        = 0x15
+} expr_error_t;
+
+/**
+ * The cheapest kind of number an expression can be evaluated with (see `math/number.h`),
+ * every evaluator of a lower tier can also be used
+ */
+typedef enum expr_tier_t: byte
+{
+    /** Only `+ - * /`, integer powers and rounding of exact numbers, see `expr_evaluate_rational` */
+    EXPR_TIER_RATIONAL  = 0x00,
+
+    /** Inexact constants (`pi`) and the functions with fixed point kernels, see `expr_evaluate_fixed` */
+    EXPR_TIER_FIXED     = 0x01,
+
+    /** Needs `double`, see `expr_evaluate` */
+    EXPR_TIER_FLOAT     = 0x02
+} expr_tier_t;
+
+/**
+ * The instructions of the stack machine, each one is a single byte, some are followed by one
+ * operand byte
+ */
+typedef enum expr_op_t: byte
+{
+    /** Push `constants[operand]` */
+    EXPR_OP_CONSTANT    = 0x00,
+
+    /** Push `variables[operand]` */
+    EXPR_OP_VARIABLE    = 0x01,
+
+    /** Pop two values, push the result */
+    EXPR_OP_ADD         = 0x02,
+    EXPR_OP_SUBTRACT    = 0x03,
+    EXPR_OP_MULTIPLY    = 0x04,
+    EXPR_OP_DIVIDE      = 0x05,
+    EXPR_OP_POWER       = 0x06,
+
+    /** Pop one value, push the result */
+    EXPR_OP_NEGATE      = 0x07,
+
+    /** Pop one value, push `expr_function_t(operand)` of it */
+    EXPR_OP_CALL        = 0x08,
+
+    /** Stop, the result is on the top of the stack */
+    EXPR_OP_RETURN      = 0x09
+} expr_op_t;
+
+/**
+ * The functions an expression can call, these are the operands of `EXPR_OP_CALL`
+ */
+typedef enum expr_function_t: byte
+{
+    EXPR_FUNCTION_SIN       = 0x00,
+    EXPR_FUNCTION_COS       = 0x01,
+    EXPR_FUNCTION_TAN       = 0x02,
+    EXPR_FUNCTION_ASIN      = 0x03,
+    EXPR_FUNCTION_ACOS      = 0x04,
+    EXPR_FUNCTION_ATAN      = 0x05,
+    EXPR_FUNCTION_SINH      = 0x06,
+    EXPR_FUNCTION_COSH      = 0x07,
+    EXPR_FUNCTION_TANH      = 0x08,
+    EXPR_FUNCTION_SQRT      = 0x09,
+    EXPR_FUNCTION_CBRT      = 0x0A,
+    EXPR_FUNCTION_EXP       = 0x0B,
+    EXPR_FUNCTION_LN        = 0x0C,
+    EXPR_FUNCTION_LOG       = 0x0D,
+    EXPR_FUNCTION_ABS       = 0x0E,
+    EXPR_FUNCTION_FLOOR     = 0x0F,
+    EXPR_FUNCTION_CEIL      = 0x10,
+    EXPR_FUNCTION_ROUND     = 0x11,
+
+    EXPR_FUNCTION_COUNT
+} expr_function_t;
+
+/**
+ * A compiled expression
+ */
+typedef struct expr_t
+{
+    /**
+     * The instructions, always ending with `EXPR_OP_RETURN`
+     */
+    byte        code[EXPR_MAX_CODE];
+    uint8_t     code_size;
+
+    /**
+     * The numbers used by the expression, the parser folds the operations that only use
+     * constants, so these can also be results computed when the expression was compiled
+     */
+    double      constants[EXPR_MAX_CONSTANTS];
+    uint8_t     constant_count;
+
+    /**
+     * The constants in Q16.16, so the fixed point evaluator doesn't convert them every time,
+     * only valid if `fixed_constants_fit`
+     */
+    fixed_t     fixed_constants[EXPR_MAX_CONSTANTS];
+    bool        fixed_constants_fit;
+
+    /**
+     * The cheapest kind of number the expression can be evaluated with
+     */
+    expr_tier_t tier;
+
+    /**
+     * The deepest the stack gets while running the program, always up to `EXPR_MAX_STACK`,
+     * so the evaluator doesn't need to check it
+     */
+    uint8_t     stack_depth;
+
+    /**
+     * A bit for each variable the expression reads (bit 0 is `a`)
+     */
+    uint32_t    variables;
+} expr_t;
+
+/**
+ * The variable slot of a letter
+ */
+#define EXPR_VARIABLE(letter) ((letter) - 'a')
+
+#endif /** MATH_EXPR_H */
@@ -0,0 +1,440 @@
+#include "kernel.h"
+#include <math.h>
+#include <pico.h>
+#include <string.h>
+
+/**
+ * Q2.30, the format every kernel works in
+ */
+#define Q30_ONE             (INT32_C(1) << 30)
+#define Q30_HALF_PI         INT32_C(1686629713)
+#define Q30_TWO_OVER_PI     INT32_C(683565276)
+#define Q30_LN2             INT32_C(744261118)
+#define Q30_LOG2E           INT32_C(1549082005)
+
+/**
+ * 1 / the gain of the CORDIC rotations, the vectors start with this length so they end up
+ * with a length of one
+ */
+#define CORDIC_GAIN         INT32_C(652032874)
+
+/**
+ * Past this the `double` argument reduction for sin/cos/tan loses precision, so libm is used
+ */
+#define KERNEL_MAX_REDUCTION 1e6
+
+/**
+ * Under this the absolute error of the CORDIC (2^-30) is most of the result, so sin, tan and
+ * atan use the first three terms of their series instead: the next one is under 2^-60 of it
+ */
+#define KERNEL_SERIES_LIMIT 0x1p-10
+
+/**
+ * The two halves of pi/2 for the argument reduction, the high one has its low bits cleared so
+ * `k * PIO2_HI` is exact
+ */
+#define PIO2_HI             1.57079632673412561417e+00
+#define PIO2_LO             6.07710050650619224932e-11
+
+/**
+ * atan(2^-i) in Q2.30
+ */
+internal const int32_t cordic_angles[31] = {
+    843314857, 497837829, 263043837, 133525159, 67021687, 33543516, 16775851, 8388437,
+    4194283,   2097149,   1048576,   524288,    262144,   131072,   65536,    32768,
+    16384,     8192,      4096,      2048,      1024,     512,      256,      128,
+    64,        32,        16,        8,         4,        2,        1
+};
+
+/**
+ * 2^(i/16) in Q2.30
+ */
+internal const int32_t exp2_table[16] = {
+    1073741824, 1121280436, 1170923762, 1222764986, 1276901417, 1333434672, 1392470869, 1454120821,
+    1518500250, 1585730000, 1655936265, 1729250827, 1805811301, 1885761398, 1969251188, 2056437387
+};
+
+/**
+ * ln(1 + i/16) and 1 / (1 + i/16) in Q2.30
+ */
+internal const int32_t ln_table[16] = {
+    0,         65095192,  126468572, 184522808, 239598564, 291986604, 341937090, 389666807,
+    435364845, 479197128, 521310048, 561833416, 600882877, 638561895, 674963409, 710171213
+};
+
+internal const int32_t reciprocal_table[16] = {
+    1073741824, 1010580540, 954437177, 904203641, 858993459, 818089009, 780903145, 746950834,
+    715827883,  687194767,  660764199, 636291451, 613566757, 592409282, 572662306, 554189329
+};
+
+/**
+ * How much work each precision does: CORDIC iterations, and the degree of the exp and ln
+ * polynomials (of what's left after the table, up to 1/16)
+ */
+internal const uint8_t cordic_iterations[KERNEL_PRECISION_COUNT] = { 18, 26, 30, 30 };
+internal const uint8_t exp_degree[KERNEL_PRECISION_COUNT]        = { 2, 3, 4, 4 };
+internal const uint8_t ln_degree[KERNEL_PRECISION_COUNT]         = { 3, 5, 6, 6 };
+
+internal force_inline int32_t q30_multiply(int32_t a, int32_t b) {
+    return (int32_t) (((int64_t) a * b) >> 30);
+}
+
+/**
+ * Q2.30 to Q16.16, rounded
+ */
+internal force_inline fixed_t q30_to_fixed(int64_t value) {
+    return (fixed_t) ((value + (1 << 13)) >> 14);
+}
+
+internal force_inline double q30_to_double(int32_t value) {
+    return ldexp((double) value, -30);
+}
+
+/**
+ * Rotate (1, 0) by an angle in [-pi/2, pi/2]
+ */
+internal void kernel_cordic_rotate(int32_t angle, uint8_t iterations, int32_t *sin, int32_t *cos) {
+    int32_t x = CORDIC_GAIN;
+    int32_t y = 0;
+    int32_t z = angle;
+
+    for (uint8_t i = 0; i < iterations; i++) {
+        int32_t dx = y >> i;
+        int32_t dy = x >> i;
+
+        if (z >= 0) {
+            x -= dx;
+            y += dy;
+            z -= cordic_angles[i];
+        } else {
+            x += dx;
+            y -= dy;
+            z += cordic_angles[i];
+        }
+    }
+
+    *sin = y;
+    *cos = x;
+}
+
+/**
+ * The angle of (x, y), x needs to be positive and both below 2^29
+ */
+internal int32_t kernel_cordic_vector(int32_t x, int32_t y, uint8_t iterations) {
+    int32_t z = 0;
+
+    for (uint8_t i = 0; i < iterations; i++) {
+        int32_t dx = y >> i;
+        int32_t dy = x >> i;
+
+        if (y > 0) {
+            x += dx;
+            y -= dy;
+            z += cordic_angles[i];
+        } else {
+            x -= dx;
+            y += dy;
+            z -= cordic_angles[i];
+        }
+    }
+
+    return z;
+}
+
+/**
+ * The sine and cosine of `quadrant * pi/2 + angle`, with angle in [-pi/4, pi/4]
+ */
+internal void kernel_sincos_quadrant(int32_t angle, uint32_t quadrant, uint8_t iterations, int32_t *sin, int32_t *cos) {
+    int32_t s, c;
+
+    kernel_cordic_rotate(angle, iterations, &s, &c);
+
+    switch (quadrant & 3) {
+    case 0: *sin = s;  *cos = c;  break;
+    case 1: *sin = c;  *cos = -s; break;
+    case 2: *sin = -s; *cos = -c; break;
+    case 3: *sin = -c; *cos = s;  break;
+    }
+}
+
+/**
+ * Split a Q16.16 angle in quarter turns and what's left, in Q2.30 radians
+ */
+internal void kernel_reduce_fixed(fixed_t angle, int32_t *reduced, uint32_t *quadrant) {
+    // The angle in quarter turns, Q18.46
+    int64_t turns = (int64_t) angle * Q30_TWO_OVER_PI;
+    int64_t nearest = (turns + (INT64_C(1) << 45)) >> 46;
+
+    *quadrant = (uint32_t) nearest;
+    *reduced = q30_multiply((int32_t) ((turns - (nearest << 46)) >> 16), Q30_HALF_PI);
+}
+
+/**
+ * The same for a `double`, only call it up to `KERNEL_MAX_REDUCTION`
+ */
+internal void kernel_reduce(double angle, int32_t *reduced, uint32_t *quadrant) {
+    double nearest = round(angle * M_2_PI);
+
+    *quadrant = (uint32_t) (int32_t) nearest;
+    *reduced = (int32_t) ldexp((angle - nearest * PIO2_HI) - nearest * PIO2_LO, 30);
+}
+
+/**
+ * 2^fraction for a fraction in [0, 1) in Q2.30, the result is in [1, 2)
+ */
+internal uint32_t kernel_exp2_q30(int32_t fraction, uint8_t degree) {
+    int32_t index = fraction >> 26;
+
+    // e^a for what the table doesn't cover, a < ln(2)/16
+    int32_t a = q30_multiply(fraction & ((1 << 26) - 1), Q30_LN2);
+    int32_t polynomial = Q30_ONE;
+
+    for (uint8_t k = degree; k > 0; k--) {
+        polynomial = Q30_ONE + q30_multiply(a, polynomial) / k;
+    }
+
+    // This can round up to 2, which doesn't fit in a signed Q2.30
+    return (uint32_t) (((int64_t) exp2_table[index] * polynomial) >> 30);
+}
+
+/**
+ * ln(mantissa) for a mantissa in [1, 2) in Q2.30
+ */
+internal int32_t kernel_ln_q30(int32_t mantissa, uint8_t degree) {
+    int32_t index = (mantissa >> 26) & 15;
+
+    // ln(1 + d) for what the table doesn't cover, d = mantissa / (1 + index/16) - 1 < 1/16
+    int32_t d = q30_multiply(mantissa - (Q30_ONE + (index << 26)), reciprocal_table[index]);
+    int32_t polynomial = Q30_ONE / degree;
+
+    for (uint8_t k = degree - 1; k > 0; k--) {
+        polynomial = Q30_ONE / k - q30_multiply(d, polynomial);
+    }
+
+    return ln_table[index] + q30_multiply(d, polynomial);
+}
+
+void kernel_sincos_fixed(fixed_t angle, kernel_precision_t precision, fixed_t *sin, fixed_t *cos) {
+    int32_t reduced, s, c;
+    uint32_t quadrant;
+
+    kernel_reduce_fixed(angle, &reduced, &quadrant);
+    kernel_sincos_quadrant(reduced, quadrant, cordic_iterations[precision], &s, &c);
+
+    *sin = q30_to_fixed(s);
+    *cos = q30_to_fixed(c);
+}
+
+bool kernel_tan_fixed(fixed_t angle, kernel_precision_t precision, fixed_t *result) {
+    int32_t reduced, s, c;
+    uint32_t quadrant;
+
+    kernel_reduce_fixed(angle, &reduced, &quadrant);
+    kernel_sincos_quadrant(reduced, quadrant, cordic_iterations[precision], &s, &c);
+
+    if (c == 0) {
+        return false;
+    }
+
+    int64_t tangent = ((int64_t) s * FIXED_ONE) / c;
+
+    *result = (fixed_t) tangent;
+
+    return tangent >= FIXED_MIN && tangent <= FIXED_MAX;
+}
+
+fixed_t kernel_atan_fixed(fixed_t value, kernel_precision_t precision) {
+    int32_t x = FIXED_ONE;
+    int32_t y = value;
+
+    // Use as many bits as possible, but keep room for the CORDIC gain
+    while (x < (1 << 28) && y < (1 << 28) && y > -(1 << 28)) {
+        x <<= 1;
+        y <<= 1;
+    }
+
+    while (y >= (1 << 29) || y <= -(1 << 29)) {
+        x >>= 1;
+        y >>= 1;
+    }
+
+    return q30_to_fixed(kernel_cordic_vector(MAX(x, 1), y, cordic_iterations[precision]));
+}
+
+bool kernel_exp_fixed(fixed_t value, kernel_precision_t precision, fixed_t *result) {
+    // value / ln(2) in Q18.46, split in an integer and a fraction
+    int64_t power = (int64_t) value * Q30_LOG2E;
+    int32_t integer = (int32_t) (power >> 46);
+    int32_t fraction = (int32_t) ((power - ((int64_t) integer << 46)) >> 16);
+
+    // The mantissa is in [1, 2) and Q16.16 goes up to 2^15
+    if (integer > 14) {
+        return false;
+    }
+
+    uint32_t mantissa = kernel_exp2_q30(fraction, exp_degree[precision]);
+    int32_t shift = 14 - integer;
+    uint64_t rounded = shift >= 31 ? 0 : ((uint64_t) mantissa + ((UINT64_C(1) << shift) >> 1)) >> shift;
+
+    // The mantissa can round up to 2, which is 2^15 when the integer is 14
+    if (rounded > FIXED_MAX) {
+        return false;
+    }
+
+    *result = (fixed_t) rounded;
+
+    return true;
+}
+
+bool kernel_ln_fixed(fixed_t value, kernel_precision_t precision, fixed_t *result) {
+    if (value <= 0) {
+        return false;
+    }
+
+    // value = 2^(top - 16) * mantissa, with the mantissa in [1, 2)
+    int32_t top = 31 - __builtin_clz(value);
+    int32_t mantissa = value << (30 - top);
+
+    *result = q30_to_fixed((int64_t) (top - FIXED_FRACTION_BITS) * Q30_LN2 + kernel_ln_q30(mantissa, ln_degree[precision]));
+
+    return true;
+}
+
+bool kernel_sqrt_fixed(fixed_t value, fixed_t *result) {
+    if (value < 0) {
+        return false;
+    }
+
+    // sqrt(value * 2^16) is the result in Q16.16, one bit at a time
+    uint64_t remainder = (uint64_t) value << FIXED_FRACTION_BITS;
+    uint64_t root = 0;
+    uint64_t bit = UINT64_C(1) << 46;
+
+    while (bit > remainder) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (remainder >= root + bit) {
+            remainder -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+
+        bit >>= 2;
+    }
+
+    *result = (fixed_t) root;
+
+    return true;
+}
+
+double kernel_sin(double value, kernel_precision_t precision) {
+    if (precision == KERNEL_PRECISION_EXACT || !(fabs(value) < KERNEL_MAX_REDUCTION)) {
+        return sin(value);
+    }
+
+    if (fabs(value) < KERNEL_SERIES_LIMIT) {
+        double square = value * value;
+
+        return value * (1 - square / 6 * (1 - square / 20));
+    }
+
+    int32_t reduced, s, c;
+    uint32_t quadrant;
+
+    kernel_reduce(value, &reduced, &quadrant);
+    kernel_sincos_quadrant(reduced, quadrant, cordic_iterations[precision], &s, &c);
+
+    return q30_to_double(s);
+}
+
+double kernel_cos(double value, kernel_precision_t precision) {
+    if (precision == KERNEL_PRECISION_EXACT || !(fabs(value) < KERNEL_MAX_REDUCTION)) {
+        return cos(value);
+    }
+
+    int32_t reduced, s, c;
+    uint32_t quadrant;
+
+    kernel_reduce(value, &reduced, &quadrant);
+    kernel_sincos_quadrant(reduced, quadrant, cordic_iterations[precision], &s, &c);
+
+    return q30_to_double(c);
+}
+
+double kernel_tan(double value, kernel_precision_t precision) {
+    if (precision == KERNEL_PRECISION_EXACT || !(fabs(value) < KERNEL_MAX_REDUCTION)) {
+        return tan(value);
+    }
+
+    if (fabs(value) < KERNEL_SERIES_LIMIT) {
+        double square = value * value;
+
+        return value * (1 + square / 3 * (1 + square * 2 / 5));
+    }
+
+    int32_t reduced, s, c;
+    uint32_t quadrant;
+
+    kernel_reduce(value, &reduced, &quadrant);
+    kernel_sincos_quadrant(reduced, quadrant, cordic_iterations[precision], &s, &c);
+
+    return (double) s / (double) c;
+}
+
+double kernel_atan(double value, kernel_precision_t precision) {
+    if (precision == KERNEL_PRECISION_EXACT || isnan(value)) {
+        return atan(value);
+    }
+
+    if (fabs(value) < KERNEL_SERIES_LIMIT) {
+        double square = value * value;
+
+        return value * (1 - square / 3 * (1 - square * 3 / 5));
+    }
+
+    int exponent;
+    double mantissa = frexp(value, &exponent);
+
+    // Past 2^29 the angle is pi/2 to the precision of the kernels
+    if (exponent > 29) {
+        return copysign(M_PI_2, value);
+    }
+
+    // value = mantissa * 2^exponent, so its angle is the one of (2^-exponent, mantissa)
+    int32_t x = exponent > 0 ? (1 << (29 - exponent)) : (1 << 29);
+    int32_t y = (int32_t) ldexp(exponent > 0 ? mantissa : value, 29);
+
+    return q30_to_double(kernel_cordic_vector(x, y, cordic_iterations[precision]));
+}
+
+double kernel_exp(double value, kernel_precision_t precision) {
+    if (precision == KERNEL_PRECISION_EXACT || !(fabs(value) < 700)) {
+        return exp(value);
+    }
+
+    double power = value * M_LOG2E;
+    double integer = floor(power);
+    int32_t fraction = (int32_t) ldexp(power - integer, 30);
+
+    return ldexp(kernel_exp2_q30(fraction, exp_degree[precision]), (int) integer - 30);
+}
+
+double kernel_ln(double value, kernel_precision_t precision) {
+    // Negative numbers, zero, subnormals, infinities and NaNs
+    if (precision == KERNEL_PRECISION_EXACT || !(value >= 0x1p-1022 && value <= 0x1p1023)) {
+        return log(value);
+    }
+
+    uint64_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+
+    // The exponent and the top 30 bits of the mantissa, straight from the IEEE 754 bits
+    int32_t exponent = (int32_t) ((bits >> 52) & 0x7FF) - 1023;
+    int32_t mantissa = Q30_ONE | (int32_t) ((bits >> 22) & (Q30_ONE - 1));
+
+    return exponent * M_LN2 + q30_to_double(kernel_ln_q30(mantissa, ln_degree[precision]));
+}
@@ -0,0 +1,82 @@
+#ifndef MATH_KERNEL_H
+#define MATH_KERNEL_H
+
+#include <math/number.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+
+/**
+ * Transcendental functions for the Cortex-M0+, which has no FPU and where newlib's libm is
+ * slow: everything is computed with 32-bit integers in Q2.30.
+ *
+ * - sin, cos and atan are CORDIC (only shifts and adds, one iteration per bit).
+ * - exp and ln use a 16 entry table (in flash) and a short polynomial for the rest.
+ *
+ * The `double` versions only use soft-float for the argument reduction and to convert the
+ * result back.
+ */
+
+/**
+ * How precise the kernels are, the lower the faster
+ */
+typedef enum kernel_precision_t: byte
+{
+    /** About 16 bits, enough for Q16.16 and graphing */
+    KERNEL_PRECISION_LOW    = 0x00,
+
+    /** About 22 bits, close to a `float` */
+    KERNEL_PRECISION_MEDIUM = 0x01,
+
+    /** About 26 bits, the best the Q2.30 kernels get */
+    KERNEL_PRECISION_HIGH   = 0x02,
+
+    /** Full `double` precision, this is libm */
+    KERNEL_PRECISION_EXACT  = 0x03,
+
+    KERNEL_PRECISION_COUNT
+} kernel_precision_t;
+
+/**
+ * The sine and cosine of a Q16.16 angle (radians)
+ */
+external void kernel_sincos_fixed(fixed_t angle, kernel_precision_t precision, fixed_t *sin, fixed_t *cos);
+
+/**
+ * The tangent of a Q16.16 angle, returns false if it doesn't fit in a `fixed_t`
+ */
+external bool kernel_tan_fixed(fixed_t angle, kernel_precision_t precision, fixed_t *result);
+
+/**
+ * The arc tangent of a Q16.16 number
+ */
+external fixed_t kernel_atan_fixed(fixed_t value, kernel_precision_t precision);
+
+/**
+ * e^value of a Q16.16 number, returns false if it doesn't fit in a `fixed_t`
+ */
+external bool kernel_exp_fixed(fixed_t value, kernel_precision_t precision, fixed_t *result);
+
+/**
+ * The natural logarithm of a Q16.16 number, returns false if it isn't positive
+ */
+external bool kernel_ln_fixed(fixed_t value, kernel_precision_t precision, fixed_t *result);
+
+/**
+ * The square root of a Q16.16 number, returns false if it's negative
+ */
+external bool kernel_sqrt_fixed(fixed_t value, fixed_t *result);
+
+/**
+ * The `double` versions of the kernels, they follow libm for NaNs, infinities and domain
+ * errors
+ */
+external double kernel_sin(double value, kernel_precision_t precision);
+external double kernel_cos(double value, kernel_precision_t precision);
+external double kernel_tan(double value, kernel_precision_t precision);
+external double kernel_atan(double value, kernel_precision_t precision);
+external double kernel_exp(double value, kernel_precision_t precision);
+external double kernel_ln(double value, kernel_precision_t precision);
+
+#endif /** MATH_KERNEL_H */
@@ -0,0 +1,153 @@
+#include "lexer.h"
+#include <pico.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+internal force_inline bool lexer_is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+internal force_inline bool lexer_is_letter(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+internal force_inline void lexer_add_digit(token_t *token, char digit) {
+    // Past 2^53 a `double` can't hold every integer
+    if (token->mantissa >= (INT64_C(1) << 53) / 10) {
+        token->exact = false;
+    } else {
+        token->mantissa = token->mantissa * 10 + (digit - '0');
+    }
+}
+
+void lexer_init(lexer_t *lexer, const char *source, size_t length) {
+    lexer->source = source;
+    lexer->end = source + length;
+    lexer->position = source;
+}
+
+/**
+ * Read a number, `[digits][.digits][e[+-]digits]`. Its significant digits and a power of
+ * ten are rewritten as a `strtod` literal, which rounds them correctly (the source isn't
+ * terminated, and `strtod` would also read things like `0x1` that aren't numbers here).
+ *
+ * The digits are also kept as an integer and a power of ten, so the parser can tell which
+ * numbers are exact fractions (`0.1` is `1/10`, but not exactly a `double`).
+ */
+internal void lexer_read_number(lexer_t *lexer, token_t *token) {
+    const char *c = lexer->position;
+
+    // The significant digits, the power of ten they're scaled by and room for `e-NNNNN`
+    char text[LEXER_MAX_DIGITS + 8];
+    size_t count = 0;
+    int scale = 0;
+
+    token->mantissa = 0;
+    token->exponent = 0;
+    token->exact = true;
+
+    for (; c < lexer->end && lexer_is_digit(*c); c++) {
+        lexer_add_digit(token, *c);
+
+        if (count == 0 && *c == '0') {
+            continue;
+        }
+
+        if (count < LEXER_MAX_DIGITS) {
+            text[count++] = *c;
+        } else {
+            scale++;
+        }
+    }
+
+    if (c < lexer->end && *c == '.') {
+        for (c++; c < lexer->end && lexer_is_digit(*c); c++) {
+            lexer_add_digit(token, *c);
+            token->exponent--;
+
+            if (count == 0 && *c == '0') {
+                scale--;
+            } else if (count < LEXER_MAX_DIGITS) {
+                text[count++] = *c;
+                scale--;
+            }
+        }
+    }
+
+    // Only take the exponent if there are digits after it, so `2e` still is `2*e`
+    if (c < lexer->end && (*c == 'e' || *c == 'E')) {
+        const char *exponent_start = c + 1;
+        bool negative = false;
+
+        if (exponent_start < lexer->end && (*exponent_start == '+' || *exponent_start == '-')) {
+            negative = *exponent_start++ == '-';
+        }
+
+        if (exponent_start < lexer->end && lexer_is_digit(*exponent_start)) {
+            int exponent = 0;
+
+            for (c = exponent_start; c < lexer->end && lexer_is_digit(*c); c++) {
+                exponent = MIN(exponent * 10 + (*c - '0'), 400);
+            }
+
+            token->exponent += negative ? -exponent : exponent;
+            scale += negative ? -exponent : exponent;
+        }
+    }
+
+    token->type = TOKEN_NUMBER;
+    token->length = c - lexer->position;
+
+    if (count == 0) {
+        token->number = 0;
+    } else {
+        snprintf(&text[count], sizeof(text) - count, "e%d", scale);
+
+        token->number = strtod(text, NULL);
+    }
+}
+
+void lexer_next(lexer_t *lexer, token_t *token) {
+    while (lexer->position < lexer->end && (*lexer->position == ' ' || *lexer->position == '\t')) {
+        lexer->position++;
+    }
+
+    token->start = lexer->position;
+    token->length = 1;
+
+    if (lexer->position >= lexer->end || *lexer->position == '\0') {
+        token->type = TOKEN_END;
+        token->length = 0;
+
+        return;
+    }
+
+    char c = *lexer->position;
+
+    if (lexer_is_digit(c) || (c == '.' && lexer->position + 1 < lexer->end && lexer_is_digit(lexer->position[1]))) {
+        lexer_read_number(lexer, token);
+    } else if (lexer_is_letter(c)) {
+        const char *end = lexer->position;
+
+        // Digits are not part of names, so `x2` is `x*2`
+        while (end < lexer->end && lexer_is_letter(*end)) {
+            end++;
+        }
+
+        token->type = TOKEN_IDENTIFIER;
+        token->length = end - lexer->position;
+    } else {
+        switch (c) {
+        case '+': token->type = TOKEN_PLUS; break;
+        case '-': token->type = TOKEN_MINUS; break;
+        case '*': token->type = TOKEN_STAR; break;
+        case '/': token->type = TOKEN_SLASH; break;
+        case '^': token->type = TOKEN_CARET; break;
+        case '(': token->type = TOKEN_LEFT_PARENTHESIS; break;
+        case ')': token->type = TOKEN_RIGHT_PARENTHESIS; break;
+        default:  token->type = TOKEN_INVALID; break;
+        }
+    }
+
+    lexer->position += token->length;
+}
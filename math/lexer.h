@@ -0,0 +1,82 @@
+#ifndef MATH_LEXER_H
+#define MATH_LEXER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <util/util.h>
+#include <util/types.h>
+
+/**
+ * The most significant digits of a number that are kept, the next ones can only change how
+ * a halfway case is rounded (a `double` needs 17 to be told apart)
+ */
+#define LEXER_MAX_DIGITS    40
+
+/**
+ * The kind of a token
+ */
+typedef enum token_type_t: byte
+{
+    TOKEN_END               = 0x00,
+    TOKEN_NUMBER            = 0x01,
+    TOKEN_IDENTIFIER        = 0x02,
+    TOKEN_PLUS              = 0x03,
+    TOKEN_MINUS             = 0x04,
+    TOKEN_STAR              = 0x05,
+    TOKEN_SLASH             = 0x06,
+    TOKEN_CARET             = 0x07,
+    TOKEN_LEFT_PARENTHESIS  = 0x08,
+    TOKEN_RIGHT_PARENTHESIS = 0x09,
+
+    /** A character that can't start any token */
+    TOKEN_INVALID           = 0xFF
+} token_type_t;
+
+/**
+ * A token, it points inside the source, so nothing is copied
+ */
+typedef struct token_t
+{
+    token_type_t    type;
+
+    /**
+     * Where the token is in the source
+     */
+    const char      *start;
+    size_t          length;
+
+    /**
+     * The value of a `TOKEN_NUMBER`
+     */
+    double          number;
+
+    /**
+     * The value of a `TOKEN_NUMBER` is also exactly `mantissa * 10^exponent`, if `exact`
+     */
+    int64_t         mantissa;
+    int16_t         exponent;
+    bool            exact;
+} token_t;
+
+/**
+ * Splits an expression into tokens, one at a time
+ */
+typedef struct lexer_t
+{
+    const char      *source;
+    const char      *end;
+    const char      *position;
+} lexer_t;
+
+/**
+ * Start tokenizing an expression, the source doesn't need to end with a NUL
+ */
+external void lexer_init(lexer_t *lexer, const char *source, size_t length);
+
+/**
+ * Read the next token, after the end of the source this always returns `TOKEN_END`
+ */
+external void lexer_next(lexer_t *lexer, token_t *token);
+
+#endif /** MATH_LEXER_H */
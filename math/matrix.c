@@ -0,0 +1,608 @@
+#include "matrix.h"
+#include <hal/display.h>
+#include <math.h>
+#include <pico/sem.h>
+#include <string.h>
+
+/**
+ * An element of any kind, for the kernels that work on every kind
+ */
+typedef union matrix_value_t
+{
+    double      value;
+    fixed_t     fixed;
+    rational_t  rational;
+} matrix_value_t;
+
+/******************** ELEMENTS *************************/
+
+internal force_inline size_t matrix_element_size(matrix_element_t element) {
+    switch (element) {
+    case MATRIX_ELEMENT_FIXED:      return sizeof(fixed_t);
+    case MATRIX_ELEMENT_RATIONAL:   return sizeof(rational_t);
+    default:                        return sizeof(double);
+    }
+}
+
+internal force_inline matrix_value_t matrix_get(const matrix_t *matrix, uint8_t row, uint8_t column) {
+    switch (matrix->element) {
+    case MATRIX_ELEMENT_FIXED:      return (matrix_value_t) { .fixed = MATRIX_AT(matrix, fixed, row, column) };
+    case MATRIX_ELEMENT_RATIONAL:   return (matrix_value_t) { .rational = MATRIX_AT(matrix, rational, row, column) };
+    default:                        return (matrix_value_t) { .value = MATRIX_AT(matrix, values, row, column) };
+    }
+}
+
+internal force_inline void matrix_put(matrix_t *matrix, uint8_t row, uint8_t column, matrix_value_t value) {
+    switch (matrix->element) {
+    case MATRIX_ELEMENT_FIXED:      MATRIX_AT(matrix, fixed, row, column) = value.fixed; break;
+    case MATRIX_ELEMENT_RATIONAL:   MATRIX_AT(matrix, rational, row, column) = value.rational; break;
+    default:                        MATRIX_AT(matrix, values, row, column) = value.value; break;
+    }
+}
+
+internal matrix_value_t matrix_value_integer(matrix_element_t element, int32_t integer) {
+    switch (element) {
+    case MATRIX_ELEMENT_FIXED:      return (matrix_value_t) { .fixed = FIXED(integer) };
+    case MATRIX_ELEMENT_RATIONAL:   return (matrix_value_t) { .rational = rational_from_integer(integer) };
+    default:                        return (matrix_value_t) { .value = integer };
+    }
+}
+
+internal force_inline bool matrix_value_is_zero(matrix_element_t element, matrix_value_t value) {
+    switch (element) {
+    case MATRIX_ELEMENT_FIXED:      return value.fixed == 0;
+    case MATRIX_ELEMENT_RATIONAL:   return value.rational.numerator == 0;
+    default:                        return value.value == 0;
+    }
+}
+
+/**
+ * How big an element is, to choose the pivots
+ */
+internal double matrix_value_magnitude(matrix_element_t element, matrix_value_t value) {
+    switch (element) {
+    case MATRIX_ELEMENT_FIXED:      return fabs(fixed_to_double(value.fixed));
+    case MATRIX_ELEMENT_RATIONAL:   return fabs(rational_to_double(value.rational));
+    default:                        return fabs(value.value);
+    }
+}
+
+/**
+ * `accumulator - left * right`, the step of the elimination and the substitutions
+ *
+ * RETURN VALUE
+ * - false if it doesn't fit
+ */
+internal bool matrix_value_subtract_product(
+    matrix_element_t element,
+    matrix_value_t accumulator,
+    matrix_value_t left,
+    matrix_value_t right,
+    matrix_value_t *result
+) {
+    switch (element) {
+    case MATRIX_ELEMENT_FIXED: {
+        fixed_t product;
+
+        return fixed_multiply(left.fixed, right.fixed, &product)
+            && fixed_subtract(accumulator.fixed, product, &result->fixed);
+    }
+
+    case MATRIX_ELEMENT_RATIONAL: {
+        rational_t product;
+
+        return rational_multiply(left.rational, right.rational, &product)
+            && rational_subtract(accumulator.rational, product, &result->rational);
+    }
+
+    default:
+        result->value = accumulator.value - left.value * right.value;
+
+        return isfinite(result->value);
+    }
+}
+
+/**
+ * `accumulator + left * right`, for the products
+ */
+internal bool matrix_value_add_product(
+    matrix_element_t element,
+    matrix_value_t accumulator,
+    matrix_value_t left,
+    matrix_value_t right,
+    matrix_value_t *result
+) {
+    switch (element) {
+    case MATRIX_ELEMENT_FIXED: {
+        fixed_t product;
+
+        return fixed_multiply(left.fixed, right.fixed, &product)
+            && fixed_add(accumulator.fixed, product, &result->fixed);
+    }
+
+    case MATRIX_ELEMENT_RATIONAL: {
+        rational_t product;
+
+        return rational_multiply(left.rational, right.rational, &product)
+            && rational_add(accumulator.rational, product, &result->rational);
+    }
+
+    default:
+        result->value = accumulator.value + left.value * right.value;
+
+        return isfinite(result->value);
+    }
+}
+
+internal bool matrix_value_multiply(matrix_element_t element, matrix_value_t left, matrix_value_t right, matrix_value_t *result) {
+    switch (element) {
+    case MATRIX_ELEMENT_FIXED:      return fixed_multiply(left.fixed, right.fixed, &result->fixed);
+    case MATRIX_ELEMENT_RATIONAL:   return rational_multiply(left.rational, right.rational, &result->rational);
+    default:
+        result->value = left.value * right.value;
+
+        return isfinite(result->value);
+    }
+}
+
+internal bool matrix_value_divide(matrix_element_t element, matrix_value_t left, matrix_value_t right, matrix_value_t *result) {
+    switch (element) {
+    case MATRIX_ELEMENT_FIXED:      return fixed_divide(left.fixed, right.fixed, &result->fixed);
+    case MATRIX_ELEMENT_RATIONAL:   return rational_divide(left.rational, right.rational, &result->rational);
+    default:
+        result->value = left.value / right.value;
+
+        return isfinite(result->value);
+    }
+}
+
+/******************** TASKS *************************/
+
+typedef struct matrix_task_t matrix_task_t;
+
+/**
+ * Do the part `[first, last)` of a task (rows or columns, depending on the kernel)
+ */
+typedef error_t (*matrix_kernel_t)(const matrix_task_t *task, uint8_t first, uint8_t last);
+
+struct matrix_task_t
+{
+    matrix_kernel_t     kernel;
+
+    const matrix_t      *left;
+    const matrix_t      *right;
+    matrix_t            *result;
+
+    const uint8_t       *pivots;
+
+    /** The column of the LU decomposition being eliminated */
+    uint8_t             step;
+
+    /** The part of core 1, and how it went */
+    uint8_t             first;
+    uint8_t             last;
+    error_t             error;
+};
+
+internal void matrix_task_core_1(void *data) {
+    matrix_task_t *task = data;
+
+    task->error = task->kernel(task, task->first, task->last);
+}
+
+/**
+ * Run a task over `[first, last)`, the second half on core 1 when it's big enough
+ */
+internal error_t matrix_run(matrix_task_t *task, uint8_t first, uint8_t last) {
+    if (last - first < MATRIX_PARALLEL_SIZE) {
+        return task->kernel(task, first, last);
+    }
+
+    semaphore_t done;
+    uint8_t split = first + (last - first) / 2;
+
+    sem_init(&done, 0, 1);
+
+    task->first = split;
+    task->last = last;
+
+    display_submit(&(display_job_t) {
+        .type               = DISPLAY_JOB_CALL,
+        .call               = { matrix_task_core_1, task },
+        .completion_signal  = &done
+    });
+
+    error_t error = task->kernel(task, first, split);
+
+    sem_acquire_blocking(&done);
+
+    return error != 0x00 ? error : task->error;
+}
+
+/******************** KERNELS *************************/
+
+/**
+ * The rows of a product, each row of the result is the sum of the rows of `right` scaled by
+ * the row of `left`, so both are read in order
+ */
+internal error_t matrix_multiply_rows(const matrix_task_t *task, uint8_t first, uint8_t last) {
+    const matrix_t *left = task->left;
+    const matrix_t *right = task->right;
+    matrix_t *result = task->result;
+
+    if (result->element == MATRIX_ELEMENT_DOUBLE) {
+        for (uint8_t row = first; row < last; row++) {
+            double *output = &MATRIX_AT(result, values, row, 0);
+
+            memset(output, 0, result->columns * sizeof(double));
+
+            for (uint8_t inner = 0; inner < left->columns; inner++) {
+                double scale = MATRIX_AT(left, values, row, inner);
+                const double *input = &MATRIX_AT(right, values, inner, 0);
+
+                if (scale == 0) {
+                    continue;
+                }
+
+                for (uint8_t column = 0; column < result->columns; column++) {
+                    output[column] += scale * input[column];
+                }
+            }
+        }
+
+        return 0x00;
+    }
+
+    matrix_value_t zero = matrix_value_integer(result->element, 0);
+
+    for (uint8_t row = first; row < last; row++) {
+        for (uint8_t column = 0; column < result->columns; column++) {
+            matrix_put(result, row, column, zero);
+        }
+
+        for (uint8_t inner = 0; inner < left->columns; inner++) {
+            matrix_value_t scale = matrix_get(left, row, inner);
+
+            if (matrix_value_is_zero(left->element, scale)) {
+                continue;
+            }
+
+            for (uint8_t column = 0; column < result->columns; column++) {
+                matrix_value_t sum;
+
+                if (!matrix_value_add_product(
+                    result->element,
+                    matrix_get(result, row, column),
+                    scale,
+                    matrix_get(right, inner, column),
+                    &sum
+                )) {
+                    return -ENUMBERRANGE;
+                }
+
+                matrix_put(result, row, column, sum);
+            }
+        }
+    }
+
+    return 0x00;
+}
+
+/**
+ * Eliminate the column `step` from the rows `[first, last)` below it
+ */
+internal error_t matrix_eliminate_rows(const matrix_task_t *task, uint8_t first, uint8_t last) {
+    matrix_t *lu = task->result;
+    matrix_element_t element = lu->element;
+    uint8_t step = task->step;
+    matrix_value_t pivot = matrix_get(lu, step, step);
+
+    for (uint8_t row = first; row < last; row++) {
+        matrix_value_t factor;
+
+        if (!matrix_value_divide(element, matrix_get(lu, row, step), pivot, &factor)) {
+            return -ENUMBERRANGE;
+        }
+
+        matrix_put(lu, row, step, factor);
+
+        if (matrix_value_is_zero(element, factor)) {
+            continue;
+        }
+
+        for (uint8_t column = step + 1; column < lu->columns; column++) {
+            matrix_value_t value;
+
+            if (!matrix_value_subtract_product(
+                element,
+                matrix_get(lu, row, column),
+                factor,
+                matrix_get(lu, step, column),
+                &value
+            )) {
+                return -ENUMBERRANGE;
+            }
+
+            matrix_put(lu, row, column, value);
+        }
+    }
+
+    return 0x00;
+}
+
+/**
+ * Solve the columns `[first, last)` of `x`, which starts as a copy of `b`
+ */
+internal error_t matrix_solve_columns(const matrix_task_t *task, uint8_t first, uint8_t last) {
+    const matrix_t *lu = task->left;
+    matrix_t *x = task->result;
+    matrix_element_t element = lu->element;
+    uint8_t size = lu->rows;
+
+    for (uint8_t column = first; column < last; column++) {
+        // The rows in the order of the decomposition
+        for (uint8_t row = 0; row < size; row++) {
+            uint8_t other = task->pivots[row];
+
+            if (other != row) {
+                matrix_value_t value = matrix_get(x, row, column);
+
+                matrix_put(x, row, column, matrix_get(x, other, column));
+                matrix_put(x, other, column, value);
+            }
+        }
+
+        // L has ones on its diagonal
+        for (uint8_t row = 1; row < size; row++) {
+            matrix_value_t value = matrix_get(x, row, column);
+
+            for (uint8_t inner = 0; inner < row; inner++) {
+                if (!matrix_value_subtract_product(element, value, matrix_get(lu, row, inner), matrix_get(x, inner, column), &value)) {
+                    return -ENUMBERRANGE;
+                }
+            }
+
+            matrix_put(x, row, column, value);
+        }
+
+        for (int16_t row = size - 1; row >= 0; row--) {
+            matrix_value_t value = matrix_get(x, row, column);
+
+            for (uint8_t inner = row + 1; inner < size; inner++) {
+                if (!matrix_value_subtract_product(element, value, matrix_get(lu, row, inner), matrix_get(x, inner, column), &value)) {
+                    return -ENUMBERRANGE;
+                }
+            }
+
+            if (!matrix_value_divide(element, value, matrix_get(lu, row, row), &value)) {
+                return -ENUMBERRANGE;
+            }
+
+            matrix_put(x, row, column, value);
+        }
+    }
+
+    return 0x00;
+}
+
+/******************** API *************************/
+
+error_t matrix_new(arena_t *arena, matrix_element_t element, uint8_t rows, uint8_t columns, matrix_t *result) {
+    if (rows == 0 || columns == 0 || rows > MATRIX_MAX_SIZE || columns > MATRIX_MAX_SIZE) {
+        return -ETOOCOMPLEX;
+    }
+
+    result->rows = rows;
+    result->columns = columns;
+    result->element = element;
+    result->values = arena_alloc(arena, rows * columns * matrix_element_size(element));
+
+    if (result->values == NULL) {
+        return -EOUTOFMEMORY;
+    }
+
+    matrix_value_t zero = matrix_value_integer(element, 0);
+
+    for (uint8_t row = 0; row < rows; row++) {
+        for (uint8_t column = 0; column < columns; column++) {
+            matrix_put(result, row, column, zero);
+        }
+    }
+
+    return 0x00;
+}
+
+void matrix_set_identity(matrix_t *matrix) {
+    for (uint8_t row = 0; row < matrix->rows; row++) {
+        for (uint8_t column = 0; column < matrix->columns; column++) {
+            matrix_put(matrix, row, column, matrix_value_integer(matrix->element, row == column));
+        }
+    }
+}
+
+error_t matrix_multiply(const matrix_t *left, const matrix_t *right, matrix_t *result) {
+    if (left->columns != right->rows || result->rows != left->rows || result->columns != right->columns ||
+        left->element != right->element || left->element != result->element || result == left || result == right) {
+        return -EMATRIXSHAPE;
+    }
+
+    matrix_task_t task = {
+        .kernel = matrix_multiply_rows,
+        .left   = left,
+        .right  = right,
+        .result = result
+    };
+
+    return matrix_run(&task, 0, result->rows);
+}
+
+error_t matrix_lu(const matrix_t *matrix, matrix_t *lu, uint8_t *pivots, int8_t *sign) {
+    if (matrix->rows != matrix->columns || lu->rows != matrix->rows || lu->columns != matrix->columns ||
+        lu->element != matrix->element) {
+        return -EMATRIXSHAPE;
+    }
+
+    matrix_element_t element = matrix->element;
+    uint8_t size = matrix->rows;
+
+    memcpy(lu->values, matrix->values, size * size * matrix_element_size(element));
+
+    *sign = 1;
+
+    matrix_task_t task = {
+        .kernel = matrix_eliminate_rows,
+        .result = lu
+    };
+
+    for (uint8_t step = 0; step < size; step++) {
+        // The biggest pivot keeps the doubles and the fixed points accurate, any that isn't
+        // zero would do for the rationals
+        uint8_t pivot = step;
+        double magnitude = matrix_value_magnitude(element, matrix_get(lu, step, step));
+
+        for (uint8_t row = step + 1; row < size; row++) {
+            double candidate = matrix_value_magnitude(element, matrix_get(lu, row, step));
+
+            if (candidate > magnitude) {
+                pivot = row;
+                magnitude = candidate;
+            }
+        }
+
+        if (matrix_value_is_zero(element, matrix_get(lu, pivot, step))) {
+            return -EMATRIXSINGULAR;
+        }
+
+        pivots[step] = pivot;
+
+        if (pivot != step) {
+            for (uint8_t column = 0; column < size; column++) {
+                matrix_value_t value = matrix_get(lu, step, column);
+
+                matrix_put(lu, step, column, matrix_get(lu, pivot, column));
+                matrix_put(lu, pivot, column, value);
+            }
+
+            *sign = -*sign;
+        }
+
+        task.step = step;
+
+        error_t error = matrix_run(&task, step + 1, size);
+
+        if (error != 0x00) {
+            return error;
+        }
+    }
+
+    return 0x00;
+}
+
+error_t matrix_lu_solve(const matrix_t *lu, const uint8_t *pivots, const matrix_t *b, matrix_t *x) {
+    if (b->rows != lu->rows || x->rows != b->rows || x->columns != b->columns ||
+        b->element != lu->element || x->element != lu->element) {
+        return -EMATRIXSHAPE;
+    }
+
+    if (x != b) {
+        memcpy(x->values, b->values, b->rows * b->columns * matrix_element_size(b->element));
+    }
+
+    matrix_task_t task = {
+        .kernel = matrix_solve_columns,
+        .left   = lu,
+        .result = x,
+        .pivots = pivots
+    };
+
+    return matrix_run(&task, 0, x->columns);
+}
+
+/**
+ * Decompose a matrix in the arena, the caller rewinds it
+ */
+internal error_t matrix_decompose(arena_t *arena, const matrix_t *matrix, matrix_t *lu, uint8_t **pivots, int8_t *sign) {
+    error_t error = matrix_new(arena, matrix->element, matrix->rows, matrix->columns, lu);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    *pivots = arena_new(arena, uint8_t, matrix->rows);
+
+    if (*pivots == NULL) {
+        return -EOUTOFMEMORY;
+    }
+
+    return matrix_lu(matrix, lu, *pivots, sign);
+}
+
+error_t matrix_solve(arena_t *arena, const matrix_t *matrix, const matrix_t *b, matrix_t *x) {
+    arena_mark_t mark = arena_mark(arena);
+    matrix_t lu;
+    uint8_t *pivots;
+    int8_t sign;
+
+    error_t error = matrix_decompose(arena, matrix, &lu, &pivots, &sign);
+
+    if (error == 0x00) {
+        error = matrix_lu_solve(&lu, pivots, b, x);
+    }
+
+    arena_rewind(arena, mark);
+
+    return error;
+}
+
+error_t matrix_determinant(arena_t *arena, const matrix_t *matrix, void *result) {
+    arena_mark_t mark = arena_mark(arena);
+    matrix_element_t element = matrix->element;
+    matrix_t lu;
+    uint8_t *pivots;
+    int8_t sign;
+
+    error_t error = matrix_decompose(arena, matrix, &lu, &pivots, &sign);
+    matrix_value_t determinant = matrix_value_integer(element, 0);
+
+    if (error == 0x00) {
+        determinant = matrix_value_integer(element, sign);
+
+        for (uint8_t index = 0; index < matrix->rows && error == 0x00; index++) {
+            if (!matrix_value_multiply(element, determinant, matrix_get(&lu, index, index), &determinant)) {
+                error = -ENUMBERRANGE;
+            }
+        }
+    } else if (error == -EMATRIXSINGULAR) {
+        error = 0x00;
+    }
+
+    if (error == 0x00) {
+        memcpy(result, &determinant, matrix_element_size(element));
+    }
+
+    arena_rewind(arena, mark);
+
+    return error;
+}
+
+error_t matrix_inverse(arena_t *arena, const matrix_t *matrix, matrix_t *result) {
+    if (result->rows != matrix->rows || result->columns != matrix->columns || result->element != matrix->element) {
+        return -EMATRIXSHAPE;
+    }
+
+    // The identity is solved out of the arena, `result` can be `matrix`: it's only written
+    // once the decomposition has its copy
+    arena_mark_t mark = arena_mark(arena);
+    matrix_t identity;
+    error_t error = matrix_new(arena, matrix->element, matrix->rows, matrix->columns, &identity);
+
+    if (error == 0x00) {
+        matrix_set_identity(&identity);
+
+        error = matrix_solve(arena, matrix, &identity, result);
+    }
+
+    arena_rewind(arena, mark);
+
+    return error;
+}
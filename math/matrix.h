@@ -0,0 +1,172 @@
+#ifndef MATH_MATRIX_H
+#define MATH_MATRIX_H
+
+#include <math/expr.h>
+#include <math/number.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <util/arena.h>
+#include <util/util.h>
+#include <util/types.h>
+#include <errno.h>
+
+/**
+ * Matrices of any of the kinds of numbers of the evaluator (see math/number.h), for the
+ * matrix operations of the calculator: multiply, LU decomposition and solve, determinant
+ * and inverse.
+ *
+ * The elements are a single row-major block allocated in an arena, with no row pointers,
+ * so a row is contiguous and the kernels walk the memory in order (the right operand of a
+ * product is read row by row too, the loops are ordered for it).
+ *
+ * The work of the bigger matrices is split between both cores: core 1 takes half of the
+ * rows (or of the columns of a solve) as a display job, so only call these from core 0.
+ * Doubles are cheap enough that a 10x10 solve takes well under a frame on one core, the
+ * split pays off from `MATRIX_PARALLEL_SIZE` rows.
+ *
+ * Nothing is drawn during a call: a job is one pass of a kernel (a product, a column of an
+ * LU decomposition, or the substitutions of a solve) and core 0 waits for it before going
+ * on. The longest is half of a `MATRIX_MAX_SIZE` product, 16 x 32 x 32 multiply-adds, so a
+ * frame is late by at most the time of the call (the app only makes them on a command).
+ */
+
+/**
+ * The biggest matrix, in rows and columns
+ */
+#define MATRIX_MAX_SIZE         32
+
+/**
+ * From how many rows (or columns to solve) the work is split between both cores
+ */
+#define MATRIX_PARALLEL_SIZE    12
+
+typedef enum matrix_error_t
+{
+    /** The sizes of the operands don't match, or a square matrix was needed */
+    EMATRIXSHAPE        = 0x30,
+
+    /** The matrix has no inverse */
+    EMATRIXSINGULAR     = 0x31
+} matrix_error_t;
+
+typedef enum matrix_element_t: byte
+{
+    MATRIX_ELEMENT_DOUBLE   = 0x00,
+
+    /** Q16.16, a division of the LU decomposition can overflow (ENUMBERRANGE) */
+    MATRIX_ELEMENT_FIXED    = 0x01,
+
+    /** Exact, a fraction that doesn't fit fails with ENUMBERRANGE */
+    MATRIX_ELEMENT_RATIONAL = 0x02
+} matrix_element_t;
+
+typedef struct matrix_t
+{
+    uint8_t             rows;
+    uint8_t             columns;
+    matrix_element_t    element;
+
+    /** `rows * columns` elements, row after row */
+    union {
+        double          *values;
+        fixed_t         *fixed;
+        rational_t      *rational;
+    };
+} matrix_t;
+
+/**
+ * The element of a matrix at a row and a column, `field` is the member of its kind
+ * (`values`, `fixed` or `rational`)
+ */
+#define MATRIX_AT(matrix, field, row, column) ((matrix)->field[(row) * (matrix)->columns + (column)])
+
+/**
+ * Allocate a matrix of zeros in an arena
+ *
+ * RETURN VALUE
+ * - ETOOCOMPLEX: if it's bigger than `MATRIX_MAX_SIZE`, or empty
+ * - EOUTOFMEMORY: if the arena is full
+ */
+external error_t matrix_new(
+    arena_t *arena,
+    matrix_element_t element,
+    uint8_t rows,
+    uint8_t columns,
+    matrix_t *result
+);
+
+/**
+ * Make a square matrix the identity
+ */
+external void matrix_set_identity(matrix_t *matrix);
+
+/**
+ * Multiply two matrices of the same kind, into a third one that's already allocated
+ *
+ * RETURN VALUE
+ * - EMATRIXSHAPE: if the columns of `left` aren't the rows of `right`, `result` isn't
+ *   their size, or it's one of them
+ * - ENUMBERRANGE: if an element doesn't fit
+ */
+external error_t matrix_multiply(const matrix_t *left, const matrix_t *right, matrix_t *result);
+
+/**
+ * Decompose a square matrix into `P * matrix = L * U`, with partial pivoting
+ *
+ * PARAMETERS
+ * - matrix: the matrix, it's left as it is
+ * - lu: where L (below the diagonal, its diagonal is ones) and U are written, the size of
+ *   `matrix`
+ * - pivots: the row each row was swapped with, `matrix->rows` of them
+ * - sign: where the sign of the permutation is written (for the determinant)
+ *
+ * RETURN VALUE
+ * - EMATRIXSHAPE: if the matrix isn't square, or `lu` isn't its size
+ * - EMATRIXSINGULAR: if the matrix has no inverse
+ * - ENUMBERRANGE: if an element doesn't fit
+ */
+external error_t matrix_lu(const matrix_t *matrix, matrix_t *lu, uint8_t *pivots, int8_t *sign);
+
+/**
+ * Solve `matrix * x = b` with the decomposition of `matrix_lu`, for every column of `b`
+ *
+ * PARAMETERS
+ * - x: where the solutions are written, the size of `b` (can be `b` itself)
+ *
+ * RETURN VALUE
+ * - EMATRIXSHAPE: if `b` doesn't have the rows of `lu`, or `x` isn't its size
+ * - ENUMBERRANGE: if an element doesn't fit
+ */
+external error_t matrix_lu_solve(const matrix_t *lu, const uint8_t *pivots, const matrix_t *b, matrix_t *x);
+
+/**
+ * Solve `matrix * x = b`, the decomposition is made in the arena and freed before returning
+ *
+ * RETURN VALUE
+ * - the errors of `matrix_lu` and `matrix_lu_solve`, and EOUTOFMEMORY
+ */
+external error_t matrix_solve(arena_t *arena, const matrix_t *matrix, const matrix_t *b, matrix_t *x);
+
+/**
+ * The determinant of a square matrix
+ *
+ * PARAMETERS
+ * - result: an element of the kind of the matrix (`double`, `fixed_t` or `rational_t`)
+ *
+ * RETURN VALUE
+ * - the errors of `matrix_lu` (a singular matrix has a determinant of zero, not an error),
+ *   and EOUTOFMEMORY
+ */
+external error_t matrix_determinant(arena_t *arena, const matrix_t *matrix, void *result);
+
+/**
+ * The inverse of a square matrix, into a matrix of its size and kind (can be `matrix`
+ * itself), the identity it's solved for is made in the arena
+ *
+ * RETURN VALUE
+ * - EMATRIXSHAPE: if `result` isn't the size or the kind of `matrix`
+ * - the errors of `matrix_solve`
+ */
+external error_t matrix_inverse(arena_t *arena, const matrix_t *matrix, matrix_t *result);
+
+#endif /** MATH_MATRIX_H */
@@ -0,0 +1,267 @@
+#include "memo.h"
+#include <math.h>
+#include <math/vm.h>
+#include <string.h>
+#include <util/log.h>
+
+#ifndef MEMO_LOG_LEVEL
+#   define MEMO_LOG_LEVEL LOG_LEVEL
+#endif
+
+#define MEMO_LOG(...) LOG_AT(MEMO_LOG_LEVEL, LOG_LEVEL_INFO, "memo", __VA_ARGS__)
+
+/******************** LRU *************************/
+
+internal force_inline uint8_t *memo_bucket(memo_t *memo, uint64_t key) {
+    return &memo->buckets[(key ^ (key >> 32)) & (MEMO_BUCKETS - 1)];
+}
+
+internal void memo_unlink(memo_t *memo, uint8_t index) {
+    memo_entry_t *entry = &memo->entries[index];
+
+    if (entry->newer != MEMO_NONE) memo->entries[entry->newer].older = entry->older;
+    else                           memo->newest = entry->older;
+
+    if (entry->older != MEMO_NONE) memo->entries[entry->older].newer = entry->newer;
+    else                           memo->oldest = entry->newer;
+}
+
+internal void memo_link_newest(memo_t *memo, uint8_t index) {
+    memo_entry_t *entry = &memo->entries[index];
+
+    entry->newer = MEMO_NONE;
+    entry->older = memo->newest;
+
+    if (memo->newest != MEMO_NONE) memo->entries[memo->newest].newer = index;
+    else                           memo->oldest = index;
+
+    memo->newest = index;
+}
+
+void memo_init(memo_t *memo) {
+    memo->hits = 0;
+    memo->misses = 0;
+
+    memo_clear(memo);
+}
+
+void memo_clear(memo_t *memo) {
+    memset(memo->buckets, MEMO_NONE, sizeof(memo->buckets));
+
+    memo->count = 0;
+    memo->newest = MEMO_NONE;
+    memo->oldest = MEMO_NONE;
+}
+
+bool memo_lookup(memo_t *memo, uint64_t key, double *value) {
+    for (uint8_t index = *memo_bucket(memo, key); index != MEMO_NONE; index = memo->entries[index].next) {
+        if (memo->entries[index].key == key) {
+            memo_unlink(memo, index);
+            memo_link_newest(memo, index);
+
+            *value = memo->entries[index].value;
+            memo->hits++;
+
+            return true;
+        }
+    }
+
+    memo->misses++;
+
+    return false;
+}
+
+void memo_store(memo_t *memo, uint64_t key, double value) {
+    uint8_t index;
+
+    if (memo->count < MEMO_SIZE) {
+        index = memo->count++;
+    } else {
+        // Take the least recently used entry out of its bucket
+        index = memo->oldest;
+
+        uint8_t *link = memo_bucket(memo, memo->entries[index].key);
+
+        while (*link != index) {
+            link = &memo->entries[*link].next;
+        }
+
+        *link = memo->entries[index].next;
+
+        memo_unlink(memo, index);
+    }
+
+    uint8_t *bucket = memo_bucket(memo, key);
+
+    memo->entries[index].key = key;
+    memo->entries[index].value = value;
+    memo->entries[index].next = *bucket;
+
+    *bucket = index;
+
+    memo_link_newest(memo, index);
+}
+
+void memo_report(const memo_t *memo) {
+    MEMO_LOG(
+        "%u/%u results, %lu hits, %lu misses",
+        (unsigned) memo->count,
+        (unsigned) MEMO_SIZE,
+        (unsigned long) memo->hits,
+        (unsigned long) memo->misses
+    );
+}
+
+/******************** EVALUATION *************************/
+
+internal force_inline uint64_t memo_mix(uint64_t hash, uint64_t value) {
+    return hash ^ (value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2));
+}
+
+/**
+ * Hash every subexpression, and chain the cached ones by where they start, the biggest first
+ */
+internal void memo_prepare(const expr_t *expr, const uint32_t *versions, memo_t *memo) {
+    uint64_t hashes[EXPR_MAX_STACK];
+    uint8_t starts[EXPR_MAX_STACK];
+    bool costly[EXPR_MAX_STACK];
+    uint8_t depth = 0;
+
+    memset(memo->biggest, MEMO_NONE, expr->code_size);
+    memset(memo->cached, false, expr->code_size);
+
+    for (uint8_t offset = 0; offset < expr->code_size;) {
+        expr_op_t op = expr->code[offset];
+        uint8_t operand = op == EXPR_OP_RETURN ? 0 : expr->code[offset + 1];
+        uint64_t hash = memo_mix(0, op);
+        uint8_t start = offset;
+        bool cost = false;
+
+        switch (op) {
+        case EXPR_OP_CONSTANT: {
+            uint64_t bits;
+
+            memcpy(&bits, &expr->constants[operand], sizeof(bits));
+
+            hashes[depth] = memo_mix(hash, bits);
+            starts[depth] = start;
+            costly[depth++] = false;
+            offset += 2;
+
+            continue;
+        }
+
+        case EXPR_OP_VARIABLE:
+            hashes[depth] = memo_mix(memo_mix(hash, operand), versions != NULL ? versions[operand] : 0);
+            starts[depth] = start;
+            costly[depth++] = false;
+            offset += 2;
+
+            continue;
+
+        case EXPR_OP_RETURN:
+            return;
+
+        case EXPR_OP_NEGATE:
+        case EXPR_OP_CALL:
+            depth--;
+            hash = memo_mix(hash, op == EXPR_OP_CALL ? operand : 0);
+            hash = memo_mix(hash, hashes[depth]);
+            start = starts[depth];
+            cost = costly[depth] || op == EXPR_OP_CALL;
+            break;
+
+        default:
+            depth -= 2;
+            hash = memo_mix(memo_mix(hash, hashes[depth]), hashes[depth + 1]);
+            start = starts[depth];
+            cost = costly[depth] || costly[depth + 1] || op == EXPR_OP_POWER;
+            break;
+        }
+
+        // The subexpressions starting at the same place end in increasing order
+        if (cost) {
+            memo->hashes[offset] = hash;
+            memo->cached[offset] = true;
+            memo->smaller[offset] = memo->biggest[start];
+            memo->biggest[start] = offset;
+        }
+
+        hashes[depth] = hash;
+        starts[depth] = start;
+        costly[depth++] = cost;
+
+        offset += op == EXPR_OP_CALL ? 2 : 1;
+    }
+}
+
+error_t expr_evaluate_memo(
+    const expr_t *expr,
+    const double *variables,
+    const uint32_t *versions,
+    memo_t *memo,
+    double *result
+) {
+    double stack[EXPR_MAX_STACK];
+    uint8_t depth = 0;
+
+    memo_prepare(expr, versions, memo);
+
+    for (uint8_t offset = 0;;) {
+        // Skip the biggest subexpression starting here that was already computed
+        bool found = false;
+
+        for (uint8_t last = memo->biggest[offset]; last != MEMO_NONE && !found; last = memo->smaller[last]) {
+            if (memo_lookup(memo, memo->hashes[last], &stack[depth])) {
+                depth++;
+                offset = last + (expr->code[last] == EXPR_OP_CALL ? 2 : 1);
+                found = true;
+            }
+        }
+
+        if (found) {
+            continue;
+        }
+
+        expr_op_t op = expr->code[offset];
+        uint8_t operand = op == EXPR_OP_RETURN ? 0 : expr->code[offset + 1];
+
+        switch (op) {
+        case EXPR_OP_CONSTANT:
+            stack[depth++] = expr->constants[operand];
+            offset += 2;
+
+            continue;
+
+        case EXPR_OP_VARIABLE:
+            stack[depth++] = variables[operand];
+            offset += 2;
+
+            continue;
+
+        case EXPR_OP_NEGATE:
+            stack[depth - 1] = -stack[depth - 1];
+            break;
+
+        case EXPR_OP_CALL:
+            stack[depth - 1] = expr_call(operand, stack[depth - 1]);
+            break;
+
+        case EXPR_OP_RETURN:
+            *result = stack[depth - 1];
+
+            return isnan(*result) ? -EDOMAIN : 0x00;
+
+        default:
+            depth--;
+            stack[depth - 1] = expr_apply(op, stack[depth - 1], stack[depth]);
+            break;
+        }
+
+        if (memo->cached[offset]) {
+            memo_store(memo, memo->hashes[offset], stack[depth - 1]);
+        }
+
+        offset += op == EXPR_OP_CALL ? 2 : 1;
+    }
+}
@@ -0,0 +1,122 @@
+#ifndef MATH_MEMO_H
+#define MATH_MEMO_H
+
+#include <math/expr.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+#include <errno.h>
+
+/**
+ * A cache of subexpression results, kept across evaluations: when the tail of a long
+ * expression is edited, the subexpressions before it compile to the same instructions, and
+ * their results are taken from here instead of calling the functions again.
+ *
+ * A subexpression is identified by a hash of its instructions, where constants are hashed by
+ * value (their slot can change when the expression is edited) and variables by slot and
+ * version, so giving a variable a new value only needs a new version. Only subexpressions
+ * with a function call or a power are cached, the rest is cheaper to compute than to look up.
+ */
+
+/**
+ * How many results are kept, the least recently used one is replaced when it's full
+ */
+#define MEMO_SIZE       64
+
+/**
+ * The buckets of the hash table, needs to be a power of two
+ */
+#define MEMO_BUCKETS    64
+
+#define MEMO_NONE       0xFF
+
+typedef struct memo_entry_t
+{
+    uint64_t    key;
+    double      value;
+
+    /** The neighbours in the recently used list, and the next entry of the bucket */
+    uint8_t     newer;
+    uint8_t     older;
+    uint8_t     next;
+} memo_entry_t;
+
+typedef struct memo_t
+{
+    memo_entry_t    entries[MEMO_SIZE];
+    uint8_t         count;
+
+    uint8_t         buckets[MEMO_BUCKETS];
+
+    /** The ends of the recently used list */
+    uint8_t         newest;
+    uint8_t         oldest;
+
+    uint32_t        hits;
+    uint32_t        misses;
+
+    /**
+     * The scratch of `expr_evaluate_memo`, by code offset: the hash of the subexpression
+     * whose last instruction is there (and if it's cached), the biggest cached subexpression
+     * starting there, and the next smaller one starting at the same place
+     */
+    uint64_t        hashes[EXPR_MAX_CODE];
+    bool            cached[EXPR_MAX_CODE];
+    uint8_t         biggest[EXPR_MAX_CODE];
+    uint8_t         smaller[EXPR_MAX_CODE];
+} memo_t;
+
+/**
+ * Initialize an empty cache
+ */
+external void memo_init(memo_t *memo);
+
+/**
+ * Forget every result, needed when they change for the same instructions (after
+ * `expr_set_precision`)
+ */
+external void memo_clear(memo_t *memo);
+
+/**
+ * Find a result, and make it the most recently used
+ *
+ * RETURN VALUE
+ * - false if it isn't cached
+ */
+external bool memo_lookup(memo_t *memo, uint64_t key, double *value);
+
+/**
+ * Add a result, replacing the least recently used one if the cache is full
+ */
+external void memo_store(memo_t *memo, uint64_t key, double value);
+
+/**
+ * Log how many lookups were found
+ */
+external void memo_report(const memo_t *memo);
+
+/**
+ * Run a compiled expression like `expr_evaluate`, taking the results of the subexpressions
+ * from a cache, and adding the ones that weren't in it
+ *
+ * PARAMETERS
+ * - expr: the program, made by `expr_compile`
+ * - variables: the values of the variables, like in `expr_evaluate`
+ * - versions: the version of each variable, changed by the caller every time the value of
+ *   the variable changes. Can be NULL if the variables never change.
+ * - memo: the cache
+ * - result: where the result is written
+ *
+ * RETURN VALUE
+ * - EDOMAIN: if the result is not a number
+ */
+external error_t expr_evaluate_memo(
+    const expr_t *expr,
+    const double *variables,
+    const uint32_t *versions,
+    memo_t *memo,
+    double *result
+);
+
+#endif /** MATH_MEMO_H */
@@ -0,0 +1,207 @@
+#include "number.h"
+
+/**
+ * Binary GCD, as the M0+ has no 64-bit divider
+ */
+internal uint64_t number_gcd(uint64_t a, uint64_t b) {
+    if (a == 0) return b;
+    if (b == 0) return a;
+
+    int shift = __builtin_ctzll(a | b);
+
+    a >>= __builtin_ctzll(a);
+
+    do {
+        b >>= __builtin_ctzll(b);
+
+        if (a > b) {
+            uint64_t swap = a;
+
+            a = b;
+            b = swap;
+        }
+
+        b -= a;
+    } while (b != 0);
+
+    return a << shift;
+}
+
+internal force_inline uint64_t number_abs(int64_t value) {
+    return value < 0 ? -(uint64_t) value : (uint64_t) value;
+}
+
+bool rational_make(int64_t numerator, int64_t denominator, rational_t *result) {
+    if (denominator == 0) {
+        return false;
+    }
+
+    // -INT64_MIN doesn't fit
+    if (denominator < 0 && (numerator == INT64_MIN || denominator == INT64_MIN)) {
+        return false;
+    }
+
+    if (denominator < 0) {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+
+    int64_t gcd = number_gcd(number_abs(numerator), denominator);
+
+    result->numerator = numerator / gcd;
+    result->denominator = denominator / gcd;
+
+    return true;
+}
+
+bool rational_add(rational_t left, rational_t right, rational_t *result) {
+    if (left.denominator == right.denominator) {
+        int64_t numerator;
+
+        if (__builtin_add_overflow(left.numerator, right.numerator, &numerator)) {
+            return false;
+        }
+
+        return rational_make(numerator, left.denominator, result);
+    }
+
+    // Only scale by what the denominators don't have in common, to overflow later
+    int64_t gcd = number_gcd(left.denominator, right.denominator);
+    int64_t left_scale = right.denominator / gcd;
+    int64_t right_scale = left.denominator / gcd;
+    int64_t a, b, numerator, denominator;
+
+    if (__builtin_mul_overflow(left.numerator, left_scale, &a) ||
+        __builtin_mul_overflow(right.numerator, right_scale, &b) ||
+        __builtin_add_overflow(a, b, &numerator) ||
+        __builtin_mul_overflow(left.denominator, left_scale, &denominator)) {
+        return false;
+    }
+
+    return rational_make(numerator, denominator, result);
+}
+
+bool rational_subtract(rational_t left, rational_t right, rational_t *result) {
+    if (right.numerator == INT64_MIN) {
+        return false;
+    }
+
+    right.numerator = -right.numerator;
+
+    return rational_add(left, right, result);
+}
+
+bool rational_multiply(rational_t left, rational_t right, rational_t *result) {
+    // Cross reduce first, so the products are as small as possible
+    int64_t a = number_gcd(number_abs(left.numerator), right.denominator);
+    int64_t b = number_gcd(number_abs(right.numerator), left.denominator);
+    int64_t numerator, denominator;
+
+    if (__builtin_mul_overflow(left.numerator / a, right.numerator / b, &numerator) ||
+        __builtin_mul_overflow(left.denominator / b, right.denominator / a, &denominator)) {
+        return false;
+    }
+
+    return rational_make(numerator, denominator, result);
+}
+
+bool rational_divide(rational_t left, rational_t right, rational_t *result) {
+    if (right.numerator == 0) {
+        return false;
+    }
+
+    rational_t inverse;
+
+    if (!rational_make(right.denominator, right.numerator, &inverse)) {
+        return false;
+    }
+
+    return rational_multiply(left, inverse, result);
+}
+
+bool rational_power(rational_t base, int64_t exponent, rational_t *result) {
+    if (exponent < 0) {
+        if (exponent == INT64_MIN || !rational_make(base.denominator, base.numerator, &base)) {
+            return false;
+        }
+
+        exponent = -exponent;
+    }
+
+    rational_t value = rational_from_integer(1);
+
+    // Square and multiply
+    while (exponent != 0) {
+        if ((exponent & 1) && !rational_multiply(value, base, &value)) {
+            return false;
+        }
+
+        exponent >>= 1;
+
+        if (exponent != 0 && !rational_multiply(base, base, &base)) {
+            return false;
+        }
+    }
+
+    *result = value;
+
+    return true;
+}
+
+rational_t rational_floor(rational_t value) {
+    int64_t quotient = value.numerator / value.denominator;
+
+    // The division truncates towards zero
+    if (value.numerator % value.denominator != 0 && value.numerator < 0) {
+        quotient--;
+    }
+
+    return rational_from_integer(quotient);
+}
+
+rational_t rational_ceil(rational_t value) {
+    int64_t quotient = value.numerator / value.denominator;
+
+    if (value.numerator % value.denominator != 0 && value.numerator > 0) {
+        quotient++;
+    }
+
+    return rational_from_integer(quotient);
+}
+
+rational_t rational_round(rational_t value) {
+    int64_t quotient = value.numerator / value.denominator;
+    uint64_t remainder = number_abs(value.numerator % value.denominator);
+
+    if (remainder * 2 >= (uint64_t) value.denominator) {
+        quotient += value.numerator < 0 ? -1 : 1;
+    }
+
+    return rational_from_integer(quotient);
+}
+
+bool fixed_power(fixed_t base, int32_t exponent, fixed_t *result) {
+    bool invert = exponent < 0;
+    uint32_t remaining = invert ? -(uint32_t) exponent : (uint32_t) exponent;
+    fixed_t value = FIXED_ONE;
+
+    while (remaining != 0) {
+        if ((remaining & 1) && !fixed_multiply(value, base, &value)) {
+            return false;
+        }
+
+        remaining >>= 1;
+
+        if (remaining != 0 && !fixed_multiply(base, base, &base)) {
+            return false;
+        }
+    }
+
+    if (invert) {
+        return fixed_divide(FIXED_ONE, value, result);
+    }
+
+    *result = value;
+
+    return true;
+}
@@ -0,0 +1,130 @@
+#ifndef MATH_NUMBER_H
+#define MATH_NUMBER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <util/util.h>
+
+/**
+ * The Cortex-M0+ has no FPU, every `double` operation is done in software, so expressions
+ * are evaluated with the cheapest kind of number that gives a good enough result:
+ *
+ * - Rationals (`rational_t`): exact, for expressions that only use `+ - * /`, integer powers
+ *   and rounding. `1/3 + 1/6` is `1/2`, not `0.5000000001`.
+ * - Fixed point (`fixed_t`): Q16.16, for expressions without transcendental functions when
+ *   the precision of a pixel is enough, like when graphing.
+ * - `double`: everything else.
+ */
+
+/**
+ * An exact fraction, always reduced and with a positive denominator
+ */
+typedef struct rational_t
+{
+    int64_t     numerator;
+    int64_t     denominator;
+} rational_t;
+
+/**
+ * A Q16.16 fixed point number
+ */
+typedef int32_t fixed_t;
+
+#define FIXED_FRACTION_BITS 16
+#define FIXED_ONE           ((fixed_t) 1 << FIXED_FRACTION_BITS)
+#define FIXED_MAX           INT32_MAX
+#define FIXED_MIN           INT32_MIN
+
+/**
+ * The fixed point value of an integer constant
+ */
+#define FIXED(integer)      ((fixed_t) ((integer) * FIXED_ONE))
+
+/**
+ * A rational for an integer
+ */
+static force_inline rational_t rational_from_integer(int64_t value) {
+    return (rational_t) { .numerator = value, .denominator = 1 };
+}
+
+static force_inline bool rational_is_integer(rational_t value) {
+    return value.denominator == 1;
+}
+
+static force_inline double rational_to_double(rational_t value) {
+    return (double) value.numerator / (double) value.denominator;
+}
+
+/**
+ * Make a reduced rational from a fraction, returns false if the denominator is zero
+ */
+external bool rational_make(int64_t numerator, int64_t denominator, rational_t *result);
+
+/**
+ * The arithmetic of rationals, each returns false if the result doesn't fit in 64 bits (or
+ * on a division by zero)
+ */
+external bool rational_add(rational_t left, rational_t right, rational_t *result);
+external bool rational_subtract(rational_t left, rational_t right, rational_t *result);
+external bool rational_multiply(rational_t left, rational_t right, rational_t *result);
+external bool rational_divide(rational_t left, rational_t right, rational_t *result);
+
+/**
+ * Raise a rational to an integer power
+ */
+external bool rational_power(rational_t base, int64_t exponent, rational_t *result);
+
+/**
+ * Round a rational to an integer: towards -infinity, +infinity, or the nearest one (halves
+ * away from zero)
+ */
+external rational_t rational_floor(rational_t value);
+external rational_t rational_ceil(rational_t value);
+external rational_t rational_round(rational_t value);
+
+static force_inline fixed_t fixed_from_double(double value) {
+    return (fixed_t) (value * FIXED_ONE);
+}
+
+static force_inline double fixed_to_double(fixed_t value) {
+    return (double) value / FIXED_ONE;
+}
+
+/**
+ * The arithmetic of fixed point numbers, each returns false if the result doesn't fit (or on
+ * a division by zero)
+ */
+static force_inline bool fixed_add(fixed_t left, fixed_t right, fixed_t *result) {
+    return !__builtin_add_overflow(left, right, result);
+}
+
+static force_inline bool fixed_subtract(fixed_t left, fixed_t right, fixed_t *result) {
+    return !__builtin_sub_overflow(left, right, result);
+}
+
+static force_inline bool fixed_multiply(fixed_t left, fixed_t right, fixed_t *result) {
+    int64_t product = ((int64_t) left * right) >> FIXED_FRACTION_BITS;
+
+    *result = (fixed_t) product;
+
+    return product >= FIXED_MIN && product <= FIXED_MAX;
+}
+
+static force_inline bool fixed_divide(fixed_t left, fixed_t right, fixed_t *result) {
+    if (right == 0) {
+        return false;
+    }
+
+    int64_t quotient = ((int64_t) left * FIXED_ONE) / right;
+
+    *result = (fixed_t) quotient;
+
+    return quotient >= FIXED_MIN && quotient <= FIXED_MAX;
+}
+
+/**
+ * Raise a fixed point number to an integer power
+ */
+external bool fixed_power(fixed_t base, int32_t exponent, fixed_t *result);
+
+#endif /** MATH_NUMBER_H */
@@ -0,0 +1,526 @@
+#include "parser.h"
+#include <math/lexer.h>
+#include <math/vm.h>
+#include <math.h>
+#include <pico.h>
+#include <stdbool.h>
+#include <string.h>
+
+/**
+ * How tightly each operator binds, the right power is the one its right operand is parsed
+ * with, so a right power lower than the left one makes the operator right associative
+ */
+#define POWER_NONE              0
+#define POWER_SUM               10
+#define POWER_PRODUCT           20
+#define POWER_PREFIX            25
+#define POWER_EXPONENT          30
+
+/**
+ * How deep parentheses and function calls can be nested, so a malicious expression can't
+ * overflow the (small) C stack
+ */
+#define PARSER_MAX_NESTING      32
+
+/**
+ * Integers up to this are exact in a `double`
+ */
+#define PARSER_MAX_EXACT        (INT64_C(1) << 53)
+
+/**
+ * A value on the stack of the program being compiled, to know which ones can be folded
+ */
+typedef struct parser_value_t
+{
+    /** Where the instruction that pushed it starts */
+    uint8_t     offset;
+
+    /** If it was pushed by an `EXPR_OP_CONSTANT` */
+    bool        constant;
+} parser_value_t;
+
+typedef struct parser_t
+{
+    lexer_t         lexer;
+
+    /** The token being looked at, and the type of the one before it */
+    token_t         token;
+    token_type_t    previous;
+
+    expr_t          *expr;
+
+    /** Mirrors the stack of the program while it runs */
+    parser_value_t  values[EXPR_MAX_STACK];
+    uint8_t         depth;
+
+    /** How many `parser_expression` calls are running */
+    uint8_t         nesting;
+
+    /**
+     * If set, only the operations that are exact in a `double` are folded, so a rational
+     * evaluation still sees every fraction (`1/3` is kept as a division)
+     */
+    bool            exact;
+
+    /** The cheapest kind of number the expression read so far needs */
+    expr_tier_t     tier;
+} parser_t;
+
+typedef struct parser_name_t
+{
+    const char      *name;
+    expr_function_t function;
+
+    /** The cheapest kind of number the function can be computed with */
+    expr_tier_t     tier;
+} parser_name_t;
+
+internal const parser_name_t function_names[] = {
+    { "sin",   EXPR_FUNCTION_SIN,   EXPR_TIER_FIXED    },
+    { "cos",   EXPR_FUNCTION_COS,   EXPR_TIER_FIXED    },
+    { "tan",   EXPR_FUNCTION_TAN,   EXPR_TIER_FIXED    },
+    { "asin",  EXPR_FUNCTION_ASIN,  EXPR_TIER_FLOAT    },
+    { "acos",  EXPR_FUNCTION_ACOS,  EXPR_TIER_FLOAT    },
+    { "atan",  EXPR_FUNCTION_ATAN,  EXPR_TIER_FIXED    },
+    { "sinh",  EXPR_FUNCTION_SINH,  EXPR_TIER_FLOAT    },
+    { "cosh",  EXPR_FUNCTION_COSH,  EXPR_TIER_FLOAT    },
+    { "tanh",  EXPR_FUNCTION_TANH,  EXPR_TIER_FLOAT    },
+    { "sqrt",  EXPR_FUNCTION_SQRT,  EXPR_TIER_FIXED    },
+    { "cbrt",  EXPR_FUNCTION_CBRT,  EXPR_TIER_FLOAT    },
+    { "exp",   EXPR_FUNCTION_EXP,   EXPR_TIER_FIXED    },
+    { "ln",    EXPR_FUNCTION_LN,    EXPR_TIER_FIXED    },
+    { "log",   EXPR_FUNCTION_LOG,   EXPR_TIER_FLOAT    },
+    { "abs",   EXPR_FUNCTION_ABS,   EXPR_TIER_RATIONAL },
+    { "floor", EXPR_FUNCTION_FLOOR, EXPR_TIER_RATIONAL },
+    { "ceil",  EXPR_FUNCTION_CEIL,  EXPR_TIER_RATIONAL },
+    { "round", EXPR_FUNCTION_ROUND, EXPR_TIER_RATIONAL }
+};
+
+internal error_t parser_expression(parser_t *parser, uint8_t minimum_power);
+
+internal force_inline bool parser_token_is(const token_t *token, const char *name) {
+    return strlen(name) == token->length && memcmp(token->start, name, token->length) == 0;
+}
+
+internal force_inline void parser_need_tier(parser_t *parser, expr_tier_t tier) {
+    parser->tier = MAX(parser->tier, tier);
+}
+
+internal force_inline bool parser_is_exact_integer(double value) {
+    return value == floor(value) && fabs(value) < PARSER_MAX_EXACT;
+}
+
+internal force_inline void parser_advance(parser_t *parser) {
+    parser->previous = parser->token.type;
+
+    lexer_next(&parser->lexer, &parser->token);
+}
+
+internal error_t parser_emit(parser_t *parser, expr_op_t op, int operand) {
+    expr_t *expr = parser->expr;
+    uint8_t size = operand >= 0 ? 2 : 1;
+
+    // Always leave room for the `EXPR_OP_RETURN`
+    if (expr->code_size + size >= EXPR_MAX_CODE) {
+        return -ETOOCOMPLEX;
+    }
+
+    expr->code[expr->code_size++] = op;
+
+    if (operand >= 0) {
+        expr->code[expr->code_size++] = operand;
+    }
+
+    return 0x00;
+}
+
+internal error_t parser_push(parser_t *parser, expr_op_t op, uint8_t operand) {
+    if (parser->depth >= EXPR_MAX_STACK) {
+        return -ETOOCOMPLEX;
+    }
+
+    parser->values[parser->depth] = (parser_value_t) {
+        .offset     = parser->expr->code_size,
+        .constant   = op == EXPR_OP_CONSTANT
+    };
+
+    error_t error = parser_emit(parser, op, operand);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    parser->depth++;
+    parser->expr->stack_depth = MAX(parser->expr->stack_depth, parser->depth);
+
+    return 0x00;
+}
+
+internal error_t parser_push_constant(parser_t *parser, double value) {
+    expr_t *expr = parser->expr;
+
+    if (expr->constant_count >= EXPR_MAX_CONSTANTS) {
+        return -ETOOCOMPLEX;
+    }
+
+    expr->constants[expr->constant_count] = value;
+
+    error_t error = parser_push(parser, EXPR_OP_CONSTANT, expr->constant_count);
+
+    if (error == 0x00) {
+        expr->constant_count++;
+    }
+
+    return error;
+}
+
+/**
+ * Remove the constants on the top of the stack from the program and return their values.
+ *
+ * The constants of the values on the top of the stack are always the last ones in the
+ * constant table too, as they're the last instructions of the program.
+ */
+internal void parser_pop_constants(parser_t *parser, uint8_t count, double *values) {
+    expr_t *expr = parser->expr;
+
+    parser->depth -= count;
+    expr->code_size = parser->values[parser->depth].offset;
+    expr->constant_count -= count;
+
+    for (uint8_t index = 0; index < count; index++) {
+        values[index] = expr->constants[expr->constant_count + index];
+    }
+}
+
+internal error_t parser_unary(parser_t *parser, expr_op_t op, int operand) {
+    if (parser->values[parser->depth - 1].constant) {
+        double value;
+
+        parser_pop_constants(parser, 1, &value);
+
+        return parser_push_constant(
+            parser,
+            op == EXPR_OP_NEGATE ? -value : expr_call((expr_function_t) operand, value)
+        );
+    }
+
+    // The value is replaced in place, so the stack doesn't change
+    parser->values[parser->depth - 1].constant = false;
+
+    return parser_emit(parser, op, operand);
+}
+
+internal error_t parser_binary(parser_t *parser, expr_op_t op) {
+    parser_value_t *right = &parser->values[parser->depth - 1];
+    parser_value_t *left = &parser->values[parser->depth - 2];
+    const double *constants = parser->expr->constants;
+
+    // Only integer powers can be computed without `double`
+    if (op == EXPR_OP_POWER && (!right->constant || !parser_is_exact_integer(constants[parser->expr->constant_count - 1]))) {
+        parser_need_tier(parser, EXPR_TIER_FLOAT);
+    }
+
+    if (left->constant && right->constant) {
+        double a = constants[parser->expr->constant_count - 2];
+        double b = constants[parser->expr->constant_count - 1];
+        double value = expr_apply(op, a, b);
+
+        // Don't turn an exact fraction into a rounded `double`
+        bool exact = parser_is_exact_integer(value) || !parser_is_exact_integer(a) || !parser_is_exact_integer(b);
+
+        if (!parser->exact || exact) {
+            double values[2];
+
+            parser_pop_constants(parser, 2, values);
+
+            return parser_push_constant(parser, value);
+        }
+    }
+
+    parser->depth--;
+    parser->values[parser->depth - 1].constant = false;
+
+    return parser_emit(parser, op, -1);
+}
+
+internal error_t parser_expect(parser_t *parser, token_type_t type) {
+    if (parser->token.type != type) {
+        return -ESYNTAX;
+    }
+
+    parser_advance(parser);
+
+    return 0x00;
+}
+
+internal error_t parser_identifier(parser_t *parser) {
+    token_t name = parser->token;
+
+    parser_advance(parser);
+
+    for (size_t index = 0; index < sizeof(function_names) / sizeof(function_names[0]); index++) {
+        if (!parser_token_is(&name, function_names[index].name)) {
+            continue;
+        }
+
+        error_t error = parser_expect(parser, TOKEN_LEFT_PARENTHESIS);
+
+        if (error == 0x00) error = parser_expression(parser, POWER_NONE);
+        if (error == 0x00) error = parser_expect(parser, TOKEN_RIGHT_PARENTHESIS);
+
+        if (error != 0x00) {
+            return error;
+        }
+
+        parser_need_tier(parser, function_names[index].tier);
+
+        return parser_unary(parser, EXPR_OP_CALL, function_names[index].function);
+    }
+
+    if (parser_token_is(&name, "pi")) {
+        parser_need_tier(parser, EXPR_TIER_FIXED);
+
+        return parser_push_constant(parser, M_PI);
+    }
+
+    if (parser_token_is(&name, "e")) {
+        parser_need_tier(parser, EXPR_TIER_FIXED);
+
+        return parser_push_constant(parser, M_E);
+    }
+
+    if (name.length == 1 && name.start[0] >= 'a' && name.start[0] <= 'z') {
+        parser->expr->variables |= 1u << EXPR_VARIABLE(name.start[0]);
+
+        return parser_push(parser, EXPR_OP_VARIABLE, EXPR_VARIABLE(name.start[0]));
+    }
+
+    // Point the error at the name and not what comes after it
+    parser->token = name;
+
+    return -EUNKNOWNNAME;
+}
+
+/**
+ * Push a number, when it's a decimal fraction that isn't exact in a `double` (`0.1`), it's
+ * pushed as a division of two integers in the exact pass
+ */
+internal error_t parser_number(parser_t *parser) {
+    const token_t *token = &parser->token;
+    int64_t numerator = token->mantissa;
+    int64_t denominator = 1;
+    bool exact = token->exact;
+
+    for (int16_t exponent = token->exponent; exact && exponent > 0; exponent--) {
+        numerator *= 10;
+        exact = numerator < PARSER_MAX_EXACT;
+    }
+
+    for (int16_t exponent = token->exponent; exact && exponent < 0; exponent++) {
+        denominator *= 10;
+        exact = denominator < PARSER_MAX_EXACT;
+    }
+
+    if (!exact) {
+        parser_need_tier(parser, EXPR_TIER_FLOAT);
+    }
+
+    if (!exact || !parser->exact || denominator == 1) {
+        return parser_push_constant(parser, token->number);
+    }
+
+    error_t error = parser_push_constant(parser, numerator);
+
+    if (error == 0x00) error = parser_push_constant(parser, denominator);
+    if (error == 0x00) error = parser_binary(parser, EXPR_OP_DIVIDE);
+
+    return error;
+}
+
+internal error_t parser_prefix(parser_t *parser) {
+    error_t error;
+
+    switch (parser->token.type) {
+    case TOKEN_NUMBER:
+        error = parser_number(parser);
+
+        if (error == 0x00) {
+            parser_advance(parser);
+        }
+
+        return error;
+
+    case TOKEN_IDENTIFIER:
+        return parser_identifier(parser);
+
+    case TOKEN_MINUS:
+        parser_advance(parser);
+
+        error = parser_expression(parser, POWER_PREFIX);
+
+        return error == 0x00 ? parser_unary(parser, EXPR_OP_NEGATE, -1) : error;
+
+    case TOKEN_PLUS:
+        parser_advance(parser);
+
+        return parser_expression(parser, POWER_PREFIX);
+
+    case TOKEN_LEFT_PARENTHESIS:
+        parser_advance(parser);
+
+        error = parser_expression(parser, POWER_NONE);
+
+        return error == 0x00 ? parser_expect(parser, TOKEN_RIGHT_PARENTHESIS) : error;
+
+    default:
+        return -ESYNTAX;
+    }
+}
+
+/**
+ * Get the instruction and binding powers of the operator at the current token, returns false
+ * if the token can't continue an expression
+ */
+internal bool parser_infix(parser_t *parser, expr_op_t *op, uint8_t *left_power, uint8_t *right_power, bool *implicit) {
+    *implicit = false;
+
+    switch (parser->token.type) {
+    case TOKEN_PLUS:
+    case TOKEN_MINUS:
+        *op = parser->token.type == TOKEN_PLUS ? EXPR_OP_ADD : EXPR_OP_SUBTRACT;
+        *left_power = POWER_SUM;
+        *right_power = POWER_SUM + 1;
+        return true;
+
+    case TOKEN_STAR:
+    case TOKEN_SLASH:
+        *op = parser->token.type == TOKEN_STAR ? EXPR_OP_MULTIPLY : EXPR_OP_DIVIDE;
+        *left_power = POWER_PRODUCT;
+        *right_power = POWER_PRODUCT + 1;
+        return true;
+
+    case TOKEN_CARET:
+        *op = EXPR_OP_POWER;
+        *left_power = POWER_EXPONENT + 1;
+        *right_power = POWER_EXPONENT;
+        return true;
+
+    case TOKEN_NUMBER:
+        // `2 3` is a mistake, not `6`, but `x2` is `x*2`
+        if (parser->previous == TOKEN_NUMBER) {
+            return false;
+        }
+
+        // fall through
+    case TOKEN_IDENTIFIER:
+    case TOKEN_LEFT_PARENTHESIS:
+        *op = EXPR_OP_MULTIPLY;
+        *left_power = POWER_PRODUCT;
+        *right_power = POWER_PRODUCT + 1;
+        *implicit = true;
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+internal error_t parser_expression(parser_t *parser, uint8_t minimum_power) {
+    if (parser->nesting >= PARSER_MAX_NESTING) {
+        return -ETOOCOMPLEX;
+    }
+
+    parser->nesting++;
+
+    error_t error = parser_prefix(parser);
+
+    while (error == 0x00) {
+        expr_op_t op;
+        uint8_t left_power, right_power;
+        bool implicit;
+
+        if (!parser_infix(parser, &op, &left_power, &right_power, &implicit) || left_power < minimum_power) {
+            break;
+        }
+
+        if (!implicit) {
+            parser_advance(parser);
+        }
+
+        error = parser_expression(parser, right_power);
+
+        if (error == 0x00) {
+            error = parser_binary(parser, op);
+        }
+    }
+
+    parser->nesting--;
+
+    return error;
+}
+
+internal error_t parser_run(const char *source, size_t length, expr_t *expr, bool exact, size_t *error_position) {
+    parser_t parser = {
+        .previous   = TOKEN_END,
+        .expr       = expr,
+        .depth      = 0,
+        .nesting    = 0,
+        .exact      = exact,
+        .tier       = EXPR_TIER_RATIONAL
+    };
+
+    expr->code_size = 0;
+    expr->constant_count = 0;
+    expr->stack_depth = 0;
+    expr->variables = 0;
+
+    lexer_init(&parser.lexer, source, length);
+    lexer_next(&parser.lexer, &parser.token);
+
+    error_t error = parser_expression(&parser, POWER_NONE);
+
+    if (error == 0x00 && parser.token.type != TOKEN_END) {
+        error = -ESYNTAX;
+    }
+
+    if (error == 0x00) {
+        // There's always room for it, `parser_emit` leaves it
+        expr->code[expr->code_size++] = EXPR_OP_RETURN;
+    } else if (error_position != NULL) {
+        *error_position = parser.token.start - source;
+    }
+
+    expr->tier = parser.tier;
+
+    return error;
+}
+
+error_t expr_compile(const char *source, size_t length, expr_t *expr, size_t *error_position) {
+    error_t error = parser_run(source, length, expr, true, error_position);
+
+    // Only a rational evaluation needs the unfolded fractions, fold everything for the others
+    if (error == -ETOOCOMPLEX || (error == 0x00 && expr->tier != EXPR_TIER_RATIONAL)) {
+        expr_tier_t tier = error == 0x00 ? expr->tier : EXPR_TIER_FLOAT;
+
+        error = parser_run(source, length, expr, false, error_position);
+        expr->tier = tier;
+    }
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    expr->fixed_constants_fit = true;
+
+    for (uint8_t index = 0; index < expr->constant_count; index++) {
+        double value = expr->constants[index];
+
+        if (value >= (double) FIXED_MAX / FIXED_ONE || value <= (double) FIXED_MIN / FIXED_ONE) {
+            expr->fixed_constants_fit = false;
+        } else {
+            expr->fixed_constants[index] = fixed_from_double(value);
+        }
+    }
+
+    return 0x00;
+}
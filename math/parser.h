@@ -0,0 +1,39 @@
+#ifndef MATH_PARSER_H
+#define MATH_PARSER_H
+
+#include <math/expr.h>
+#include <stddef.h>
+#include <util/util.h>
+#include <errno.h>
+
+/**
+ * Compile an expression into a program for the evaluator
+ *
+ * PARAMETERS
+ * - source: the expression, it doesn't need to end with a NUL
+ * - length: the size of the expression
+ * - expr: where the program is written
+ * - error_position: if not NULL, where the offset of the token that failed is written
+ *
+ * NOTES
+ * - The grammar, from the loosest to the tightest binding:
+ *     - `a + b`, `a - b`
+ *     - `a * b`, `a / b` and implicit multiplication (`2x`, `3(x + 1)`, `x sin(x)`)
+ *     - `-a`, `+a`
+ *     - `a ^ b`, right associative, so `-2^2` is `-4` and `2^3^2` is `2^9`
+ *     - numbers, variables (`a` to `z`), `pi`, `e`, `f(a)` and `(a)`
+ * - Operations that only use constants are computed here, so `2pi x` is a single
+ *   multiplication when evaluated. Unless the expression can be evaluated with rationals
+ *   (see `expr_tier_t`), then the fractions are kept (`1/3` stays a division).
+ * - `expr->tier` tells which evaluators can be used.
+ * - This is a single pass Pratt parser, the instructions are written as the expression is
+ *   read, there's no syntax tree and nothing is allocated.
+ *
+ * RETURN VALUE
+ * - ESYNTAX: if the expression is not well formed, or empty
+ * - ETOOCOMPLEX: if the program doesn't fit in an `expr_t`
+ * - EUNKNOWNNAME: if the expression uses a function or constant that doesn't exist
+ */
+external error_t expr_compile(const char *source, size_t length, expr_t *expr, size_t *error_position);
+
+#endif /** MATH_PARSER_H */
@@ -0,0 +1,427 @@
+#include "solve.h"
+#include <float.h>
+#include <hal/display.h>
+#include <math.h>
+#include <math/vm.h>
+#include <string.h>
+#include <util/trace.h>
+
+/**
+ * The 15-point Kronrod rule on [-1, 1], and the 7-point Gauss rule whose nodes are every
+ * other of its nodes: the part of the nodes in the middle, the last one is the center
+ */
+internal const double kronrod_nodes[8] = {
+    0.991455371120812639206854697526329,
+    0.949107912342758524526189684047851,
+    0.864864423359769072789712788640926,
+    0.741531185599394439863864773280788,
+    0.586087235467691130294144845693013,
+    0.405845151377397166906606412076961,
+    0.207784955007898467600689403773245,
+    0.000000000000000000000000000000000
+};
+
+internal const double kronrod_weights[8] = {
+    0.022935322010529224963732008058970,
+    0.063092092629978553290700663189204,
+    0.104790010322250183839876322541518,
+    0.140653259715525918745189590510238,
+    0.169004726639267902826583426598550,
+    0.190350578064785409913256402421014,
+    0.204432940075298892414161999234649,
+    0.209482141084727828012999174891714
+};
+
+/** Of the odd Kronrod nodes, and the center */
+internal const double gauss_weights[4] = {
+    0.129484966168869693270611432679082,
+    0.279705391489276667901467771423780,
+    0.381830050505118944950369775488975,
+    0.417959183673469387755102040816327
+};
+
+internal error_t solve_evaluate(solve_t *solve, double x, double *result) {
+    solve->variables[solve->variable] = x;
+    solve->evaluations++;
+
+    error_t error = expr_evaluate(solve->expr, solve->variables, result);
+
+    if (error == 0x00 && !isfinite(*result)) {
+        return -EDOMAIN;
+    }
+
+    return error;
+}
+
+internal void solve_init(solve_t *solve, solve_kind_t kind, const expr_t *expr, const double *variables, uint8_t variable) {
+    solve->kind = kind;
+    solve->expr = expr;
+    solve->variable = variable;
+    solve->result = 0;
+    solve->error = INFINITY;
+    solve->evaluations = 0;
+    solve->iterations = 0;
+    solve->done = false;
+    solve->converged = false;
+    solve->status = 0x00;
+    solve->cancelled = false;
+
+    memcpy(solve->variables, variables, sizeof(solve->variables));
+    sem_init(&solve->stepped, 0, 1);
+}
+
+/**
+ * Stop refining, `converged` is only set by the caller
+ */
+internal void solve_finish(solve_t *solve, error_t status) {
+    solve->done = true;
+    solve->status = status;
+
+    if (!solve->converged) {
+        TRACE_COUNT(TRACE_COUNTER_SOLVE_UNCONVERGED, 1);
+    }
+}
+
+internal force_inline double solve_tolerance(double value) {
+    return SOLVE_TOLERANCE * MAX(1.0, fabs(value));
+}
+
+/******************** INTEGRAL *************************/
+
+internal error_t solve_kronrod(solve_t *solve, solve_interval_t *interval) {
+    double center = 0.5 * (interval->from + interval->to);
+    double half = 0.5 * (interval->to - interval->from);
+    double value;
+    error_t error = solve_evaluate(solve, center, &value);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    double kronrod = kronrod_weights[7] * value;
+    double gauss = gauss_weights[3] * value;
+
+    for (int node = 0; node < 7; node++) {
+        double offset = half * kronrod_nodes[node];
+        double left, right;
+
+        if ((error = solve_evaluate(solve, center - offset, &left)) != 0x00 || (error = solve_evaluate(solve, center + offset, &right)) != 0x00) {
+            return error;
+        }
+
+        kronrod += kronrod_weights[node] * (left + right);
+
+        if (node % 2 == 1) {
+            gauss += gauss_weights[node / 2] * (left + right);
+        }
+    }
+
+    interval->integral = kronrod * half;
+
+    // The difference of both rules is a pessimistic estimate: it's the error of the Gauss rule
+    interval->error = fabs(kronrod - gauss) * fabs(half);
+
+    return isfinite(interval->integral) ? 0x00 : -EDOMAIN;
+}
+
+/**
+ * Add the intervals up again, a running sum would drift as they're replaced
+ */
+internal void solve_integral_sum(solve_t *solve) {
+    double result = 0;
+    double error = 0;
+
+    for (uint8_t index = 0; index < solve->integral.count; index++) {
+        result += solve->integral.intervals[index].integral;
+        error += solve->integral.intervals[index].error;
+    }
+
+    solve->result = result;
+    solve->error = error;
+
+    if (error <= solve_tolerance(result)) {
+        solve->converged = true;
+        solve_finish(solve, 0x00);
+    }
+}
+
+error_t solve_integrate(
+    solve_t *solve,
+    const expr_t *expr,
+    const double *variables,
+    uint8_t variable,
+    double from,
+    double to
+) {
+    solve_init(solve, SOLVE_INTEGRATE, expr, variables, variable);
+
+    if (!isfinite(from) || !isfinite(to)) {
+        return -EDOMAIN;
+    }
+
+    solve->integral.intervals[0] = (solve_interval_t) { .from = from, .to = to };
+    solve->integral.count = 1;
+
+    error_t error = solve_kronrod(solve, &solve->integral.intervals[0]);
+
+    TRACE_COUNT(TRACE_COUNTER_SOLVE_EVALUATIONS, solve->evaluations);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    solve_integral_sum(solve);
+
+    return 0x00;
+}
+
+/**
+ * Halve the intervals with the biggest errors, they're where the expression is the hardest
+ */
+internal void solve_integral_step(solve_t *solve) {
+    for (int split = 0; split < SOLVE_STEP_SPLITS && !solve->done; split++) {
+        if (solve->cancelled) {
+            solve_finish(solve, -ESOLVECANCELLED);
+
+            return;
+        }
+
+        solve_interval_t *intervals = solve->integral.intervals;
+        uint8_t worst = 0;
+
+        for (uint8_t index = 1; index < solve->integral.count; index++) {
+            if (intervals[index].error > intervals[worst].error) {
+                worst = index;
+            }
+        }
+
+        double from = intervals[worst].from;
+        double to = intervals[worst].to;
+        double middle = 0.5 * (from + to);
+
+        // Out of intervals, or down to the resolution of a double (a singularity)
+        if (solve->integral.count == SOLVE_MAX_INTERVALS || middle <= MIN(from, to) || middle >= MAX(from, to)) {
+            solve_finish(solve, 0x00);
+
+            return;
+        }
+
+        solve_interval_t left = { .from = from, .to = middle };
+        solve_interval_t right = { .from = middle, .to = to };
+        error_t error = solve_kronrod(solve, &left);
+
+        if (error == 0x00) {
+            error = solve_kronrod(solve, &right);
+        }
+
+        if (error != 0x00) {
+            solve_finish(solve, error);
+
+            return;
+        }
+
+        intervals[worst] = left;
+        intervals[solve->integral.count++] = right;
+        solve->iterations++;
+
+        solve_integral_sum(solve);
+    }
+}
+
+/******************** ROOT *************************/
+
+error_t solve_root(
+    solve_t *solve,
+    const expr_t *expr,
+    const double *variables,
+    uint8_t variable,
+    double from,
+    double to
+) {
+    solve_init(solve, SOLVE_ROOT, expr, variables, variable);
+
+    if (!isfinite(from) || !isfinite(to)) {
+        return -EDOMAIN;
+    }
+
+    double fa, fb;
+    error_t error = solve_evaluate(solve, from, &fa);
+
+    if (error == 0x00) {
+        error = solve_evaluate(solve, to, &fb);
+    }
+
+    TRACE_COUNT(TRACE_COUNTER_SOLVE_EVALUATIONS, solve->evaluations);
+
+    if (error != 0x00) {
+        return error;
+    }
+
+    if ((fa > 0 && fb > 0) || (fa < 0 && fb < 0)) {
+        return -ESOLVEBRACKET;
+    }
+
+    solve->root.a = from;
+    solve->root.b = to;
+    solve->root.c = from;
+    solve->root.fa = fa;
+    solve->root.fb = fb;
+    solve->root.fc = fa;
+    solve->root.d = to - from;
+    solve->root.e = to - from;
+
+    if (fa == 0 || fb == 0) {
+        solve->result = fa == 0 ? from : to;
+        solve->error = 0;
+        solve->converged = true;
+        solve_finish(solve, 0x00);
+    } else {
+        // The secant through the ends, without evaluating anything more
+        solve->result = to - fb * (to - from) / (fb - fa);
+        solve->error = fabs(to - from);
+    }
+
+    return 0x00;
+}
+
+/**
+ * Brent's method: inverse quadratic interpolation or the secant when they land well inside
+ * the bracket, the bisection otherwise, so it's never slower than bisecting
+ */
+internal void solve_root_step(solve_t *solve) {
+    double a = solve->root.a, b = solve->root.b, c = solve->root.c;
+    double d = solve->root.d, e = solve->root.e;
+    double fa = solve->root.fa, fb = solve->root.fb, fc = solve->root.fc;
+
+    for (int iteration = 0; iteration < SOLVE_STEP_ITERATIONS; iteration++) {
+        if (solve->cancelled) {
+            solve_finish(solve, -ESOLVECANCELLED);
+            break;
+        }
+
+        // The root is between `b` and `c`, and `b` is the closest
+        if ((fb > 0) == (fc > 0)) {
+            c = a;
+            fc = fa;
+            d = e = b - a;
+        }
+
+        if (fabs(fc) < fabs(fb)) {
+            a = b;
+            b = c;
+            c = a;
+            fa = fb;
+            fb = fc;
+            fc = fa;
+        }
+
+        double tolerance = 2 * DBL_EPSILON * fabs(b) + 0.5 * solve_tolerance(b);
+        double middle = 0.5 * (c - b);
+
+        solve->result = b;
+        solve->error = fabs(c - b);
+
+        if (fabs(middle) <= tolerance || fb == 0) {
+            solve->converged = true;
+            solve_finish(solve, 0x00);
+            break;
+        }
+
+        if (solve->iterations == SOLVE_MAX_ITERATIONS) {
+            solve_finish(solve, 0x00);
+            break;
+        }
+
+        if (fabs(e) < tolerance || fabs(fa) <= fabs(fb)) {
+            d = e = middle;
+        } else {
+            double s = fb / fa;
+            double p, q;
+
+            if (a == c) {
+                p = 2 * middle * s;
+                q = 1 - s;
+            } else {
+                double r = fb / fc;
+
+                q = fa / fc;
+                p = s * (2 * middle * q * (q - r) - (b - a) * (r - 1));
+                q = (q - 1) * (r - 1) * (s - 1);
+            }
+
+            if (p > 0) {
+                q = -q;
+            } else {
+                p = -p;
+            }
+
+            if (2 * p < MIN(3 * middle * q - fabs(tolerance * q), fabs(e * q))) {
+                e = d;
+                d = p / q;
+            } else {
+                d = e = middle;
+            }
+        }
+
+        a = b;
+        fa = fb;
+        b += fabs(d) > tolerance ? d : (middle > 0 ? tolerance : -tolerance);
+
+        error_t error = solve_evaluate(solve, b, &fb);
+
+        solve->iterations++;
+
+        if (error != 0x00) {
+            solve_finish(solve, error);
+            break;
+        }
+    }
+
+    solve->root.a = a;
+    solve->root.b = b;
+    solve->root.c = c;
+    solve->root.d = d;
+    solve->root.e = e;
+    solve->root.fa = fa;
+    solve->root.fb = fb;
+    solve->root.fc = fc;
+}
+
+/******************** STEPS *************************/
+
+void solve_step(solve_t *solve) {
+    if (solve->done) {
+        return;
+    }
+
+    uint32_t evaluations = solve->evaluations;
+    uint16_t iterations = solve->iterations;
+
+    TRACE_BEGIN(TRACE_SPAN_SOLVE_STEP);
+
+    switch (solve->kind) {
+    case SOLVE_INTEGRATE:
+        solve_integral_step(solve);
+        break;
+
+    case SOLVE_ROOT:
+        solve_root_step(solve);
+        break;
+    }
+
+    TRACE_END(TRACE_SPAN_SOLVE_STEP);
+    TRACE_COUNT(TRACE_COUNTER_SOLVE_EVALUATIONS, solve->evaluations - evaluations);
+    TRACE_COUNT(TRACE_COUNTER_SOLVE_ITERATIONS, solve->iterations - iterations);
+}
+
+internal void solve_step_core_1(void *data) {
+    solve_step(data);
+}
+
+void solve_step_async(solve_t *solve) {
+    display_submit(&(display_job_t) {
+        .type               = DISPLAY_JOB_CALL,
+        .call               = { solve_step_core_1, solve },
+        .completion_signal  = &solve->stepped
+    });
+}
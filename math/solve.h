@@ -0,0 +1,169 @@
+#ifndef MATH_SOLVE_H
+#define MATH_SOLVE_H
+
+#include <math/expr.h>
+#include <pico/sem.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+#include <errno.h>
+
+/**
+ * The numeric solvers of the calculator, over a compiled expression of one variable: the
+ * integral over an interval (adaptive Gauss-Kronrod), and a root in an interval where the
+ * expression changes sign (Brent's method).
+ *
+ * A solve starts with a coarse result, computed right away with a handful of evaluations,
+ * and is then refined in steps: each one does a bounded amount of work (`SOLVE_STEP_SPLITS`
+ * intervals, or `SOLVE_STEP_ITERATIONS` iterations) and updates the result and its error
+ * estimate, until it's within the tolerance. The steps can run on core 1 as display jobs
+ * (`solve_step_async`), so core 0 keeps reading the keys meanwhile and can cancel it.
+ */
+
+/**
+ * How many intervals an integral is split into at most, the result is the best one so far
+ * (not converged) when they're all used
+ */
+#define SOLVE_MAX_INTERVALS     64
+
+/**
+ * The most iterations of a root, Brent's method needs far less unless the expression isn't
+ * continuous
+ */
+#define SOLVE_MAX_ITERATIONS    200
+
+/**
+ * The work of a single refinement step: each split is 30 evaluations
+ */
+#define SOLVE_STEP_SPLITS       4
+#define SOLVE_STEP_ITERATIONS   8
+
+/**
+ * The relative tolerance of the results (absolute under one)
+ */
+#define SOLVE_TOLERANCE         1e-10
+
+typedef enum solve_error_t
+{
+    /** The expression has the same sign at both ends of the interval of a root */
+    ESOLVEBRACKET       = 0x40,
+
+    /** The solve was cancelled before it was done */
+    ESOLVECANCELLED     = 0x41
+} solve_error_t;
+
+typedef enum solve_kind_t: byte
+{
+    SOLVE_INTEGRATE     = 0x00,
+    SOLVE_ROOT          = 0x01
+} solve_kind_t;
+
+/**
+ * A part of an integral, with the 15-point Kronrod estimate of it and its error
+ */
+typedef struct solve_interval_t
+{
+    double      from;
+    double      to;
+    double      integral;
+    double      error;
+} solve_interval_t;
+
+typedef struct solve_t
+{
+    solve_kind_t        kind;
+
+    /** The expression, needs to be kept alive until the solve is done */
+    const expr_t        *expr;
+
+    /** A copy of the variables, the slot of `variable` is written by every evaluation */
+    double              variables[EXPR_VARIABLE_COUNT];
+    uint8_t             variable;
+
+    /** The best result so far, and the estimate of its absolute error */
+    double              result;
+    double              error;
+
+    uint32_t            evaluations;
+    uint16_t            iterations;
+
+    /** If nothing is left to refine, `status` has why: 0x00, `ESOLVECANCELLED` or an evaluation error */
+    bool                done;
+    bool                converged;
+    error_t             status;
+
+    /** Set by `solve_cancel`, the step in progress stops at its next interval or iteration */
+    volatile bool       cancelled;
+
+    /** Released by core 1 when a step of `solve_step_async` is done */
+    semaphore_t         stepped;
+
+    union {
+        struct {
+            solve_interval_t    intervals[SOLVE_MAX_INTERVALS];
+            uint8_t             count;
+        } integral;
+
+        /** The state of Brent's method: `b` is the best guess, the root is between `b` and `c` */
+        struct {
+            double              a, b, c, d, e;
+            double              fa, fb, fc;
+        } root;
+    };
+} solve_t;
+
+/**
+ * Start an integral of `expr` over `variable`, from `from` to `to`, with its coarse result
+ * (a single 15-point Gauss-Kronrod rule)
+ *
+ * RETURN VALUE
+ * - EDOMAIN: if an end isn't finite, or the expression isn't a number somewhere
+ * - the errors of `expr_evaluate`
+ */
+external error_t solve_integrate(
+    solve_t *solve,
+    const expr_t *expr,
+    const double *variables,
+    uint8_t variable,
+    double from,
+    double to
+);
+
+/**
+ * Start looking for a root of `expr` between `from` and `to`, the coarse result is the
+ * secant of the ends
+ *
+ * RETURN VALUE
+ * - ESOLVEBRACKET: if the expression doesn't change sign between the ends
+ * - EDOMAIN: if an end isn't finite
+ * - the errors of `expr_evaluate`
+ */
+external error_t solve_root(
+    solve_t *solve,
+    const expr_t *expr,
+    const double *variables,
+    uint8_t variable,
+    double from,
+    double to
+);
+
+/**
+ * Refine the result once, on the calling core
+ */
+external void solve_step(solve_t *solve);
+
+/**
+ * Queue `solve_step` to core 1, `solve->stepped` is released when it's done and the solve
+ * can only be read after that (only call this from core 0)
+ */
+external void solve_step_async(solve_t *solve);
+
+/**
+ * Stop refining, from any core: the result stays the best one so far
+ */
+static force_inline void solve_cancel(solve_t *solve) {
+    solve->cancelled = true;
+}
+
+#endif /** MATH_SOLVE_H */
@@ -0,0 +1,321 @@
+#include "vm.h"
+#include <math.h>
+#include <stdbool.h>
+
+internal kernel_precision_t precision = KERNEL_PRECISION_EXACT;
+
+#define VM_KERNEL(name, kernel) \
+    internal double name(double value) { return kernel(value, precision); }
+
+VM_KERNEL(vm_sin, kernel_sin)
+VM_KERNEL(vm_cos, kernel_cos)
+VM_KERNEL(vm_tan, kernel_tan)
+VM_KERNEL(vm_atan, kernel_atan)
+VM_KERNEL(vm_exp, kernel_exp)
+VM_KERNEL(vm_ln, kernel_ln)
+
+#undef VM_KERNEL
+
+/**
+ * The implementation of each `expr_function_t`
+ */
+internal double (*const functions[EXPR_FUNCTION_COUNT])(double) = {
+    [EXPR_FUNCTION_SIN]     = vm_sin,
+    [EXPR_FUNCTION_COS]     = vm_cos,
+    [EXPR_FUNCTION_TAN]     = vm_tan,
+    [EXPR_FUNCTION_ASIN]    = asin,
+    [EXPR_FUNCTION_ACOS]    = acos,
+    [EXPR_FUNCTION_ATAN]    = vm_atan,
+    [EXPR_FUNCTION_SINH]    = sinh,
+    [EXPR_FUNCTION_COSH]    = cosh,
+    [EXPR_FUNCTION_TANH]    = tanh,
+    [EXPR_FUNCTION_SQRT]    = sqrt,
+    [EXPR_FUNCTION_CBRT]    = cbrt,
+    [EXPR_FUNCTION_EXP]     = vm_exp,
+    [EXPR_FUNCTION_LN]      = vm_ln,
+    [EXPR_FUNCTION_LOG]     = log10,
+    [EXPR_FUNCTION_ABS]     = fabs,
+    [EXPR_FUNCTION_FLOOR]   = floor,
+    [EXPR_FUNCTION_CEIL]    = ceil,
+    [EXPR_FUNCTION_ROUND]   = round
+};
+
+void expr_set_precision(kernel_precision_t value) {
+    precision = value;
+}
+
+double expr_call(expr_function_t function, double value) {
+    return functions[function](value);
+}
+
+double expr_apply(expr_op_t op, double left, double right) {
+    switch (op) {
+    case EXPR_OP_ADD:       return left + right;
+    case EXPR_OP_SUBTRACT:  return left - right;
+    case EXPR_OP_MULTIPLY:  return left * right;
+    case EXPR_OP_DIVIDE:    return left / right;
+    case EXPR_OP_POWER:     return pow(left, right);
+    default:                return NAN;
+    }
+}
+
+error_t expr_evaluate(const expr_t *expr, const double *variables, double *result) {
+    double stack[EXPR_MAX_STACK];
+
+    // The top of the stack is kept in `top`, `stack[depth - 1]` is the value below it
+    double top = 0;
+    uint8_t depth = 0;
+
+    const byte *ip = expr->code;
+
+    for (;;) {
+        switch ((expr_op_t) *ip++) {
+        case EXPR_OP_CONSTANT:
+            stack[depth++] = top;
+            top = expr->constants[*ip++];
+            break;
+
+        case EXPR_OP_VARIABLE:
+            stack[depth++] = top;
+            top = variables[*ip++];
+            break;
+
+        case EXPR_OP_ADD:
+            top = stack[--depth] + top;
+            break;
+
+        case EXPR_OP_SUBTRACT:
+            top = stack[--depth] - top;
+            break;
+
+        case EXPR_OP_MULTIPLY:
+            top = stack[--depth] * top;
+            break;
+
+        case EXPR_OP_DIVIDE:
+            top = stack[--depth] / top;
+            break;
+
+        case EXPR_OP_POWER:
+            top = pow(stack[--depth], top);
+            break;
+
+        case EXPR_OP_NEGATE:
+            top = -top;
+            break;
+
+        case EXPR_OP_CALL:
+            top = functions[*ip++](top);
+            break;
+
+        case EXPR_OP_RETURN:
+            *result = top;
+
+            return isnan(top) ? -EDOMAIN : 0x00;
+        }
+    }
+}
+
+error_t expr_evaluate_rational(const expr_t *expr, const rational_t *variables, rational_t *result) {
+    rational_t stack[EXPR_MAX_STACK];
+    rational_t top = { 0 };
+    uint8_t depth = 0;
+
+    const byte *ip = expr->code;
+    bool fits = expr->tier == EXPR_TIER_RATIONAL;
+
+    // The tier guarantees that the constants are integers, and that powers are integers
+    while (fits) {
+        switch ((expr_op_t) *ip++) {
+        case EXPR_OP_CONSTANT:
+            stack[depth++] = top;
+            top = rational_from_integer((int64_t) expr->constants[*ip++]);
+            break;
+
+        case EXPR_OP_VARIABLE:
+            stack[depth++] = top;
+            top = variables[*ip++];
+            break;
+
+        case EXPR_OP_ADD:
+            fits = rational_add(stack[--depth], top, &top);
+            break;
+
+        case EXPR_OP_SUBTRACT:
+            fits = rational_subtract(stack[--depth], top, &top);
+            break;
+
+        case EXPR_OP_MULTIPLY:
+            fits = rational_multiply(stack[--depth], top, &top);
+            break;
+
+        case EXPR_OP_DIVIDE:
+            if (top.numerator == 0) {
+                return -EDOMAIN;
+            }
+
+            fits = rational_divide(stack[--depth], top, &top);
+            break;
+
+        case EXPR_OP_POWER:
+            if (!rational_is_integer(top) || (top.numerator < 0 && stack[depth - 1].numerator == 0)) {
+                return -EDOMAIN;
+            }
+
+            fits = rational_power(stack[depth - 1], top.numerator, &top);
+            depth--;
+            break;
+
+        case EXPR_OP_NEGATE:
+            fits = top.numerator != INT64_MIN;
+            top.numerator = -top.numerator;
+            break;
+
+        case EXPR_OP_CALL:
+            switch ((expr_function_t) *ip++) {
+            case EXPR_FUNCTION_ABS:
+                fits = top.numerator != INT64_MIN;
+                top.numerator = top.numerator < 0 ? -top.numerator : top.numerator;
+                break;
+
+            case EXPR_FUNCTION_FLOOR: top = rational_floor(top); break;
+            case EXPR_FUNCTION_CEIL:  top = rational_ceil(top); break;
+            case EXPR_FUNCTION_ROUND: top = rational_round(top); break;
+            default:                  fits = false; break;
+            }
+            break;
+
+        case EXPR_OP_RETURN:
+            *result = top;
+
+            return 0x00;
+        }
+    }
+
+    return -ENUMBERRANGE;
+}
+
+error_t expr_evaluate_fixed(const expr_t *expr, const fixed_t *variables, fixed_t *result) {
+    fixed_t stack[EXPR_MAX_STACK];
+    fixed_t top = 0;
+    fixed_t other;
+    uint8_t depth = 0;
+
+    const byte *ip = expr->code;
+    bool fits = expr->tier <= EXPR_TIER_FIXED && expr->fixed_constants_fit;
+
+    while (fits) {
+        switch ((expr_op_t) *ip++) {
+        case EXPR_OP_CONSTANT:
+            stack[depth++] = top;
+            top = expr->fixed_constants[*ip++];
+            break;
+
+        case EXPR_OP_VARIABLE:
+            stack[depth++] = top;
+            top = variables[*ip++];
+            break;
+
+        case EXPR_OP_ADD:
+            fits = fixed_add(stack[--depth], top, &top);
+            break;
+
+        case EXPR_OP_SUBTRACT:
+            fits = fixed_subtract(stack[--depth], top, &top);
+            break;
+
+        case EXPR_OP_MULTIPLY:
+            fits = fixed_multiply(stack[--depth], top, &top);
+            break;
+
+        case EXPR_OP_DIVIDE:
+            if (top == 0) {
+                return -EDOMAIN;
+            }
+
+            fits = fixed_divide(stack[--depth], top, &top);
+            break;
+
+        case EXPR_OP_POWER:
+            // The exponent is always an integer constant
+            fits = fixed_power(stack[depth - 1], top >> FIXED_FRACTION_BITS, &top);
+            depth--;
+            break;
+
+        case EXPR_OP_NEGATE:
+            fits = top != FIXED_MIN;
+            top = -top;
+            break;
+
+        case EXPR_OP_CALL:
+            switch ((expr_function_t) *ip++) {
+            case EXPR_FUNCTION_ABS:
+                fits = top != FIXED_MIN;
+                top = top < 0 ? -top : top;
+                break;
+
+            case EXPR_FUNCTION_FLOOR:
+                top &= ~(FIXED_ONE - 1);
+                break;
+
+            case EXPR_FUNCTION_CEIL:
+                fits = fixed_add(top, FIXED_ONE - 1, &top);
+                top &= ~(FIXED_ONE - 1);
+                break;
+
+            case EXPR_FUNCTION_ROUND:
+                fits = fixed_add(top, FIXED_ONE / 2, &top);
+                top &= ~(FIXED_ONE - 1);
+                break;
+
+            case EXPR_FUNCTION_SIN:
+                kernel_sincos_fixed(top, EXPR_FIXED_PRECISION, &top, &other);
+                break;
+
+            case EXPR_FUNCTION_COS:
+                kernel_sincos_fixed(top, EXPR_FIXED_PRECISION, &other, &top);
+                break;
+
+            case EXPR_FUNCTION_TAN:
+                fits = kernel_tan_fixed(top, EXPR_FIXED_PRECISION, &top);
+                break;
+
+            case EXPR_FUNCTION_ATAN:
+                top = kernel_atan_fixed(top, EXPR_FIXED_PRECISION);
+                break;
+
+            case EXPR_FUNCTION_EXP:
+                fits = kernel_exp_fixed(top, EXPR_FIXED_PRECISION, &top);
+                break;
+
+            case EXPR_FUNCTION_LN:
+                if (top <= 0) {
+                    return -EDOMAIN;
+                }
+
+                kernel_ln_fixed(top, EXPR_FIXED_PRECISION, &top);
+                break;
+
+            case EXPR_FUNCTION_SQRT:
+                if (top < 0) {
+                    return -EDOMAIN;
+                }
+
+                kernel_sqrt_fixed(top, &top);
+                break;
+
+            default:
+                fits = false;
+                break;
+            }
+            break;
+
+        case EXPR_OP_RETURN:
+            *result = top;
+
+            return 0x00;
+        }
+    }
+
+    return -ENUMBERRANGE;
+}
@@ -0,0 +1,80 @@
+#ifndef MATH_VM_H
+#define MATH_VM_H
+
+#include <math/expr.h>
+#include <math/kernel.h>
+#include <math/number.h>
+#include <util/util.h>
+#include <errno.h>
+
+/**
+ * Run a compiled expression
+ *
+ * PARAMETERS
+ * - expr: the program, made by `expr_compile`
+ * - variables: the values of the variables, `EXPR_VARIABLE_COUNT` of them (indexed with
+ *   `EXPR_VARIABLE`). Can be NULL if the expression reads no variables.
+ * - result: where the result is written
+ *
+ * NOTES
+ * - The stack depth was checked when compiling, so this does no bounds checks, and this
+ *   doesn't allocate anything: it can be called for every column of a graph.
+ *
+ * RETURN VALUE
+ * - EDOMAIN: if the result is not a number
+ */
+external error_t expr_evaluate(const expr_t *expr, const double *variables, double *result);
+
+/**
+ * Run a compiled expression with exact rationals
+ *
+ * PARAMETERS
+ * - expr: the program, its tier needs to be `EXPR_TIER_RATIONAL`
+ * - variables: the values of the variables, like in `expr_evaluate`
+ * - result: where the result is written
+ *
+ * RETURN VALUE
+ * - EDOMAIN: on a division by zero
+ * - ENUMBERRANGE: if the expression can't be evaluated with rationals, or a result doesn't
+ *   fit in a `rational_t`, use `expr_evaluate` then
+ */
+external error_t expr_evaluate_rational(const expr_t *expr, const rational_t *variables, rational_t *result);
+
+/**
+ * How precise the functions are in `expr_evaluate_fixed`, enough for Q16.16
+ */
+#define EXPR_FIXED_PRECISION KERNEL_PRECISION_LOW
+
+/**
+ * Run a compiled expression in Q16.16 fixed point, for when the precision of a pixel is
+ * enough (e.g. graphing)
+ *
+ * PARAMETERS
+ * - expr: the program, its tier needs to be `EXPR_TIER_RATIONAL` or `EXPR_TIER_FIXED`
+ * - variables: the values of the variables, like in `expr_evaluate`
+ * - result: where the result is written
+ *
+ * RETURN VALUE
+ * - EDOMAIN: on a division by zero
+ * - ENUMBERRANGE: if the expression can't be evaluated in fixed point, or a result doesn't
+ *   fit in a `fixed_t`
+ */
+external error_t expr_evaluate_fixed(const expr_t *expr, const fixed_t *variables, fixed_t *result);
+
+/**
+ * Choose how precise the functions are in `expr_evaluate`, it's `KERNEL_PRECISION_EXACT` (libm)
+ * by default. `expr_evaluate_fixed` always uses `EXPR_FIXED_PRECISION`.
+ */
+external void expr_set_precision(kernel_precision_t precision);
+
+/**
+ * Apply one of the expression functions to a value
+ */
+external double expr_call(expr_function_t function, double value);
+
+/**
+ * Apply a two operand instruction (`EXPR_OP_ADD` to `EXPR_OP_POWER`)
+ */
+external double expr_apply(expr_op_t op, double left, double right);
+
+#endif /** MATH_VM_H */
@@ -0,0 +1,336 @@
+#!/usr/bin/env python3
+"""
+Rasterizes the 1-bit glyphs of `hal/font_glyphs.h` from a TrueType font: each pixel is set
+when at least half of it is covered by the outline (without hinting), the printable ASCII
+characters are placed on a `WIDTH` x `HEIGHT` cell with the baseline at row `BASELINE`.
+
+    ./tools/font_glyphs.py /usr/share/fonts/truetype/dejavu/DejaVuSansMono-Bold.ttf > hal/font_glyphs.h
+"""
+
+import struct
+import sys
+
+WIDTH = 9
+HEIGHT = 18
+BASELINE = 14
+PIXELS_PER_EM = 15
+
+FIRST_CHAR = 0x20
+LAST_CHAR = 0x7E
+
+# The samples per pixel in each direction, and how many segments a curve is split into
+SAMPLES = 16
+CURVE_SEGMENTS = 16
+
+HEADER = """/**
+ * The glyphs of the font, one `FONT_GLYPH` per character from `FONT_FIRST_CHAR` to
+ * `FONT_LAST_CHAR`, each with `FONT_HEIGHT` rows of `FONT_WIDTH` bits (the MSB is the leftmost
+ * pixel).
+ *
+ * Rasterized from DejaVu Sans Mono Bold at 15 pixels per em, with the baseline at row 14, by
+ * `tools/font_glyphs.py` (the pixels that are at least half covered).
+ *
+ * This file has no include guard, it's included with `FONT_GLYPH` defined to what each
+ * glyph should expand to.
+ */"""
+
+
+class Font:
+    """The outlines of a TrueType font, by character"""
+
+    def __init__(self, path):
+        with open(path, "rb") as file:
+            self.data = file.read()
+
+        count, = struct.unpack_from(">H", self.data, 4)
+
+        self.tables = {}
+
+        for index in range(count):
+            tag, _, offset, length = struct.unpack_from(">4sIII", self.data, 12 + index * 16)
+            self.tables[tag.decode("latin-1")] = (offset, length)
+
+        head = self.tables["head"][0]
+        self.units_per_em, = struct.unpack_from(">H", self.data, head + 18)
+        self.long_offsets = struct.unpack_from(">h", self.data, head + 50)[0] == 1
+
+        self.glyph_count, = struct.unpack_from(">H", self.data, self.tables["maxp"][0] + 4)
+        self.characters = self.read_cmap()
+
+    def read_cmap(self):
+        """The glyph of each character, from the format 4 subtable of the Unicode BMP"""
+        cmap = self.tables["cmap"][0]
+        count, = struct.unpack_from(">H", self.data, cmap + 2)
+
+        for index in range(count):
+            platform, encoding, offset = struct.unpack_from(">HHI", self.data, cmap + 4 + index * 8)
+            subtable = cmap + offset
+
+            if (platform, encoding) in ((3, 1), (0, 3)) and struct.unpack_from(">H", self.data, subtable)[0] == 4:
+                break
+        else:
+            raise ValueError("the font has no Unicode BMP character map")
+
+        segments = struct.unpack_from(">H", self.data, subtable + 6)[0] // 2
+        ends = subtable + 14
+        starts = ends + segments * 2 + 2
+        deltas = starts + segments * 2
+        range_offsets = deltas + segments * 2
+
+        characters = {}
+
+        for segment in range(segments):
+            end, = struct.unpack_from(">H", self.data, ends + segment * 2)
+            start, = struct.unpack_from(">H", self.data, starts + segment * 2)
+            delta, = struct.unpack_from(">h", self.data, deltas + segment * 2)
+            range_offset, = struct.unpack_from(">H", self.data, range_offsets + segment * 2)
+
+            for character in range(max(start, FIRST_CHAR), min(end, LAST_CHAR) + 1):
+                if range_offset == 0:
+                    glyph = (character + delta) & 0xFFFF
+                else:
+                    position = range_offsets + segment * 2 + range_offset + (character - start) * 2
+                    glyph, = struct.unpack_from(">H", self.data, position)
+
+                    if glyph != 0:
+                        glyph = (glyph + delta) & 0xFFFF
+
+                characters[character] = glyph
+
+        return characters
+
+    def glyph_range(self, glyph):
+        loca = self.tables["loca"][0]
+
+        if self.long_offsets:
+            start, end = struct.unpack_from(">II", self.data, loca + glyph * 4)
+        else:
+            start, end = (2 * value for value in struct.unpack_from(">HH", self.data, loca + glyph * 2))
+
+        glyf = self.tables["glyf"][0]
+
+        return glyf + start, end - start
+
+    def contours(self, glyph):
+        """The closed contours of a glyph, lists of `(x, y, on_curve)` in font units"""
+        offset, length = self.glyph_range(glyph)
+
+        if length == 0:
+            return []
+
+        count, = struct.unpack_from(">h", self.data, offset)
+
+        return self.simple_contours(offset, count) if count >= 0 else self.composite_contours(offset)
+
+    def simple_contours(self, offset, count):
+        position = offset + 10
+        ends = struct.unpack_from(f">{count}H", self.data, position)
+        position += count * 2
+        instructions, = struct.unpack_from(">H", self.data, position)
+        position += 2 + instructions
+
+        points = ends[-1] + 1 if count > 0 else 0
+        flags = []
+
+        while len(flags) < points:
+            flag = self.data[position]
+            position += 1
+            flags.append(flag)
+
+            if flag & 0x08:
+                flags.extend([flag] * self.data[position])
+                position += 1
+
+        def coordinates(short, same):
+            nonlocal position
+
+            values = []
+            value = 0
+
+            for flag in flags:
+                if flag & short:
+                    delta = self.data[position]
+                    position += 1
+                    value += delta if flag & same else -delta
+                elif not flag & same:
+                    value += struct.unpack_from(">h", self.data, position)[0]
+                    position += 2
+
+                values.append(value)
+
+            return values
+
+        xs = coordinates(0x02, 0x10)
+        ys = coordinates(0x04, 0x20)
+
+        contours = []
+        start = 0
+
+        for end in ends:
+            contours.append([(xs[index], ys[index], bool(flags[index] & 0x01)) for index in range(start, end + 1)])
+            start = end + 1
+
+        return contours
+
+    def composite_contours(self, offset):
+        position = offset + 10
+        contours = []
+
+        while True:
+            flags, glyph = struct.unpack_from(">HH", self.data, position)
+            position += 4
+
+            if flags & 0x0001:
+                dx, dy = struct.unpack_from(">hh", self.data, position)
+                position += 4
+            else:
+                dx, dy = struct.unpack_from(">bb", self.data, position)
+                position += 2
+
+            if not flags & 0x0002:
+                raise ValueError("point-matched components aren't supported")
+
+            xx, xy, yx, yy = 1.0, 0.0, 0.0, 1.0
+
+            if flags & 0x0008:
+                xx = yy = struct.unpack_from(">h", self.data, position)[0] / 16384
+                position += 2
+            elif flags & 0x0040:
+                xx, yy = (value / 16384 for value in struct.unpack_from(">hh", self.data, position))
+                position += 4
+            elif flags & 0x0080:
+                xx, xy, yx, yy = (value / 16384 for value in struct.unpack_from(">hhhh", self.data, position))
+                position += 8
+
+            for contour in self.contours(glyph):
+                contours.append([(x * xx + y * yx + dx, x * xy + y * yy + dy, on) for x, y, on in contour])
+
+            if not flags & 0x0020:
+                return contours
+
+
+def flatten(contour):
+    """The polygon of a quadratic contour, a point between two off-curve points is implied"""
+    if not any(on for _, _, on in contour):
+        contour = [((x0 + x1) / 2, (y0 + y1) / 2, True) for (x0, y0, _), (x1, y1, _) in zip(contour, contour[1:] + contour[:1])]
+
+    start = next(index for index, (_, _, on) in enumerate(contour) if on)
+    contour = contour[start:] + contour[:start]
+
+    points = [contour[0][:2]]
+    control = None
+
+    for x, y, on in contour[1:] + contour[:1]:
+        if on:
+            if control is None:
+                points.append((x, y))
+            else:
+                points.extend(curve(points[-1], control, (x, y)))
+                control = None
+        elif control is None:
+            control = (x, y)
+        else:
+            middle = ((control[0] + x) / 2, (control[1] + y) / 2)
+            points.extend(curve(points[-1], control, middle))
+            control = (x, y)
+
+    return points
+
+
+def curve(start, control, end):
+    points = []
+
+    for step in range(1, CURVE_SEGMENTS + 1):
+        t = step / CURVE_SEGMENTS
+        u = 1 - t
+        points.append((
+            u * u * start[0] + 2 * u * t * control[0] + t * t * end[0],
+            u * u * start[1] + 2 * u * t * control[1] + t * t * end[1]
+        ))
+
+    return points
+
+
+def rasterize(polygons):
+    """The coverage of each pixel of the cell, from `SAMPLES` x `SAMPLES` samples with the
+    nonzero winding rule"""
+    edges = []
+
+    for polygon in polygons:
+        for (x0, y0), (x1, y1) in zip(polygon, polygon[1:] + polygon[:1]):
+            if y0 != y1:
+                edges.append((x0, y0, x1, y1))
+
+    coverage = [[0] * WIDTH for _ in range(HEIGHT)]
+
+    for sample_row in range(HEIGHT * SAMPLES):
+        y = (sample_row + 0.5) / SAMPLES
+        crossings = []
+
+        for x0, y0, x1, y1 in edges:
+            if min(y0, y1) <= y < max(y0, y1):
+                crossings.append((x0 + (y - y0) * (x1 - x0) / (y1 - y0), 1 if y1 > y0 else -1))
+
+        crossings.sort()
+        winding = 0
+
+        for (x, direction), (next_x, _) in zip(crossings, crossings[1:]):
+            winding += direction
+
+            if winding == 0:
+                continue
+
+            first = max(0, int(x * SAMPLES + 0.5))
+            last = min(WIDTH * SAMPLES, int(next_x * SAMPLES + 0.5))
+
+            for sample in range(first, last):
+                coverage[sample_row // SAMPLES][sample // SAMPLES] += 1
+
+    return coverage
+
+
+def glyph_rows(font, character):
+    scale = PIXELS_PER_EM / font.units_per_em
+    polygons = []
+
+    # The cell's rows go down from its top, the font's units up from the baseline
+    for contour in font.contours(font.characters.get(character, 0)):
+        polygons.append([(x * scale, BASELINE - y * scale) for x, y in flatten(contour)])
+
+    rows = []
+
+    for coverage in rasterize(polygons):
+        bits = 0
+
+        for column, samples in enumerate(coverage):
+            if 2 * samples >= SAMPLES * SAMPLES:
+                bits |= 1 << (WIDTH - 1 - column)
+
+        rows.append(bits)
+
+    return rows
+
+
+def label(character):
+    text = {"'": "\\'", "\\": "\\\\"}.get(chr(character), chr(character))
+
+    return f"'{text}'".ljust(4)
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(f"usage: {sys.argv[0]} <font.ttf>", file=sys.stderr)
+        sys.exit(1)
+
+    font = Font(sys.argv[1])
+
+    print(HEADER)
+
+    for character in range(FIRST_CHAR, LAST_CHAR + 1):
+        rows = ", ".join(f"0x{row:03X}" for row in glyph_rows(font, character))
+
+        print(f"/* {label(character)} */ FONT_GLYPH({rows})")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+"""
+Formats the logs of a firmware built with `LOG_DEFERRED_FORMAT`: the `#log ` lines only have
+the addresses of the format and prefix strings, and the raw arguments, the strings are read
+from the firmware's ELF. Every other line is printed as it is.
+
+    picocom /dev/ttyACM0 | ./tools/log_decode.py build/descartex.elf
+"""
+
+import re
+import struct
+import sys
+
+SPEC = re.compile(r"%[-+ #0-9.*]*(hh|h|ll|l|z|j|t|L)?([diuxXoceEfFgGaAsp%])")
+
+# The argument sizes of the RP2040 (ILP32)
+SIZES = {"int": 4, "long": 4, "long long": 8, "size": 4, "pointer": 4, "double": 8}
+
+
+class Elf:
+    """The allocated sections of a 32-bit little endian ELF, to read strings by address"""
+
+    def __init__(self, path):
+        with open(path, "rb") as file:
+            self.data = file.read()
+
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1 or self.data[5] != 1:
+            raise ValueError(f"{path} is not a 32-bit little endian ELF")
+
+        shoff, = struct.unpack_from("<I", self.data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", self.data, 0x2E)
+
+        self.sections = []
+
+        for index in range(shnum):
+            _, kind, flags, address, offset, size = struct.unpack_from("<IIIIII", self.data, shoff + index * shentsize)
+
+            # SHT_PROGBITS and SHF_ALLOC
+            if kind == 1 and flags & 0x2:
+                self.sections.append((address, offset, size))
+
+    def string(self, address):
+        for start, offset, size in self.sections:
+            if start <= address < start + size:
+                position = offset + address - start
+                end = self.data.index(b"\0", position)
+
+                return self.data[position:end].decode("utf-8", "replace")
+
+        return f"<0x{address:08x}>"
+
+
+def argument_type(length, conversion):
+    if conversion in "eEfFgGaA":
+        return "double"
+    if conversion == "s":
+        return "string"
+    if conversion == "p":
+        return "pointer"
+    if length in ("ll", "j"):
+        return "long long"
+    if length == "l":
+        return "long"
+    if length in ("z", "t"):
+        return "size"
+    return "int"
+
+
+def format_record(format, data):
+    """Like `log_print` in util/log.c: the arguments are aligned to their size"""
+    output = []
+    offset = 0
+    position = 0
+
+    def read(kind):
+        nonlocal offset
+
+        if kind == "string":
+            end = data.find(b"\0", offset)
+
+            if end < 0:
+                return None
+
+            value = data[offset:end].decode("utf-8", "replace")
+            offset = end + 1
+
+            return value
+
+        size = SIZES[kind]
+        offset = (offset + size - 1) & ~(size - 1)
+
+        if offset + size > len(data):
+            return None
+
+        code = {"int": "<i", "long": "<i", "long long": "<q", "size": "<I", "pointer": "<I", "double": "<d"}[kind]
+        value, = struct.unpack_from(code, data, offset)
+        offset += size
+
+        return value
+
+    for match in SPEC.finditer(format):
+        output.append(format[position:match.start()])
+        position = match.end()
+
+        length, conversion = match.group(1), match.group(2)
+
+        if conversion == "%":
+            output.append("%")
+            continue
+
+        stars = [read("int") for _ in range(match.group(0).count("*"))]
+        value = read(argument_type(length, conversion))
+
+        if value is None or None in stars:
+            output.append("...")
+            position = len(format)
+            break
+
+        # Python has no length modifiers, `%u` or `%p`
+        spec = match.group(0)
+
+        if length:
+            spec = spec[:-1 - len(length)] + spec[-1]
+
+        # The unsigned conversions of a negative value print its two's complement
+        if conversion in "uxXo":
+            value &= 0xFFFFFFFFFFFFFFFF if argument_type(length, conversion) == "long long" else 0xFFFFFFFF
+
+        if conversion == "u":
+            spec = spec[:-1] + "d"
+        elif conversion == "p":
+            spec, value = "0x%08x", value
+
+        output.append(spec % (*stars, value))
+
+    output.append(format[position:])
+
+    return "".join(output)
+
+
+def decode(elf, line):
+    record = bytes.fromhex(line[len("#log "):].strip())
+
+    flags, timestamp, format, prefix = struct.unpack_from("<BQII", record, 0)
+    offset = 17
+    location = ""
+
+    if flags & 1:
+        function, file, number = struct.unpack_from("<IIi", record, offset)
+        offset += 12
+        location = f"[{elf.string(function)}({elf.string(file)}:{number})] "
+
+    size = record[offset]
+    data = record[offset + 1:offset + 1 + size]
+
+    seconds, microseconds = divmod(timestamp, 1000000)
+    message = format_record(elf.string(format), data)
+
+    return f"[{seconds:9d}.{microseconds:06d}] {location}{elf.string(prefix)}: {message}"
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(f"usage: {sys.argv[0]} <firmware.elf>", file=sys.stderr)
+
+        return 1
+
+    elf = Elf(sys.argv[1])
+
+    for line in sys.stdin:
+        if line.startswith("#log "):
+            try:
+                line = decode(elf, line) + "\n"
+            except (ValueError, struct.error, IndexError) as error:
+                line = f"<bad log record: {error}> {line}"
+
+        sys.stdout.write(line)
+        sys.stdout.flush()
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
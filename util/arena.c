@@ -0,0 +1,37 @@
+#include <util/arena.h>
+#include <util/log.h>
+
+void arena_init(arena_t *arena, void *buffer, size_t size, const char *name) {
+    arena->base = buffer;
+    arena->size = size;
+    arena->used = 0;
+    arena->high_water = 0;
+    arena->name = name;
+}
+
+void *arena_alloc(arena_t *arena, size_t size) {
+    size_t start = (arena->used + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1);
+
+    if (start > arena->size || size > arena->size - start) {
+        return NULL;
+    }
+
+    arena->used = start + size;
+
+    if (arena->used > arena->high_water) {
+        arena->high_water = arena->used;
+    }
+
+    return &arena->base[start];
+}
+
+void arena_report(const arena_t *arena) {
+    LOG(
+        "arena",
+        "%s: %u/%u bytes at most (%u in use)",
+        arena->name,
+        (unsigned) arena->high_water,
+        (unsigned) arena->size,
+        (unsigned) arena->used
+    );
+}
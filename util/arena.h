@@ -0,0 +1,101 @@
+#ifndef UTIL_ARENA_H
+#define UTIL_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+
+/**
+ * A bump allocator over a fixed buffer: allocating is moving a pointer, and everything is
+ * freed at once with `arena_reset` (or back to a mark with `arena_rewind`), so there's no
+ * fragmentation and no `malloc`.
+ *
+ * An arena is not thread safe, each one needs to be used by only one core.
+ */
+typedef struct arena_t
+{
+    /**
+     * The buffer the allocations are taken from
+     */
+    byte        *base;
+    size_t      size;
+
+    /**
+     * How many bytes of the buffer are in use
+     */
+    size_t      used;
+
+    /**
+     * The most bytes that were ever in use at once, see `arena_report`
+     */
+    size_t      high_water;
+
+    /**
+     * How the arena is called in the logs
+     */
+    const char  *name;
+} arena_t;
+
+/**
+ * A point of an arena that can be rewound to
+ */
+typedef size_t arena_mark_t;
+
+/**
+ * Every allocation is aligned to this, enough for a `double` or a `uint64_t`
+ */
+#define ARENA_ALIGNMENT 8
+
+/**
+ * Allocate `count` items of `type` in an arena
+ */
+#define arena_new(arena, type, count) ((type *) arena_alloc((arena), sizeof(type) * (count)))
+
+/**
+ * Initialize an arena
+ *
+ * PARAMETERS
+ * - arena: the arena to initialize
+ * - buffer: the memory the allocations are taken from, aligned to `ARENA_ALIGNMENT`
+ * - size: the size of the buffer
+ * - name: how the arena is called in the logs
+ */
+external void arena_init(arena_t *arena, void *buffer, size_t size, const char *name);
+
+/**
+ * Allocate memory from an arena
+ *
+ * RETURN VALUE
+ * - NULL if there's not enough space left
+ */
+external void *arena_alloc(arena_t *arena, size_t size);
+
+/**
+ * Get the current point of an arena, everything allocated after it can be freed with
+ * `arena_rewind`
+ */
+static force_inline arena_mark_t arena_mark(const arena_t *arena) {
+    return arena->used;
+}
+
+/**
+ * Free everything allocated after a mark
+ */
+static force_inline void arena_rewind(arena_t *arena, arena_mark_t mark) {
+    arena->used = mark;
+}
+
+/**
+ * Free everything allocated in an arena
+ */
+static force_inline void arena_reset(arena_t *arena) {
+    arena->used = 0;
+}
+
+/**
+ * Log the high water mark of an arena
+ */
+external void arena_report(const arena_t *arena);
+
+#endif /** UTIL_ARENA_H */
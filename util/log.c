@@ -1,10 +1,224 @@
-#include <pico/time.h>
+#include <hardware/sync.h>
+#include <hardware/timer.h>
+#include <pico.h>
 #include <pico/types.h>
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdio.h>
-#include <hardware/clocks.h>
-#include <util/time.h>
+#include <string.h>
 #include <util/log.h>
+#include <util/spsc.h>
+#include <util/time.h>
+
+#define LOG_CORE_COUNT 2
+
+/**
+ * The kind of argument a conversion of the format reads
+ */
+typedef enum log_argument_t: byte
+{
+    LOG_ARGUMENT_NONE       = 0x00,
+    LOG_ARGUMENT_INT        = 0x01,
+    LOG_ARGUMENT_LONG       = 0x02,
+    LOG_ARGUMENT_LONG_LONG  = 0x03,
+    LOG_ARGUMENT_SIZE       = 0x04,
+    LOG_ARGUMENT_POINTER    = 0x05,
+    LOG_ARGUMENT_DOUBLE     = 0x06,
+    LOG_ARGUMENT_STRING     = 0x07
+} log_argument_t;
+
+/**
+ * A conversion of the format, from its `%` to its conversion character
+ */
+typedef struct log_spec_t
+{
+    const char      *start;
+    size_t          length;
+
+    /** How many `*` (width and precision, each reads an `int` before the value) */
+    uint8_t         stars;
+
+    log_argument_t  type;
+} log_spec_t;
+
+internal log_record_t records[LOG_CORE_COUNT][LOG_QUEUE_SIZE];
+
+/**
+ * The rings are ready at boot, so anything can log before `main` sets anything up
+ */
+internal spsc_queue_t queues[LOG_CORE_COUNT] = {
+    { .items = (byte *) records[0], .item_size = sizeof(log_record_t), .capacity = LOG_QUEUE_SIZE },
+    { .items = (byte *) records[1], .item_size = sizeof(log_record_t), .capacity = LOG_QUEUE_SIZE }
+};
+
+/**
+ * The records that didn't fit in each ring, only written by the producers
+ */
+internal volatile uint32_t dropped[LOG_CORE_COUNT];
+
+/**
+ * Owned by the drain: the oldest record of each ring, to print both rings in order
+ */
+internal log_record_t pending[LOG_CORE_COUNT];
+internal bool has_pending[LOG_CORE_COUNT];
+internal uint32_t dropped_reported[LOG_CORE_COUNT];
+
+/******************** FORMAT *************************/
+
+/**
+ * Parse the conversion starting at the `%` of `format`
+ *
+ * RETURN VALUE
+ * - where the format continues after the conversion
+ */
+internal const char *log_parse_spec(const char *format, log_spec_t *spec) {
+    const char *at = format + 1;
+
+    spec->start = format;
+    spec->stars = 0;
+    spec->type = LOG_ARGUMENT_NONE;
+
+    // Flags, width and precision
+    while (*at != '\0' && strchr("-+ #0123456789.*", *at) != NULL) {
+        spec->stars += *at++ == '*';
+    }
+
+    log_argument_t integer = LOG_ARGUMENT_INT;
+
+    // Length modifiers
+    while (*at != '\0' && strchr("hlzjtL", *at) != NULL) {
+        switch (*at++) {
+        case 'l': integer = integer == LOG_ARGUMENT_LONG ? LOG_ARGUMENT_LONG_LONG : LOG_ARGUMENT_LONG; break;
+        case 'j': integer = LOG_ARGUMENT_LONG_LONG; break;
+        case 'z':
+        case 't': integer = LOG_ARGUMENT_SIZE; break;
+        default:  break;
+        }
+    }
+
+    switch (*at) {
+    case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+        spec->type = integer;
+        break;
+
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+        spec->type = LOG_ARGUMENT_DOUBLE;
+        break;
+
+    case 's':
+        spec->type = LOG_ARGUMENT_STRING;
+        break;
+
+    case 'p':
+        spec->type = LOG_ARGUMENT_POINTER;
+        break;
+
+    default:
+        break;
+    }
+
+    if (*at != '\0') {
+        at++;
+    }
+
+    spec->length = at - format;
+
+    return at;
+}
+
+internal size_t log_argument_size(log_argument_t type) {
+    switch (type) {
+    case LOG_ARGUMENT_INT:          return sizeof(int);
+    case LOG_ARGUMENT_LONG:         return sizeof(long);
+    case LOG_ARGUMENT_LONG_LONG:    return sizeof(long long);
+    case LOG_ARGUMENT_SIZE:         return sizeof(size_t);
+    case LOG_ARGUMENT_POINTER:      return sizeof(void *);
+    case LOG_ARGUMENT_DOUBLE:       return sizeof(double);
+    default:                        return 0;
+    }
+}
+
+/**
+ * Where the next argument of a type goes in the record's data, aligned to its size
+ */
+internal size_t log_align(size_t offset, log_argument_t type) {
+    size_t size = log_argument_size(type);
+
+    return size > 1 ? (offset + size - 1) & ~(size - 1) : offset;
+}
+
+/******************** PRODUCERS *************************/
+
+/**
+ * Copy the arguments into the record, stops at the first one that doesn't fit
+ */
+internal void log_pack(log_record_t *record, const char *format, va_list args) {
+    size_t offset = 0;
+
+    while ((format = strchr(format, '%')) != NULL) {
+        log_spec_t spec;
+
+        format = log_parse_spec(format, &spec);
+
+        for (uint8_t star = 0; star < spec.stars; star++) {
+            int value = va_arg(args, int);
+
+            offset = log_align(offset, LOG_ARGUMENT_INT);
+
+            if (offset + sizeof(value) > LOG_RECORD_DATA) {
+                return;
+            }
+
+            memcpy(&record->data[offset], &value, sizeof(value));
+            offset += sizeof(value);
+            record->size = offset;
+        }
+
+        if (spec.type == LOG_ARGUMENT_STRING) {
+            const char *value = va_arg(args, const char *);
+            size_t length = value != NULL ? strlen(value) : 0;
+
+            if (offset >= LOG_RECORD_DATA) {
+                return;
+            }
+
+            // A string that doesn't fit is cut, the arguments after it are dropped
+            length = MIN(length, LOG_RECORD_DATA - offset - 1);
+
+            memcpy(&record->data[offset], value, length);
+            record->data[offset + length] = '\0';
+            offset += length + 1;
+            record->size = offset;
+
+            continue;
+        }
+
+        size_t size = log_argument_size(spec.type);
+
+        if (size == 0) {
+            continue;
+        }
+
+        offset = log_align(offset, spec.type);
+
+        if (offset + size > LOG_RECORD_DATA) {
+            return;
+        }
+
+        switch (spec.type) {
+        case LOG_ARGUMENT_INT:       { int value = va_arg(args, int);                memcpy(&record->data[offset], &value, size); break; }
+        case LOG_ARGUMENT_LONG:      { long value = va_arg(args, long);              memcpy(&record->data[offset], &value, size); break; }
+        case LOG_ARGUMENT_LONG_LONG: { long long value = va_arg(args, long long);    memcpy(&record->data[offset], &value, size); break; }
+        case LOG_ARGUMENT_SIZE:      { size_t value = va_arg(args, size_t);          memcpy(&record->data[offset], &value, size); break; }
+        case LOG_ARGUMENT_POINTER:   { void *value = va_arg(args, void *);           memcpy(&record->data[offset], &value, size); break; }
+        case LOG_ARGUMENT_DOUBLE:    { double value = va_arg(args, double);          memcpy(&record->data[offset], &value, size); break; }
+        default:                     break;
+        }
+
+        offset += size;
+        record->size = offset;
+    }
+}
 
 void __log_impl(
     const char *prefix,
@@ -31,17 +245,232 @@ void __logv_impl(
     const char *format,
     va_list args
 ) {
-    printf(
-        "[%16.08f] ",
-        to_us_since_boot(get_absolute_time()) / (ONE_SECOND_IN_MICROSECONDS * 1.)
-    );
+    log_record_t record;
+
+    record.timestamp = time_us_64();
+    record.prefix = prefix;
+    record.format = format;
+    record.size = 0;
+
+#if LOG_WITH_LOCATION
+    record.function = function;
+    record.file = file;
+    record.line = line;
+#endif
+
+    log_pack(&record, format, args);
+
+    // The thread mode and the IRQ handlers of this core share its ring, only this core's
+    // interrupts need to be masked for the copy
+    uint core = get_core_num();
+    uint32_t status = save_and_disable_interrupts();
+
+    if (!spsc_queue_push(&queues[core], &record)) {
+        dropped[core]++;
+    }
+
+    restore_interrupts(status);
+}
 
-#if 0
-    printf("[%s(%s:%d)] ", function, file, line);
+/******************** DRAIN *************************/
+
+#if LOG_DEFERRED_FORMAT
+
+internal void log_print_hex(const void *data, size_t size) {
+    static const char digits[] = "0123456789abcdef";
+
+    for (size_t index = 0; index < size; index++) {
+        byte value = ((const byte *) data)[index];
+
+        putchar(digits[value >> 4]);
+        putchar(digits[value & 0x0F]);
+    }
+}
+
+/**
+ * Send a record as it is, the host formats it (see `tools/log_decode.py`):
+ *   `#log <flags> <timestamp> <format> <prefix> [<function> <file> <line>] <size> <data>`
+ * all as little endian hex bytes without the spaces, the flags are 1 if the location is sent
+ */
+internal void log_print(const log_record_t *record) {
+    uint32_t format = (uint32_t) (uintptr_t) record->format;
+    uint32_t prefix = (uint32_t) (uintptr_t) record->prefix;
+    byte flags = LOG_WITH_LOCATION;
+
+    fputs("#log ", stdout);
+
+    log_print_hex(&flags, sizeof(flags));
+    log_print_hex(&record->timestamp, sizeof(record->timestamp));
+    log_print_hex(&format, sizeof(format));
+    log_print_hex(&prefix, sizeof(prefix));
+
+#if LOG_WITH_LOCATION
+    uint32_t function = (uint32_t) (uintptr_t) record->function;
+    uint32_t file = (uint32_t) (uintptr_t) record->file;
+    int32_t line = record->line;
+
+    log_print_hex(&function, sizeof(function));
+    log_print_hex(&file, sizeof(file));
+    log_print_hex(&line, sizeof(line));
+#endif
+
+    log_print_hex(&record->size, sizeof(record->size));
+    log_print_hex(record->data, record->size);
+
+    putchar('\n');
+}
+
+#else
+
+internal void log_print_value(const log_spec_t *spec, const int *stars, log_argument_t type, const byte *data) {
+    char format[16];
+    size_t length = MIN(spec->length, sizeof(format) - 1);
+
+    memcpy(format, spec->start, length);
+    format[length] = '\0';
+
+    // Only the `*`s change how many arguments printf gets, the value is always last
+#define LOG_PRINT(value)                                                        \
+    switch (spec->stars) {                                                      \
+    case 0:  printf(format, value); break;                                      \
+    case 1:  printf(format, stars[0], value); break;                            \
+    default: printf(format, stars[0], stars[1], value); break;                  \
+    }
+
+    switch (type) {
+    case LOG_ARGUMENT_INT:       { int value;       memcpy(&value, data, sizeof(value)); LOG_PRINT(value); break; }
+    case LOG_ARGUMENT_LONG:      { long value;      memcpy(&value, data, sizeof(value)); LOG_PRINT(value); break; }
+    case LOG_ARGUMENT_LONG_LONG: { long long value; memcpy(&value, data, sizeof(value)); LOG_PRINT(value); break; }
+    case LOG_ARGUMENT_SIZE:      { size_t value;    memcpy(&value, data, sizeof(value)); LOG_PRINT(value); break; }
+    case LOG_ARGUMENT_POINTER:   { void *value;     memcpy(&value, data, sizeof(value)); LOG_PRINT(value); break; }
+    case LOG_ARGUMENT_DOUBLE:    { double value;    memcpy(&value, data, sizeof(value)); LOG_PRINT(value); break; }
+    case LOG_ARGUMENT_STRING:    { const char *value = (const char *) data;              LOG_PRINT(value); break; }
+    default:                     break;
+    }
+
+#undef LOG_PRINT
+}
+
+/**
+ * Format a record like printf would have, from its packed arguments
+ */
+internal void log_print(const log_record_t *record) {
+    uint32_t seconds = (uint32_t) (record->timestamp / ONE_SECOND_IN_MICROSECONDS);
+    uint32_t microseconds = (uint32_t) (record->timestamp % ONE_SECOND_IN_MICROSECONDS);
+
+    printf("[%9lu.%06lu] ", (unsigned long) seconds, (unsigned long) microseconds);
+
+#if LOG_WITH_LOCATION
+    printf("[%s(%s:%d)] ", record->function, record->file, record->line);
 #endif
 
-    printf("%s: ", prefix);
-    vprintf(format, args);
+    printf("%s: ", record->prefix);
+
+    const char *format = record->format;
+    size_t offset = 0;
+
+    for (;;) {
+        const char *next = strchr(format, '%');
+        size_t literal = next != NULL ? (size_t) (next - format) : strlen(format);
+
+        fwrite(format, 1, literal, stdout);
+
+        if (next == NULL) {
+            break;
+        }
+
+        log_spec_t spec;
+        int stars[2] = { 0 };
+
+        format = log_parse_spec(next, &spec);
 
-    printf("\n");
-}
\ No newline at end of file
+        if (spec.type == LOG_ARGUMENT_NONE) {
+            // `%%`, or a conversion that reads nothing
+            if (spec.length == 2 && next[1] == '%') {
+                putchar('%');
+            }
+
+            continue;
+        }
+
+        for (uint8_t star = 0; star < spec.stars && star < 2; star++) {
+            offset = log_align(offset, LOG_ARGUMENT_INT);
+
+            if (offset + sizeof(int) <= record->size) {
+                memcpy(&stars[star], &record->data[offset], sizeof(int));
+            }
+
+            offset += sizeof(int);
+        }
+
+        size_t size = spec.type == LOG_ARGUMENT_STRING
+            ? strnlen((const char *) &record->data[MIN(offset, record->size)], record->size - MIN(offset, record->size)) + 1
+            : log_argument_size(spec.type);
+
+        if (spec.type != LOG_ARGUMENT_STRING) {
+            offset = log_align(offset, spec.type);
+        }
+
+        if (offset + size > record->size) {
+            // The rest of the arguments didn't fit in the record
+            fputs("...", stdout);
+
+            break;
+        }
+
+        log_print_value(&spec, stars, spec.type, &record->data[offset]);
+
+        offset += size;
+    }
+
+    putchar('\n');
+}
+
+#endif
+
+size_t log_drain(size_t max) {
+    size_t count = 0;
+
+    while (count < max) {
+        int next = -1;
+
+        for (int core = 0; core < LOG_CORE_COUNT; core++) {
+            if (!has_pending[core]) {
+                has_pending[core] = spsc_queue_pop(&queues[core], &pending[core]);
+            }
+
+            if (has_pending[core] && (next < 0 || pending[core].timestamp < pending[next].timestamp)) {
+                next = core;
+            }
+        }
+
+        if (next < 0) {
+            break;
+        }
+
+        log_print(&pending[next]);
+
+        has_pending[next] = false;
+        count++;
+    }
+
+    for (int core = 0; core < LOG_CORE_COUNT; core++) {
+        uint32_t lost = dropped[core];
+
+        if (lost != dropped_reported[core]) {
+            printf("log: %lu messages of core %d were dropped\n", (unsigned long) (lost - dropped_reported[core]), core);
+
+            dropped_reported[core] = lost;
+        }
+    }
+
+    if (count > 0) {
+        fflush(stdout);
+    }
+
+    return count;
+}
+
+void log_flush(void) {
+    while (log_drain(LOG_QUEUE_SIZE) != 0);
+}
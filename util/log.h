@@ -1,11 +1,110 @@
 #ifndef UTIL_LOG_H
 #define UTIL_LOG_H
 
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <util/util.h>
+#include <util/types.h>
 #pragma once
 
-#define LOG(prefix, ...) __log_impl(prefix, __FUNCTION__, __FILE_NAME__, __LINE__, __VA_ARGS__)
-#define LOGV(prefix, ...) __logv_impl(prefix, __FUNCTION__, __FILE_NAME__, __LINE__, __VA_ARGS__)
+/**
+ * Logging never blocks: `LOG` only packs its arguments into a record, and the records are
+ * formatted and printed later by `log_drain`, from core 0's thread mode.
+ *
+ * Each core has its own ring of records, the thread mode and the IRQ handlers of a core
+ * write to it with the interrupts of that core masked for the copy (the M0+ has no atomic
+ * instructions, but the two cores never write to the same ring). If a ring is full, the
+ * record is dropped and counted.
+ */
+
+/**
+ * How many records each core's ring holds, needs to be a power of two
+ */
+#define LOG_QUEUE_SIZE      32
+
+/**
+ * The bytes of arguments a record holds, `%s` strings are copied in (they can be gone by
+ * the time the record is printed), the arguments that don't fit are printed as `...`
+ */
+#define LOG_RECORD_DATA     40
+
+/**
+ * How much is logged, every message has one of these levels and is only compiled in if it's
+ * at most the level of its module
+ */
+#define LOG_LEVEL_NONE      0
+#define LOG_LEVEL_ERROR     1
+#define LOG_LEVEL_WARNING   2
+#define LOG_LEVEL_INFO      3
+#define LOG_LEVEL_DEBUG     4
+
+/**
+ * The level of the modules that don't set their own (with `-D<MODULE>_LOG_LEVEL=...`)
+ */
+#ifndef LOG_LEVEL
+#   define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+/**
+ * If the function, file and line of each message are kept and printed, they're left out of
+ * the firmware otherwise
+ */
+#ifndef LOG_WITH_LOCATION
+#   define LOG_WITH_LOCATION 0
+#endif
+
+/**
+ * If the drain sends records as they are, hex encoded on lines starting with `#log `,
+ * instead of formatting them: the format and prefix are sent as their addresses, and
+ * `tools/log_decode.py` formats them on the host with the firmware's ELF
+ */
+#ifndef LOG_DEFERRED_FORMAT
+#   define LOG_DEFERRED_FORMAT 0
+#endif
+
+#if LOG_WITH_LOCATION
+#   define LOG_LOCATION __FUNCTION__, __FILE_NAME__, __LINE__
+#else
+#   define LOG_LOCATION NULL, NULL, 0
+#endif
+
+/**
+ * Log a message if `level` is at most `module_level`, both are constants so a message that
+ * is filtered out compiles to nothing (its format and arguments included)
+ */
+#define LOG_AT(module_level, level, prefix, ...) \
+    do { if ((level) <= (module_level)) __log_impl(prefix, LOG_LOCATION, __VA_ARGS__); } while (0)
+
+#define LOG(prefix, ...)            LOG_AT(LOG_LEVEL, LOG_LEVEL_INFO, prefix, __VA_ARGS__)
+#define LOG_ERROR(prefix, ...)      LOG_AT(LOG_LEVEL, LOG_LEVEL_ERROR, prefix, __VA_ARGS__)
+#define LOG_WARNING(prefix, ...)    LOG_AT(LOG_LEVEL, LOG_LEVEL_WARNING, prefix, __VA_ARGS__)
+#define LOG_DEBUG(prefix, ...)      LOG_AT(LOG_LEVEL, LOG_LEVEL_DEBUG, prefix, __VA_ARGS__)
+
+#define LOGV(prefix, ...) __logv_impl(prefix, LOG_LOCATION, __VA_ARGS__)
+
+/**
+ * A message waiting to be printed
+ */
+typedef struct log_record_t
+{
+    /** The time of the message, in microseconds since boot */
+    uint64_t    timestamp;
+
+    const char  *prefix;
+    const char  *format;
+
+#if LOG_WITH_LOCATION
+    const char  *function;
+    const char  *file;
+    int         line;
+#endif
+
+    /** The arguments, packed in the order of the format (8-byte values are aligned) */
+    uint8_t     size;
+    byte        __attribute__((aligned(8))) data[LOG_RECORD_DATA];
+} log_record_t;
 
 void __attribute__((format(printf, 5, 6))) __log_impl(
     const char *prefix,
@@ -25,4 +124,24 @@ void __logv_impl(
     va_list args
 );
 
-#endif /** UTIL_LOG_H */
\ No newline at end of file
+/**
+ * Print the oldest records, of both cores in the order they were logged
+ *
+ * PARAMETERS
+ * - max: the most records to print
+ *
+ * NOTES
+ * - This is the only consumer of the rings: only call it from core 0, not from an IRQ
+ *   handler (stdio can't be used there).
+ *
+ * RETURN VALUE
+ * - how many records were printed
+ */
+external size_t log_drain(size_t max);
+
+/**
+ * Print every record waiting, like `log_drain`
+ */
+external void log_flush(void);
+
+#endif /** UTIL_LOG_H */
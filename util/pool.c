@@ -0,0 +1,59 @@
+#include <assert.h>
+#include <util/log.h>
+#include <util/pool.h>
+
+void pool_init(pool_t *pool, void *items, size_t item_size, uint16_t capacity, const char *name) {
+    assert(item_size >= sizeof(void *));
+
+    pool->items = items;
+    pool->item_size = item_size;
+    pool->capacity = capacity;
+    pool->free = NULL;
+    pool->used = 0;
+    pool->high_water = 0;
+    pool->name = name;
+
+    // Link the items backwards, so the first one is the first to be taken
+    for (uint16_t index = capacity; index > 0; index--) {
+        void *item = &pool->items[(index - 1) * item_size];
+
+        *(void **) item = pool->free;
+        pool->free = item;
+    }
+}
+
+void *pool_alloc(pool_t *pool) {
+    void *item = pool->free;
+
+    if (item == NULL) {
+        return NULL;
+    }
+
+    pool->free = *(void **) item;
+    pool->used++;
+
+    if (pool->used > pool->high_water) {
+        pool->high_water = pool->used;
+    }
+
+    return item;
+}
+
+void pool_free(pool_t *pool, void *item) {
+    assert((byte *) item >= pool->items && (byte *) item < pool->items + pool->capacity * pool->item_size);
+
+    *(void **) item = pool->free;
+    pool->free = item;
+    pool->used--;
+}
+
+void pool_report(const pool_t *pool) {
+    LOG(
+        "pool",
+        "%s: %u/%u items at most (%u in use)",
+        pool->name,
+        pool->high_water,
+        pool->capacity,
+        pool->used
+    );
+}
@@ -0,0 +1,72 @@
+#ifndef UTIL_POOL_H
+#define UTIL_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+
+/**
+ * A pool of fixed-size items over a fixed buffer, allocating and freeing are O(1) (the free
+ * items are linked through their own storage), and as every item is the same size there's
+ * no fragmentation.
+ *
+ * A pool is not thread safe, each one needs to be used by only one core.
+ */
+typedef struct pool_t
+{
+    /**
+     * The storage for `capacity` items of `item_size` bytes
+     */
+    byte        *items;
+    size_t      item_size;
+    uint16_t    capacity;
+
+    /**
+     * The first free item, each free item starts with a pointer to the next one
+     */
+    void        *free;
+
+    /**
+     * How many items are allocated, and the most that ever were at once
+     */
+    uint16_t    used;
+    uint16_t    high_water;
+
+    /**
+     * How the pool is called in the logs
+     */
+    const char  *name;
+} pool_t;
+
+/**
+ * Initialize a pool
+ *
+ * PARAMETERS
+ * - pool: the pool to initialize
+ * - items: the storage for the items, `item_size * capacity` bytes, aligned for a pointer
+ * - item_size: the size of each item, at least the size of a pointer
+ * - capacity: how many items the pool has
+ * - name: how the pool is called in the logs
+ */
+external void pool_init(pool_t *pool, void *items, size_t item_size, uint16_t capacity, const char *name);
+
+/**
+ * Take an item from a pool, its contents are undefined
+ *
+ * RETURN VALUE
+ * - NULL if every item is in use
+ */
+external void *pool_alloc(pool_t *pool);
+
+/**
+ * Give an item back to its pool
+ */
+external void pool_free(pool_t *pool, void *item);
+
+/**
+ * Log the high water mark of a pool
+ */
+external void pool_report(const pool_t *pool);
+
+#endif /** UTIL_POOL_H */
@@ -0,0 +1,49 @@
+#include <hardware/sync.h>
+#include <string.h>
+#include <util/spsc.h>
+#include <util/types.h>
+
+void spsc_queue_init(spsc_queue_t *queue, void *items, size_t item_size, uint32_t capacity) {
+    queue->items = items;
+    queue->item_size = item_size;
+    queue->capacity = capacity;
+    queue->head = 0;
+    queue->tail = 0;
+}
+
+bool spsc_queue_push(spsc_queue_t *queue, const void *item) {
+    uint32_t head = queue->head;
+
+    if (head - queue->tail >= queue->capacity) {
+        return false;
+    }
+
+    memcpy(&queue->items[(head & (queue->capacity - 1)) * queue->item_size], item, queue->item_size);
+
+    // The item needs to be written before the consumer can see the new head
+    __dmb();
+
+    queue->head = head + 1;
+
+    return true;
+}
+
+bool spsc_queue_pop(spsc_queue_t *queue, void *item) {
+    uint32_t tail = queue->tail;
+
+    if (tail == queue->head) {
+        return false;
+    }
+
+    // Don't read the item before reading the head that published it
+    __dmb();
+
+    memcpy(item, &queue->items[(tail & (queue->capacity - 1)) * queue->item_size], queue->item_size);
+
+    // The item needs to be copied out before the producer can reuse the slot
+    __dmb();
+
+    queue->tail = tail + 1;
+
+    return true;
+}
@@ -0,0 +1,71 @@
+#ifndef UTIL_SPSC_H
+#define UTIL_SPSC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+
+/**
+ * A lock-free single-producer single-consumer queue of fixed-size items.
+ *
+ * The producer and the consumer can be on different cores, or one of them can be an IRQ
+ * handler, as long as there's only one of each. Items are copied in and out of the queue.
+ */
+typedef struct spsc_queue_t
+{
+    /**
+     * The storage for `capacity` items of `item_size` bytes
+     */
+    byte                *items;
+    size_t              item_size;
+
+    /**
+     * How many items the queue holds, needs to be a power of two
+     */
+    uint32_t            capacity;
+
+    /**
+     * Only written by the producer (`head`) and the consumer (`tail`), both only grow, the
+     * slot of an index is `index & (capacity - 1)`.
+     */
+    volatile uint32_t   head;
+    volatile uint32_t   tail;
+} spsc_queue_t;
+
+/**
+ * Initialize a queue
+ *
+ * PARAMETERS
+ * - queue: the queue to initialize
+ * - items: the storage for the items, `item_size * capacity` bytes
+ * - item_size: the size of each item
+ * - capacity: how many items the queue holds, needs to be a power of two
+ */
+external void spsc_queue_init(spsc_queue_t *queue, void *items, size_t item_size, uint32_t capacity);
+
+/**
+ * Copy an item into the queue, only call this from the producer
+ *
+ * RETURN VALUE
+ * - false if the queue is full
+ */
+external bool spsc_queue_push(spsc_queue_t *queue, const void *item);
+
+/**
+ * Copy the oldest item out of the queue, only call this from the consumer
+ *
+ * RETURN VALUE
+ * - false if the queue is empty
+ */
+external bool spsc_queue_pop(spsc_queue_t *queue, void *item);
+
+/**
+ * How many items are in the queue
+ */
+static force_inline uint32_t spsc_queue_count(const spsc_queue_t *queue) {
+    return queue->head - queue->tail;
+}
+
+#endif /** UTIL_SPSC_H */
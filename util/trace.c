@@ -0,0 +1,63 @@
+#include <util/trace.h>
+#include <stdio.h>
+#include <string.h>
+
+trace_table_t trace_tables[NUM_CORES];
+
+internal const char *const counter_names[TRACE_COUNTER_COUNT] = {
+    [TRACE_COUNTER_DMA_BYTES]         = "dma_bytes",
+    [TRACE_COUNTER_DISPLAY_BUSY]      = "display_busy",
+    [TRACE_COUNTER_BUSY_LOCK_WAIT]    = "busy_lock_wait_us",
+    [TRACE_COUNTER_FRAMES_FLUSHED]    = "frames_flushed",
+    [TRACE_COUNTER_SOLVE_EVALUATIONS] = "solve_evaluations",
+    [TRACE_COUNTER_SOLVE_ITERATIONS]  = "solve_iterations",
+    [TRACE_COUNTER_SOLVE_UNCONVERGED] = "solve_unconverged"
+};
+
+internal const char *const span_names[TRACE_SPAN_COUNT] = {
+    [TRACE_SPAN_DISPLAY_JOB]        = "display_job",
+    [TRACE_SPAN_RENDER_LIST]        = "render_list",
+    [TRACE_SPAN_FRAMEBUFFER_FLUSH]  = "framebuffer_flush",
+    [TRACE_SPAN_PLOT_EVALUATE]      = "plot_evaluate",
+    [TRACE_SPAN_PLOT_SEND]          = "plot_send",
+    [TRACE_SPAN_EVALUATE]           = "evaluate",
+    [TRACE_SPAN_SOLVE_STEP]         = "solve_step"
+};
+
+void trace_dump(void) {
+    for (int counter = 0; counter < TRACE_COUNTER_COUNT; counter++) {
+        uint64_t total = 0;
+
+        for (int core = 0; core < NUM_CORES; core++) {
+            total += trace_tables[core].counters[counter];
+        }
+
+        printf("trace %s=%llu\n", counter_names[counter], (unsigned long long) total);
+    }
+
+    for (int span = 0; span < TRACE_SPAN_COUNT; span++) {
+        trace_span_stats_t stats = { 0 };
+
+        for (int core = 0; core < NUM_CORES; core++) {
+            const trace_span_stats_t *core_stats = &trace_tables[core].spans[span];
+
+            stats.count += core_stats->count;
+            stats.total += core_stats->total;
+            stats.max = MAX(stats.max, core_stats->max);
+        }
+
+        // The average is only divided here, never while tracing
+        printf(
+            "trace %s count=%lu total_us=%llu average_us=%llu max_us=%lu\n",
+            span_names[span],
+            (unsigned long) stats.count,
+            (unsigned long long) stats.total,
+            (unsigned long long) (stats.count > 0 ? stats.total / stats.count : 0),
+            (unsigned long) stats.max
+        );
+    }
+}
+
+void trace_reset(void) {
+    memset(trace_tables, 0, sizeof(trace_tables));
+}
@@ -0,0 +1,174 @@
+#ifndef UTIL_TRACE_H
+#define UTIL_TRACE_H
+
+#include <pico.h>
+#include <pico/time.h>
+#include <stdint.h>
+#include <util/util.h>
+#include <util/types.h>
+#pragma once
+
+#if PICO_ON_DEVICE
+#   include <hardware/structs/timer.h>
+#endif
+
+/**
+ * Profiling of the hot paths: named counters, and spans that measure how long a piece of code
+ * takes. Both are kept in a fixed table per core, so the two cores never write to the same
+ * memory (the M0+ has no atomic instructions), and `trace_dump` adds them up.
+ *
+ * An update is a few loads and stores, it isn't guarded against the IRQ handlers of the same
+ * core: nothing is traced from an IRQ handler, unless the interrupts are masked already.
+ */
+
+/**
+ * If the counters and spans are compiled in, they compile to nothing otherwise
+ */
+#ifndef TRACE_ENABLED
+#   define TRACE_ENABLED 1
+#endif
+
+typedef enum trace_counter_t: byte {
+    /** The bytes the DMA was given to send to the display */
+    TRACE_COUNTER_DMA_BYTES         = 0,
+
+    /** The submissions `st7789v_queue_try_submit` turned back with `-EDISPLAYBUSY` */
+    TRACE_COUNTER_DISPLAY_BUSY,
+
+    /** The microseconds spent waiting for the display's bus lock */
+    TRACE_COUNTER_BUSY_LOCK_WAIT,
+
+    /** The framebuffers sent to the display */
+    TRACE_COUNTER_FRAMES_FLUSHED,
+
+    /** The evaluations and the refinements (splits of an integral, iterations of a root) of the solvers */
+    TRACE_COUNTER_SOLVE_EVALUATIONS,
+    TRACE_COUNTER_SOLVE_ITERATIONS,
+
+    /** The solves that stopped before their result was within the tolerance */
+    TRACE_COUNTER_SOLVE_UNCONVERGED,
+
+    TRACE_COUNTER_COUNT
+} trace_counter_t;
+
+typedef enum trace_span_t: byte {
+    /** A job run by the display core, from the queue */
+    TRACE_SPAN_DISPLAY_JOB          = 0,
+
+    TRACE_SPAN_RENDER_LIST,
+    TRACE_SPAN_FRAMEBUFFER_FLUSH,
+
+    /** Evaluating the columns a plot is missing, and sending them */
+    TRACE_SPAN_PLOT_EVALUATE,
+    TRACE_SPAN_PLOT_SEND,
+
+    /** Compiling and evaluating a line typed in the terminal */
+    TRACE_SPAN_EVALUATE,
+
+    /** A refinement step of a solver */
+    TRACE_SPAN_SOLVE_STEP,
+
+    TRACE_SPAN_COUNT
+} trace_span_t;
+
+typedef struct trace_span_stats_t
+{
+    uint32_t    count;
+
+    /** In microseconds, the timer's ticks */
+    uint64_t    total;
+    uint32_t    max;
+} trace_span_stats_t;
+
+typedef struct trace_table_t
+{
+    uint64_t            counters[TRACE_COUNTER_COUNT];
+    trace_span_stats_t  spans[TRACE_SPAN_COUNT];
+} trace_table_t;
+
+/**
+ * The table of each core, only written by that core
+ */
+external trace_table_t trace_tables[NUM_CORES];
+
+/**
+ * The 64-bit time since boot, in microseconds
+ *
+ * NOTES
+ * - The raw registers are read, the latched ones can't be shared by the two cores: the high
+ *   word is read again to know if the low one wrapped in between.
+ * - The host builds have no timer registers, they use `time_us_64`.
+ */
+static force_inline uint64_t trace_now(void) {
+#if !PICO_ON_DEVICE
+    return time_us_64();
+#else
+    uint32_t high = timer_hw->timerawh;
+    uint32_t low;
+
+    for (;;) {
+        low = timer_hw->timerawl;
+
+        uint32_t next = timer_hw->timerawh;
+
+        if (next == high) {
+            return ((uint64_t) high << 32) | low;
+        }
+
+        high = next;
+    }
+#endif
+}
+
+static force_inline void trace_count(trace_counter_t counter, uint32_t amount) {
+    trace_tables[get_core_num()].counters[counter] += amount;
+}
+
+static force_inline void trace_span_record(trace_span_t span, uint64_t start) {
+    trace_span_stats_t *stats = &trace_tables[get_core_num()].spans[span];
+    uint64_t elapsed = trace_now() - start;
+
+    stats->count++;
+    stats->total += elapsed;
+
+    if (elapsed > stats->max) {
+        stats->max = (uint32_t) MIN(elapsed, UINT32_MAX);
+    }
+}
+
+#if TRACE_ENABLED
+#   define TRACE_COUNT(counter, amount)  trace_count(counter, amount)
+
+/**
+ * Measure the code between the two, in the same scope: `span` is the name of a `trace_span_t`
+ * (its start is kept in a local named after it)
+ */
+#   define TRACE_BEGIN(span)             const uint64_t __trace_start_##span = trace_now()
+#   define TRACE_END(span)               trace_span_record(span, __trace_start_##span)
+
+/**
+ * Add the microseconds since `TRACE_BEGIN(counter)` to a counter, for the time spent waiting
+ */
+#   define TRACE_COUNT_ELAPSED(counter)  trace_count(counter, trace_now() - __trace_start_##counter)
+#else
+#   define TRACE_COUNT(counter, amount)  do { } while (0)
+#   define TRACE_BEGIN(span)             do { } while (0)
+#   define TRACE_END(span)               do { } while (0)
+#   define TRACE_COUNT_ELAPSED(counter)  do { } while (0)
+#endif
+
+/**
+ * Print the counters and spans of both cores over stdio
+ *
+ * NOTES
+ * - The tables are read while the other core keeps updating its own, a value can be off by
+ *   the update in progress.
+ */
+external void trace_dump(void);
+
+/**
+ * Set every counter and span back to zero
+ */
+external void trace_reset(void);
+
+#endif /** UTIL_TRACE_H */